@@ -0,0 +1,16 @@
+#ifndef WORKER_AFFINITY_H
+#define WORKER_AFFINITY_H
+
+/* This generated file contains includes for project dependencies */
+#include "worker_affinity/bake_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,127 @@
+#include <worker_affinity.h>
+#include <stdio.h>
+
+// This example is a benchmark harness for pinning worker threads to CPUs. It
+// runs the same multithreaded system with and without thread affinity and 
+// table affinity, and reports how many entities each thread processed per 
+// second of time spent in the system.
+
+#define THREAD_COUNT (4)
+#define TABLE_COUNT (64)
+#define ENTITIES_PER_TABLE (10000)
+#define FRAME_COUNT (200)
+
+typedef struct {
+    float x, y;
+} Position, Velocity;
+
+// Per-thread statistics, indexed by stage id. Each thread only writes its own
+// element, so no synchronization is needed.
+typedef struct {
+    int64_t entities;
+    double time_spent;
+    char padding[48]; // Prevent false sharing between threads
+} ThreadStats;
+
+static ThreadStats stats[THREAD_COUNT];
+
+void Move(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    const Velocity *v = ecs_field(it, Velocity, 1);
+
+    ecs_time_t t = {0};
+    ecs_time_measure(&t);
+
+    for (int i = 0; i < it->count; i ++) {
+        p[i].x += v[i].x;
+        p[i].y += v[i].y;
+    }
+
+    ThreadStats *s = &stats[ecs_stage_get_id(it->world)];
+    s->entities += it->count;
+    s->time_spent += ecs_time_measure(&t);
+}
+
+static
+void run(const char *label, bool pin, bool table_affinity) {
+    ecs_world_t *ecs = ecs_init();
+
+    ECS_COMPONENT(ecs, Position);
+    ECS_COMPONENT(ecs, Velocity);
+
+    ecs_system(ecs, {
+        .entity = ecs_entity(ecs, {
+            .add = ecs_ids( ecs_dependson(EcsOnUpdate) )
+        }),
+        .query.terms = {
+            { .id = ecs_id(Position) },
+            { .id = ecs_id(Velocity), .inout = EcsIn }
+        },
+        .callback = Move,
+        .multi_threaded = true,
+        .table_affinity = table_affinity
+    });
+
+    // Create entities in many tables by adding a different tag to each table
+    for (int t = 0; t < TABLE_COUNT; t ++) {
+        ecs_entity_t tag = ecs_new(ecs);
+        for (int e = 0; e < ENTITIES_PER_TABLE; e ++) {
+            ecs_entity_t ent = ecs_new(ecs);
+            ecs_set(ecs, ent, Position, {0, 0});
+            ecs_set(ecs, ent, Velocity, {1, 1});
+            ecs_add_id(ecs, ent, tag);
+        }
+    }
+
+    ecs_set_threads(ecs, THREAD_COUNT);
+
+    if (pin) {
+        if (!ecs_os_has_thread_affinity()) {
+            printf("%s: thread affinity not supported\n", label);
+            ecs_fini(ecs);
+            return;
+        }
+
+        // Pin each thread to its own CPU. Use ecs_set_stage_numa_node instead
+        // to pin threads to the CPUs of a NUMA node.
+        for (int i = 0; i < THREAD_COUNT; i ++) {
+            int32_t cpu = i;
+            ecs_set_stage_affinity(ecs, i, &cpu, 1);
+        }
+    }
+
+    ecs_os_memset_n(stats, 0, ThreadStats, THREAD_COUNT);
+
+    for (int f = 0; f < FRAME_COUNT; f ++) {
+        ecs_progress(ecs, 0);
+    }
+
+    printf("%s:\n", label);
+    for (int i = 0; i < THREAD_COUNT; i ++) {
+        double throughput = 0;
+        if (stats[i].time_spent > 0) {
+            throughput = (double)stats[i].entities / stats[i].time_spent;
+        }
+
+        printf("  thread %d: %10.2f M entities/sec (%lld entities)\n", i, 
+            throughput / 1000000.0, (long long)stats[i].entities);
+    }
+
+    ecs_fini(ecs);
+}
+
+int main(int argc, char *argv[]) {
+    (void)argc;
+    (void)argv;
+
+    run("no affinity", false, false);
+    run("table affinity", false, true);
+    run("thread + table affinity", true, true);
+
+    return 0;
+
+    // Output (numbers depend on hardware)
+    //  no affinity:
+    //    thread 0:     512.20 M entities/sec (32000000 entities)
+    //    ...
+}
@@ -203,6 +203,9 @@
 #define FLECS_OS_API_IMPL   /**< Default implementation for OS API */
 #define FLECS_HTTP          /**< Tiny HTTP server for connecting to remote UI */
 #define FLECS_REST          /**< REST API for querying application data */
+#define FLECS_TIMELINE      /**< Record per-thread timelines of a frame */
+#define FLECS_BINARY        /**< Save and load worlds in a binary format */
+#define FLECS_SNAPSHOT      /**< Take and restore in-memory world snapshots */
 // #define FLECS_JOURNAL    /**< Journaling addon (disabled by default) */
 // #define FLECS_PERF_TRACE /**< Enable performance tracing (disabled by default) */
 #endif // ifndef FLECS_CUSTOM_BUILD
@@ -276,6 +279,14 @@
 #define FLECS_EVENT_DESC_MAX (8)
 #endif
 
+/** @def FLECS_PARALLEL_DTOR_MIN
+ * Minimum number of components destructed by a delete operation before the
+ * destructors are divided between delete threads. See ecs_set_delete_threads().
+ */
+#ifndef FLECS_PARALLEL_DTOR_MIN
+#define FLECS_PARALLEL_DTOR_MIN (4096)
+#endif
+
 /** @def FLECS_VARIABLE_COUNT_MAX
  * Maximum number of query variables per query */
 #define FLECS_VARIABLE_COUNT_MAX (64)
@@ -1248,6 +1259,21 @@ typedef struct ecs_observer_desc_t {
      * #EcsOnAdd `Position` would match all existing instances of `Position`. */
     bool yield_existing;
 
+    /** Queue events instead of invoking the observer when the event is emitted.
+     * Queued events are ran by the pipeline after the merge, divided between
+     * the worker threads. Async observers receive the entities of the event,
+     * and should only read component data and write through commands.
+     * Events for entities that no longer match the observer query by the time
+     * the event runs are discarded, which is why async observers only support
+     * the OnAdd and OnSet events. Requires the pipeline addon. */
+    bool async;
+
+    /** Only invoke the observer for the last OnSet event of an entity and 
+     * component when deferred commands are merged. When a component is set or
+     * modified multiple times for the same entity while deferred, the observer
+     * is only invoked for the last command. */
+    bool coalesce;
+
     /** Callback to invoke on an event, invoked when the observer matches. */
     ecs_iter_action_t callback;
 
@@ -1782,6 +1808,17 @@ FLECS_API extern const ecs_entity_t EcsSparse;
 /** Mark relationship as union */
 FLECS_API extern const ecs_entity_t EcsUnion;
 
+/** Keep children of parent in a list that preserves creation order.
+ * When added to a parent, ecs_children() returns the children of the parent
+ * as a single contiguous array in the order in which they were parented,
+ * instead of returning the children per table. The order can be changed with
+ * ecs_set_child_order().
+ *
+ * The trait only provides a stable child order. Component data of children is
+ * still stored per table, and the order is not used by queries, including
+ * queries with cascade terms. */
+FLECS_API extern const ecs_entity_t EcsOrderedChildren;
+
 /** Marker used to indicate `$var == ...` matching in queries. */
 FLECS_API extern const ecs_entity_t EcsPredEq;
 
@@ -2368,6 +2405,108 @@ FLECS_API
 int32_t ecs_stage_get_id(
     const ecs_world_t *world);
 
+/** Enqueue add command from any thread.
+ * The async operations add commands to a lock-free queue owned by the world,
+ * and can be called from any thread without owning a stage. This makes them
+ * useful for threads that are not managed by flecs, such as network threads.
+ *
+ * Async commands are executed by ecs_async_flush(). By default the queue is
+ * flushed at the start of each frame by ecs_frame_begin(). When the pipeline
+ * addon is used, ecs_set_async_flush_phase() can be used to flush the queue
+ * in a pipeline phase instead.
+ *
+ * Commands for entities that are no longer alive when the queue is flushed are
+ * ignored. Ids are not validated when a command is enqueued, as this would
+ * read world data from another thread. Commands with invalid ids are discarded
+ * with an error when the queue is flushed. Async operations require the acas
+ * function of the OS API.
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The id to add.
+ */
+FLECS_API
+void ecs_async_add_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id);
+
+/** Enqueue remove command from any thread.
+ * See ecs_async_add_id().
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The id to remove.
+ */
+FLECS_API
+void ecs_async_remove_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id);
+
+/** Enqueue set command from any thread.
+ * See ecs_async_add_id(). The value is copied with a memcpy, which means this
+ * operation should only be used for components that can be trivially copied.
+ * The size of the value must match the size of the component.
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The component to set.
+ * @param size The size of the value.
+ * @param ptr Pointer to the value.
+ */
+FLECS_API
+void ecs_async_set_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    size_t size,
+    const void *ptr);
+
+/** Enqueue delete command from any thread.
+ * See ecs_async_add_id().
+ *
+ * @param world The world.
+ * @param entity The entity to delete.
+ */
+FLECS_API
+void ecs_async_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity);
+
+/** Enqueue event from any thread.
+ * Same as ecs_enqueue(), but can be called from any thread. See 
+ * ecs_async_add_id(). Async events must be emitted for an entity.
+ *
+ * Because the type information of the event can't be safely accessed from a 
+ * thread that does not own the world, the size of the event parameter must be
+ * provided. The parameter is copied with a memcpy.
+ *
+ * @param world The world.
+ * @param desc Event parameters.
+ * @param param_size Size of the event parameter, or 0 if there is none.
+ */
+FLECS_API
+void ecs_async_enqueue(
+    ecs_world_t *world,
+    const ecs_event_desc_t *desc,
+    ecs_size_t param_size);
+
+/** Execute commands enqueued by async operations.
+ * This operation takes ownership of all commands in the async queue, and 
+ * executes them in the order in which they were enqueued. When called with a
+ * stage or while the world is deferred, the commands are added to the command
+ * queue of the stage. Commands with invalid ids are discarded with an error.
+ *
+ * This operation must be called from the thread that owns the world.
+ *
+ * @param world The world or stage.
+ * @return The number of executed commands.
+ */
+FLECS_API
+int32_t ecs_async_flush(
+    ecs_world_t *world);
+
 /** @} */
 
 /**
@@ -2807,6 +2946,33 @@ void ecs_delete_with(
     ecs_world_t *world,
     ecs_id_t id);
 
+/** Run destructors of deleted hierarchies on multiple threads.
+ * When an entity is deleted that has children, or an entity that is used by
+ * other entities with a (OnDeleteTarget, Delete) relationship, all affected
+ * tables are collected before they are emptied. By default component
+ * destructors run on the calling thread while each table is emptied. 
+ *
+ * When delete threads are configured, OnRemove hooks and observers and entity
+ * index updates still run on the calling thread for each table, but component
+ * destructors run after all tables have been emptied. The destructed
+ * components are divided between the calling thread and N - 1 task threads
+ * created with ecs_os_task_new(). Destructors for fewer than 
+ * FLECS_PARALLEL_DTOR_MIN components always run on the calling thread.
+ *
+ * Destructors that run on task threads must not access the world, and must be
+ * safe to call concurrently for different components. When destructors run,
+ * the deleted entities are no longer alive.
+ *
+ * This setting requires OS API task support.
+ *
+ * @param world The world.
+ * @param threads The number of threads (0 to destruct on the calling thread).
+ */
+FLECS_API
+void ecs_set_delete_threads(
+    ecs_world_t *world,
+    int32_t threads);
+
 /** @} */
 
 /**
@@ -3097,6 +3263,10 @@ void* ecs_ensure_modified_id(
  * data to reduce overhead of repeatedly accessing the component. Use
  * ecs_ref_get() to get the component data.
  *
+ * A ref caches the component pointer together with the storage version of the
+ * entity's table. As long as the entity stays in the same row and the table
+ * storage is not reallocated, getting the component only costs a version check.
+ *
  * @param world The world.
  * @param entity The entity.
  * @param id The id of the component.
@@ -3122,6 +3292,26 @@ void* ecs_ref_get_id(
     ecs_ref_t *ref,
     ecs_id_t id);
 
+/** Get components from an array of refs.
+ * Same as calling ecs_ref_get_id() for each ref, but refs that need to be
+ * resolved are processed in batch, sorted by table, component and row. This
+ * improves memory locality and ensures that refs to the same component in the
+ * same table share a single lookup.
+ *
+ * The refs in the array may be for different entities and components.
+ *
+ * @param world The world.
+ * @param refs The array of refs.
+ * @param count The number of refs.
+ * @param ptrs Output array with a component pointer (or NULL) per ref.
+ */
+FLECS_API
+void ecs_ref_get_array(
+    const ecs_world_t *world,
+    ecs_ref_t *refs,
+    int32_t count,
+    void **ptrs);
+
 /** Update ref.
  * Ensures contents of ref are up to date. Same as ecs_ref_get_id(), but does not
  * return pointer to component id.
@@ -3970,6 +4160,31 @@ void ecs_get_path_w_sep_buf(
     const char *prefix,
     ecs_strbuf_t *buf);
 
+/** Enable/disable the path cache.
+ * When enabled, paths of named entities relative to the root that use the
+ * default separator (".") and a NULL or empty prefix are stored after they
+ * have been created, so that subsequent calls to ecs_get_path_w_sep() and
+ * ecs_get_path_w_sep_buf() (and the serializers that use them) can copy the
+ * cached string. Lookups from the root with ecs_lookup_path_w_sep() are cached
+ * in the reverse direction.
+ *
+ * The cache is keyed by entity id (including generation) and is cleared when
+ * an entity that is part of a cached path is renamed, reparented or deleted.
+ *
+ * The cache is only populated when the world is not in multithreaded mode.
+ * While the cache is enabled, path functions that are called outside of
+ * multithreaded mode may modify the cache and should not be called from
+ * multiple threads at the same time. The cache is disabled by default.
+ *
+ * @param world The world.
+ * @param enable True to enable the path cache, false to disable.
+ * @return The previous value.
+ */
+FLECS_API
+bool ecs_enable_path_cache(
+    ecs_world_t *world,
+    bool enable);
+
 /** Find or create entity from path.
  * This operation will find or create an entity from a path, and will create any
  * intermediate entities if required. If the entity already exists, no entities
@@ -4483,6 +4698,9 @@ bool ecs_each_next(
  * ecs_iter_t it = ecs_each_id(world, ecs_pair(EcsChildOf, parent));
  * @endcode
  * 
+ * If the parent has the #EcsOrderedChildren trait, the iterator returns a
+ * single result with all children in order.
+ *
  * @param world The world.
  * @param parent The parent.
  * @return An iterator that iterates all children of the parent.
@@ -4503,6 +4721,24 @@ FLECS_API
 bool ecs_children_next(
     ecs_iter_t *it);
 
+/** Change the order of the children of a parent.
+ * The parent must have the #EcsOrderedChildren trait. The provided array must
+ * contain every child of the parent exactly once. After this operation,
+ * ecs_children() returns the children in the order of the array. Children
+ * that are added to the parent afterwards are appended to the end.
+ *
+ * @param world The world.
+ * @param parent The parent.
+ * @param children The children in the new order.
+ * @param child_count The number of elements in the children array.
+ */
+FLECS_API
+void ecs_set_child_order(
+    ecs_world_t *world,
+    ecs_entity_t parent,
+    const ecs_entity_t *children,
+    int32_t child_count);
+
 /** @} */
 
 /**
@@ -5002,6 +5238,19 @@ const ecs_observer_t* ecs_observer_get(
     const ecs_world_t *world,
     ecs_entity_t observer);
 
+/** Get number of queued events for an async observer.
+ * Returns the number of events that have been queued for an observer created
+ * with ecs_observer_desc_t::async, and that haven't run yet.
+ *
+ * @param world The world.
+ * @param observer The observer.
+ * @return The number of queued events, or 0 if the observer is not async.
+ */
+FLECS_API
+int32_t ecs_observer_queue_count(
+    const ecs_world_t *world,
+    ecs_entity_t observer);
+
 /** @} */
 
 /**
@@ -5315,8 +5564,30 @@ ecs_iter_t ecs_worker_iter(
     int32_t index,
     int32_t count);
 
+/** Create a worker iterator that divides tables across resources.
+ * Same as ecs_worker_iter(), but instead of dividing the entities of each table
+ * across all resources, each matched table is returned in its entirety to a
+ * single resource. A table is always assigned to the same resource, so that
+ * when the iterator is created each frame, a thread keeps processing the same
+ * tables. This keeps table data in the caches of the thread that uses it, at
+ * the cost of a less even distribution when a query matches few tables.
+ *
+ * The iterator must be iterated with ecs_worker_next().
+ *
+ * @param it The source iterator.
+ * @param index The index of the current resource.
+ * @param count The total number of resources to divide tables between.
+ * @return A worker iterator.
+ */
+FLECS_API
+ecs_iter_t ecs_worker_table_iter(
+    const ecs_iter_t *it,
+    int32_t index,
+    int32_t count);
+
 /** Progress a worker iterator.
- * Progresses an iterator created by ecs_worker_iter().
+ * Progresses an iterator created by ecs_worker_iter() or
+ * ecs_worker_table_iter().
  *
  * @param it The iterator.
  * @return true if iterator has more results, false if not.
@@ -0,0 +1,157 @@
+/**
+ * @file addons/binary.h
+ * @brief Binary world serializer addon.
+ *
+ * The binary addon saves the contents of a world to a compact binary format,
+ * and loads it back into a world. Tables are stored column by column, so that
+ * components without lifecycle hooks or entity references can be stored and
+ * loaded with a single copy per column. Other components are serialized with
+ * their reflection data.
+ *
+ * Loading a snapshot from a file maps the file in memory if the OS API
+ * supports it. Entities that do not yet exist in the world are created in bulk
+ * per table. Entities that do exist, such as entities with names that were
+ * created by the application, are merged with the stored data.
+ *
+ * Snapshots are not portable between builds with different component layouts
+ * or byte order. Loading a snapshot fails if the layout of a component does not
+ * match the layout of the component in the world.
+ *
+ * Iterator results can be serialized to a columnar binary stream, which is
+ * used by the REST API as a compact alternative to JSON. Each result stores
+ * the matched entity ids and field values as arrays, so that clients with the
+ * same component layout can read them with a single copy per field.
+ */
+
+#ifdef FLECS_BINARY
+
+#ifndef FLECS_META
+#define FLECS_META
+#endif
+
+/**
+ * @defgroup c_addons_binary Binary
+ * @ingroup c_addons
+ * Save and load worlds in a binary format.
+ *
+ * @{
+ */
+
+#ifndef FLECS_BINARY_H
+#define FLECS_BINARY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Serialize world to binary buffer.
+ * The same entities are serialized as with ecs_world_to_json(), which excludes
+ * builtin entities and modules.
+ *
+ * Components that have lifecycle hooks are only serialized when they have
+ * reflection data. Component values that are stored in opaque types are stored
+ * as JSON, and require the JSON addon. Sparse components and union
+ * relationships are supported, toggle bits of components are not stored.
+ *
+ * @param world The world.
+ * @param size_out Output parameter for the size of the returned buffer.
+ * @return The buffer, or NULL if failed. Must be freed with ecs_os_free().
+ */
+FLECS_API
+void* ecs_world_to_binary(
+    ecs_world_t *world,
+    ecs_size_t *size_out);
+
+/** Serialize world to binary file.
+ * Same as ecs_world_to_binary(), but writes the result to a file.
+ *
+ * @param world The world.
+ * @param filename The file to write to.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_world_to_binary_file(
+    ecs_world_t *world,
+    const char *filename);
+
+/** Load binary buffer into world.
+ * Entities are mapped to the world the same way as with ecs_world_from_json().
+ * Named entities are looked up by path, and are created if they do not exist.
+ * Anonymous entities keep their id if it is not in use, and are assigned a
+ * new id otherwise.
+ *
+ * Components must be registered before loading a snapshot. Prefab children
+ * are not instantiated for instances in the snapshot, as the snapshot already
+ * contains the instance children.
+ *
+ * This operation may not be called while the world is deferred.
+ *
+ * @param world The world.
+ * @param data The buffer created by ecs_world_to_binary().
+ * @param size The size of the buffer.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_world_from_binary(
+    ecs_world_t *world,
+    const void *data,
+    ecs_size_t size);
+
+/** Load binary file into world.
+ * Same as ecs_world_from_binary(), but reads from a file. If the OS API
+ * supports it, the file is mapped in memory instead of read into a buffer.
+ *
+ * @param world The world.
+ * @param filename The file to load.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_world_from_binary_file(
+    ecs_world_t *world,
+    const char *filename);
+
+/** Serialize iterator results to binary buffer.
+ * The stream starts with a header and a descriptor per field, followed by an
+ * entry per iterator result. A result stores the number of entities, the
+ * entity ids and a column per set field. A column stores the matched id, the
+ * field source and an array with a value per entity, or a single value if the
+ * field is not matched on the $this entity. Tags have columns without data.
+ *
+ * Values use the same encoding as ecs_world_to_binary(): components without
+ * lifecycle hooks or entity references are stored as they are in memory, other
+ * components are serialized with their reflection data. The stream ends with
+ * an entry that has the end flag set. All elements are padded to 8 bytes.
+ *
+ * Entity names and query variables other than $this are not serialized. This
+ * operation progresses the iterator to the end.
+ *
+ * @param iter The iterator to serialize.
+ * @param buf The buffer to append the results to.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_iter_to_binary_buf(
+    ecs_iter_t *iter,
+    ecs_strbuf_t *buf);
+
+/** Serialize iterator results to binary buffer.
+ * Same as ecs_iter_to_binary_buf(), but returns a new buffer.
+ *
+ * @param iter The iterator to serialize.
+ * @param size_out Output parameter for the size of the returned buffer.
+ * @return The buffer, or NULL if failed. Must be freed with ecs_os_free().
+ */
+FLECS_API
+void* ecs_iter_to_binary(
+    ecs_iter_t *iter,
+    ecs_size_t *size_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/** @} */
+
+#endif
@@ -154,6 +154,7 @@ static const flecs::entity_t Symbol = EcsSymbol;
 /* Storage */
 static const flecs::entity_t Sparse = EcsSparse;
 static const flecs::entity_t Union = EcsUnion;
+static const flecs::entity_t OrderedChildren = EcsOrderedChildren;
 
 /* Builtin predicates for comparing entity ids in queries. */
 static const flecs::entity_t PredEq = EcsPredEq;
@@ -166,6 +166,14 @@ struct opaque {
         return *this;
     }
 
+    /** Return pointer to contiguous elements */
+    opaque& data(ElemType* (*func)(T *dst)) {
+        this->desc.type.data =
+            reinterpret_cast<decltype(
+                this->desc.type.data)>(func);
+        return *this;
+    }
+
     ~opaque() {
         if (world) {
             ecs_opaque_init(world, &desc);
@@ -49,6 +49,18 @@ struct observer_builder_i : query_builder_i<Base, Components ...> {
         return *this;
     }
 
+    /** Queue events, and run them on worker threads after the merge */
+    Base& async(bool value = true) {
+        desc_->async = value;
+        return *this;
+    }
+
+    /** Only invoke observer for the last OnSet event of a deferred entity */
+    Base& coalesce(bool value = true) {
+        desc_->coalesce = value;
+        return *this;
+    }
+
     /** Set observer context */
     Base& ctx(void *ptr) {
         desc_->ctx = ptr;
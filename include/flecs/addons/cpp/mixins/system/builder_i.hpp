@@ -68,6 +68,15 @@ public:
         return *this;
     }
 
+    /** Specify whether a multi threaded system divides tables across threads.
+     *
+     * @param value If true each table is processed by a single thread.
+     */
+    Base& table_affinity(bool value = true) {
+        desc_->table_affinity = value;
+        return *this;
+    }
+
     /** Specify whether system should be ran in staged context.
      *
      * @param value If false system will always run staged.
@@ -115,6 +124,28 @@ public:
         return *this;
     }
 
+    /** Stagger system rate.
+     * Assign a phase offset to the system's rate filter, so that systems with
+     * the same rate run on different frames.
+     *
+     * @param value If false the system will not be staggered.
+     */
+    Base& stagger(bool value = true) {
+        desc_->stagger = value;
+        return *this;
+    }
+
+    /** Spread matched entities across multiple runs.
+     * Each run of the system processes the next share of the matched entities,
+     * so that all entities are processed once every time_slices runs.
+     *
+     * @param time_slices The number of runs to spread entities across.
+     */
+    Base& time_slices(int32_t time_slices) {
+        desc_->time_slices = time_slices;
+        return *this;
+    }
+
     /** Set tick source.
      * This operation sets a shared tick source for the system.
      *
@@ -599,6 +599,16 @@ struct world {
         ecs_enable_range_check(world_, enabled);
     }
 
+    /** Run destructors of deleted hierarchies on multiple threads.
+     *
+     * @param threads The number of threads (0 to destruct on calling thread).
+     *
+     * @see ecs_set_delete_threads()
+     */
+    void set_delete_threads(int32_t threads) const {
+        ecs_set_delete_threads(world_, threads);
+    }
+
     /** Set current scope.
      *
      * @param scope The scope to set.
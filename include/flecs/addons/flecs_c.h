@@ -349,6 +349,29 @@
 
 /** @} */
 
+/**
+ * @defgroup flecs_c_async Async commands
+ * @{
+ */
+
+#define ecs_async_add(world, entity, T)\
+    ecs_async_add_id(world, entity, ecs_id(T))
+
+#define ecs_async_add_pair(world, subject, first, second)\
+    ecs_async_add_id(world, subject, ecs_pair(first, second))
+
+#define ecs_async_remove(world, entity, T)\
+    ecs_async_remove_id(world, entity, ecs_id(T))
+
+#define ecs_async_remove_pair(world, subject, first, second)\
+    ecs_async_remove_id(world, subject, ecs_pair(first, second))
+
+#define ecs_async_set(world, entity, component, ...)\
+    ecs_async_set_id(world, entity, ecs_id(component), sizeof(component),\
+        &(component)__VA_ARGS__)
+
+/** @} */
+
 /**
  * @defgroup flecs_c_getting_setting Getting & Setting
  * @{
@@ -342,6 +342,7 @@ int ecs_iter_to_json_buf(
 typedef struct ecs_world_to_json_desc_t {
     bool serialize_builtin;    /**< Exclude flecs modules & contents */
     bool serialize_modules;    /**< Exclude modules & contents */
+    int32_t thread_count;      /**< Serialize tables on multiple threads */
 } ecs_world_to_json_desc_t;
 
 /** Serialize world into JSON string.
@@ -358,6 +359,14 @@ typedef struct ecs_world_to_json_desc_t {
  * ecs_iter_to_json(iter, &desc);
  * @endcode
  *
+ * If thread_count is larger than 1 and the OS API provides task functions,
+ * tables are divided between threads that each serialize to their own buffer.
+ * The buffers are appended in order, so the result is the same as when the
+ * world is serialized on a single thread. The world may not be modified while
+ * it is being serialized. Because the output of each thread is kept in memory,
+ * ecs_world_to_json_buf() ignores thread_count for buffers with a flush action
+ * (see ecs_strbuf_t::flush_action).
+ *
  * @param world The world to serialize.
  * @return A JSON string with the serialized iterator data, or NULL if failed.
  */
@@ -368,6 +377,8 @@ char* ecs_world_to_json(
 
 /** Serialize world into JSON string buffer.
  * Same as ecs_world_to_json(), but serializes to an ecs_strbuf_t instance.
+ * To stream a large world to a file or socket without first building the
+ * entire string in memory, provide a buffer with a flush action.
  *
  * @param world The world to serialize.
  * @param buf_out The strbuf to append the string to.
@@ -457,6 +457,18 @@ typedef struct EcsOpaque {
     void (*resize)(
         void *dst,
         size_t count);
+
+    /** Return pointer to contiguous elements.
+     * Can be set for types that map to a vector or array of primitive values
+     * (except strings, entities and ids), and that store their elements as a
+     * contiguous array of the element type. When set, serializers read the
+     * elements directly from the returned pointer, and the serialize callback
+     * is not invoked. For vectors the count callback must also be set. The
+     * binary deserializer calls resize before writing elements to the returned
+     * pointer. If ensure_element is not set, the cursor uses resize and the
+     * returned pointer to assign elements. */
+    void* (*data)(
+        void *dst);
 } EcsOpaque;
 
 
@@ -550,6 +562,7 @@ typedef struct ecs_meta_type_op_t {
  */
 typedef struct EcsTypeSerializer {
     ecs_vec_t ops;      /**< vector<ecs_meta_type_op_t> */
+    struct ecs_json_ser_plan_t *json; /**< Private. JSON serializer, compiled on first use */
 } EcsTypeSerializer;
 
 
@@ -212,6 +212,46 @@ void ecs_run_pipeline(
     ecs_entity_t pipeline,
     ecs_ftime_t delta_time);
 
+/** Set phase in which async commands are flushed.
+ * By default commands enqueued with async operations (like ecs_async_add_id())
+ * are flushed at the start of the frame. This operation creates a system in 
+ * the provided phase that flushes the async queue instead. This makes it 
+ * possible to apply commands from other threads at a point in the frame where
+ * they don't interfere with systems that read the affected components.
+ *
+ * The system is an immediate system, which means that the commands are merged
+ * before systems in subsequent phases run.
+ *
+ * If 0 is provided for the phase, the queue is flushed at the start of the
+ * frame again. This operation may not be called while the world is progressing.
+ *
+ * @param world The world.
+ * @param phase The phase in which to flush async commands.
+ */
+FLECS_API
+void ecs_set_async_flush_phase(
+    ecs_world_t *world,
+    ecs_entity_t phase);
+
+/** Set phase in which events of async observers run.
+ * Observers created with ecs_observer_desc_t::async queue their events instead
+ * of running them when the event is emitted. The queued events run in a 
+ * multi threaded system, which divides the events between the worker threads.
+ * Commands enqueued by async observers are merged at the end of the phase.
+ *
+ * The system is created when the first async observer is created, and runs in
+ * the EcsPostUpdate phase by default. If 0 is provided for the phase, the 
+ * default phase is used. This operation may not be called while the world is
+ * progressing.
+ *
+ * @param world The world.
+ * @param phase The phase in which to run async observers.
+ */
+FLECS_API
+void ecs_set_async_observer_phase(
+    ecs_world_t *world,
+    ecs_entity_t phase);
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //// Threading
@@ -263,6 +303,64 @@ FLECS_API
 bool ecs_using_task_threads(
     ecs_world_t *world);
 
+/** Pin the thread of a stage to a set of CPUs.
+ * The thread that runs the stage restricts itself to the specified CPUs before
+ * it runs the pipeline for the next time. Stage 0 is the thread that calls
+ * ecs_progress(), stages 1..N are the worker threads.
+ *
+ * Because affinity can only be set after the worker threads have started, a
+ * thread is pinned on a later iteration. The stage (including its command
+ * queue and allocators) is created by the thread that calls ecs_set_threads(),
+ * and is not moved to the memory node of the CPUs the thread is pinned to.
+ *
+ * The affinity is stored in the stage. Worker stages lose their affinity when
+ * the number of threads is changed with ecs_set_threads(). Passing a count of 0 removes the affinity
+ * from the stage, but does not unpin a thread that was already pinned. This
+ * operation may not be called while the world is progressing.
+ *
+ * @param world The world.
+ * @param stage_id The stage id.
+ * @param cpus Array with CPU indices.
+ * @param count Number of elements in cpus.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_set_stage_affinity(
+    ecs_world_t *world,
+    int32_t stage_id,
+    const int32_t *cpus,
+    int32_t count);
+
+/** Pin the thread of a stage to the CPUs of a NUMA node.
+ * Same as ecs_set_stage_affinity(), but uses the CPUs of the specified NUMA
+ * node as obtained from the OS API. This only pins the thread. The memory of
+ * the stage is not allocated on the node, and the node is not used when
+ * tables are assigned to workers.
+ *
+ * @param world The world.
+ * @param stage_id The stage id.
+ * @param node The NUMA node.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_set_stage_numa_node(
+    ecs_world_t *world,
+    int32_t stage_id,
+    int32_t node);
+
+/** Get NUMA node of stage.
+ * Returns the node set with ecs_set_stage_numa_node(), or -1 if no node was
+ * set for the stage.
+ *
+ * @param world The world.
+ * @param stage_id The stage id.
+ * @return The NUMA node of the stage.
+ */
+FLECS_API
+int32_t ecs_get_stage_numa_node(
+    const ecs_world_t *world,
+    int32_t stage_id);
+
 ////////////////////////////////////////////////////////////////////////////////
 //// Module
 ////////////////////////////////////////////////////////////////////////////////
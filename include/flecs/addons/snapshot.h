@@ -0,0 +1,172 @@
+/**
+ * @file addons/snapshot.h
+ * @brief Snapshot addon.
+ *
+ * A snapshot stores a copy of the component data in a world, which can be
+ * restored later. Snapshots are intended for applications that frequently need
+ * to roll back the state of a simulation, like multiplayer games that use
+ * rollback networking.
+ *
+ * Snapshots copy table columns to buffers that are reused when a snapshot is
+ * updated. Columns that have not changed since a snapshot was taken, as
+ * tracked by the dirty state that is also used by change detection, are not
+ * copied when a snapshot is updated or restored.
+ *
+ * The changes between a snapshot and a world can be encoded as a delta, which
+ * can be applied to another world to replicate the changes.
+ */
+
+#ifdef FLECS_SNAPSHOT
+
+/**
+ * @defgroup c_addons_snapshot Snapshot
+ * @ingroup c_addons
+ * Take and restore in-memory world snapshots.
+ *
+ * @{
+ */
+
+#ifndef FLECS_SNAPSHOT_H
+#define FLECS_SNAPSHOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Opaque snapshot type. */
+typedef struct ecs_snapshot_t ecs_snapshot_t;
+
+/** Take snapshot of world.
+ * A snapshot stores the entities and component values of all tables that do
+ * not contain builtin entities, such as components, systems and modules.
+ *
+ * Component values are copied with the copy hooks of a component. Values of
+ * sparse components, targets of union relationships and toggle bits are not
+ * stored in a snapshot.
+ *
+ * @param world The world.
+ * @return The snapshot.
+ */
+FLECS_API
+ecs_snapshot_t* ecs_snapshot_take(
+    ecs_world_t *world);
+
+/** Update existing snapshot with current state of world.
+ * This operation has the same result as freeing the snapshot and taking a new
+ * one, but reuses the snapshot buffers. Columns of tables for which the
+ * entities are the same as in the snapshot are only copied if they were
+ * written to since the snapshot was taken or last updated.
+ *
+ * Writes are tracked for operations that mark components as modified, like
+ * ecs_set(), ecs_modified() and queries with [inout] or [out] fields. Writes
+ * through pointers returned by ecs_get_mut() and ecs_ensure() that are not
+ * followed by ecs_modified() are not detected.
+ *
+ * @param world The world.
+ * @param snapshot The snapshot to update.
+ */
+FLECS_API
+void ecs_snapshot_update(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot);
+
+/** Restore snapshot.
+ * This restores the world to the state stored in the snapshot. The snapshot is
+ * not modified, and can be restored multiple times.
+ *
+ * If no entities were created, deleted or moved to other tables since the
+ * snapshot was taken, only columns that were written to are copied back.
+ * Otherwise entities that were created after the snapshot was taken are
+ * deleted, entities that were deleted are recreated and entities that moved
+ * are moved back to the table they were stored in.
+ *
+ * Restoring component values does not invoke OnSet hooks or observers, except
+ * for entities that were moved back to their table. Moving entities between
+ * tables invokes add and remove hooks and observers, as with regular
+ * operations. Prefab children are not instantiated for instances that are
+ * restored.
+ *
+ * This operation may not be called while the world is deferred.
+ *
+ * @param world The world.
+ * @param snapshot The snapshot to restore.
+ */
+FLECS_API
+void ecs_snapshot_restore(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot);
+
+/** Serialize changes to world since snapshot was taken or updated.
+ * This creates a delta that contains the entities that were created and
+ * deleted, the ids that were added to and removed from entities, and the
+ * component values that changed since the snapshot was taken or last updated.
+ * After the delta is created, the snapshot is updated to the current state of
+ * the world, so that calling this function once per frame produces a stream of
+ * deltas that can be used for replication or replay.
+ *
+ * Only columns that were written to are compared with the snapshot, the same
+ * as with ecs_snapshot_update(). Values are stored as the XOR of the old and
+ * new value, in which runs of unchanged bytes are encoded as a single length.
+ * Values of components with lifecycle hooks, except for entity names, are not
+ * stored. Adding such a component will add it without a value.
+ *
+ * Entity ids are stored as they are in the world. Ids of entities that are not
+ * stored in snapshots, like components, are stored as path.
+ *
+ * @param world The world.
+ * @param snapshot The snapshot to compare with, and to update.
+ * @param size_out Output parameter for the size of the returned buffer.
+ * @return The delta, or NULL if failed. Must be freed with ecs_os_free().
+ */
+FLECS_API
+void* ecs_snapshot_delta(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot,
+    ecs_size_t *size_out);
+
+/** Apply delta to world.
+ * This applies a delta created by ecs_snapshot_delta() to a world. The world
+ * must be in the state the world that created the delta was in when its
+ * snapshot was taken or last updated, for example because all previous deltas
+ * were applied to it.
+ *
+ * Entities in the delta keep their ids, which means that the world should not
+ * create its own entities outside of the range of component ids, as they can
+ * conflict with entities in the delta. Components must be registered with the
+ * same path and size as in the world that created the delta. Values are
+ * assigned with OnSet hooks and observers. Prefab children are not
+ * instantiated for instances in the delta, as the delta already contains the
+ * instance children.
+ *
+ * This operation may not be called while the world is deferred.
+ *
+ * @param world The world.
+ * @param data The delta created by ecs_snapshot_delta().
+ * @param size The size of the delta.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_snapshot_apply_delta(
+    ecs_world_t *world,
+    const void *data,
+    ecs_size_t size);
+
+/** Free snapshot.
+ *
+ * @param world The world.
+ * @param snapshot The snapshot to free.
+ */
+FLECS_API
+void ecs_snapshot_free(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/** @} */
+
+#endif
@@ -90,6 +90,7 @@ typedef struct ecs_world_stats_t {
         ecs_metric_t query_count;          /**< Number of queries */
         ecs_metric_t observer_count;       /**< Number of observers */
         ecs_metric_t system_count;         /**< Number of systems */
+        ecs_metric_t async_event_count;    /**< Number of events queued for async observers */
     } queries;
 
     /* Commands */
@@ -219,6 +220,9 @@ typedef struct ecs_pipeline_stats_t {
     int32_t system_count;        /**< Number of systems in pipeline */
     int32_t active_system_count; /**< Number of active systems in pipeline */
     int32_t rebuild_count;       /**< Number of times pipeline has rebuilt */
+    int32_t incremental_rebuild_count; /**< Number of rebuilds that reused part of the previous schedule */
+    int32_t rebuild_system_count; /**< Number of systems checked by last rebuild */
+    double rebuild_time_spent;   /**< Total time spent rebuilding (requires measure_system_time) */
 } ecs_pipeline_stats_t;
 
 /** Get world statistics.
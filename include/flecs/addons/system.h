@@ -86,12 +86,29 @@ typedef struct ecs_system_desc_t {
     /** Rate at which the system should run */
     int32_t rate;
 
+    /** If true and rate is set, the system's rate filter is assigned a phase
+     * offset so that systems with the same rate run on different frames,
+     * instead of all running on the same frame. See ecs_set_rate_staggered(). */
+    bool stagger;
+
+    /** Spread the entities matched by the system across this number of runs.
+     * Each run processes the next 1/time_slices share of the matched entities,
+     * continuing from where the previous run stopped, until all entities have
+     * been processed. The next run then starts from the first entity again.
+     * The iterator passed to the system is a paged iterator. */
+    int32_t time_slices;
+
     /** External tick source that determines when system ticks */
     ecs_entity_t tick_source;
 
     /** If true, system will be ran on multiple threads */
     bool multi_threaded;
 
+    /** If true and the system is multi threaded, matched tables are divided
+     * across threads instead of the entities of each table. Each table is
+     * always processed by the same thread. See ecs_worker_table_iter(). */
+    bool table_affinity;
+
     /** If true, system will have access to the actual world. Cannot be true at the
      * same time as multi_threaded. */
     bool immediate;
@@ -125,6 +142,9 @@ typedef struct ecs_system_t {
     /** Is system multithreaded */
     bool multi_threaded;
 
+    /** Are tables divided across threads (see ecs_system_desc_t) */
+    bool table_affinity;
+
     /** Is system ran in immediate mode */
     bool immediate;
 
@@ -158,6 +178,18 @@ typedef struct ecs_system_t {
     /** Last frame for which the system was considered */
     int64_t last_frame;
 
+    /** See ecs_system_desc_t */
+    int32_t time_slices;
+
+    /** Offset of first entity to process in the next time slice */
+    int32_t time_slice_offset;
+
+    /** Number of matched entities when the current time slice cycle started */
+    int32_t time_slice_total;
+
+    /** Number of stages that finished running the current time slice */
+    int32_t time_slice_done;
+
     /* Mixins */
     ecs_world_t *world;
     ecs_entity_t entity;
@@ -0,0 +1,120 @@
+/**
+ * @file addons/timeline.h
+ * @brief Timeline addon.
+ *
+ * The timeline addon records what each thread does during a frame, such as
+ * which worker ran which system slice, how long threads waited on a sync
+ * point, how long merges took and which observers were invoked. Events are
+ * stored in a ring buffer per stage, and can be exported in the Chrome Trace
+ * Event format, which can be loaded in chrome://tracing or Perfetto.
+ *
+ * Recording is disabled until ecs_timeline_enable() is called. When disabled,
+ * the cost of the addon is a single pointer check per recorded event.
+ */
+
+#ifdef FLECS_TIMELINE
+
+/**
+ * @defgroup c_addons_timeline Timeline
+ * @ingroup c_addons
+ * Record per-thread timelines in Chrome Trace Event format.
+ *
+ * @{
+ */
+
+#ifndef FLECS_TIMELINE_H
+#define FLECS_TIMELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default number of events stored per stage. */
+#define ECS_TIMELINE_DEFAULT_CAPACITY (64 * 1024)
+
+/** Start or stop recording a timeline.
+ * When recording is enabled, each stage stores its most recent events in a
+ * ring buffer with the specified capacity. When the buffer is full, the oldest
+ * events are overwritten. Passing a capacity of 0 stops recording and frees
+ * all recorded events.
+ *
+ * Enabling recording while it is already enabled discards the recorded events.
+ *
+ * This operation must be called from the main thread, outside of
+ * ecs_progress().
+ *
+ * @param world The world.
+ * @param capacity The number of events to store per stage, or 0 to disable.
+ */
+FLECS_API
+void ecs_timeline_enable(
+    ecs_world_t *world,
+    int32_t capacity);
+
+/** Test if timeline recording is enabled.
+ *
+ * @param world The world.
+ * @return Whether the timeline is recording.
+ */
+FLECS_API
+bool ecs_timeline_is_enabled(
+    const ecs_world_t *world);
+
+/** Discard recorded events.
+ * Recording remains enabled. This operation must be called from the main
+ * thread, outside of ecs_progress().
+ *
+ * @param world The world.
+ */
+FLECS_API
+void ecs_timeline_clear(
+    ecs_world_t *world);
+
+/** Serialize recorded events to Chrome Trace Event JSON.
+ * The result is an object with a "traceEvents" member that contains one
+ * complete ("X") event per recorded span. Threads are identified by their
+ * stage id, where 0 is the main thread. Timestamps are in microseconds, and
+ * are relative to when recording was enabled.
+ *
+ * This operation must be called from the main thread, outside of
+ * ecs_progress().
+ *
+ * @param world The world.
+ * @return The JSON string, or NULL if recording is not enabled. Must be freed
+ *         with ecs_os_free().
+ */
+FLECS_API
+char* ecs_timeline_to_json(
+    const ecs_world_t *world);
+
+/** Same as ecs_timeline_to_json(), but serializes to an ecs_strbuf_t instance.
+ *
+ * @param world The world.
+ * @param buf The strbuf to append the string to.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_timeline_to_json_buf(
+    const ecs_world_t *world,
+    ecs_strbuf_t *buf);
+
+/** Write recorded events to a file in Chrome Trace Event JSON format.
+ *
+ * @param world The world.
+ * @param filename The file to write to.
+ * @return Zero if success, non-zero if failed.
+ */
+FLECS_API
+int ecs_timeline_to_file(
+    const ecs_world_t *world,
+    const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/** @} */
+
+#endif
@@ -214,6 +214,29 @@ ecs_entity_t ecs_set_rate(
     int32_t rate,
     ecs_entity_t source);
 
+/** Set rate filter with a phase offset.
+ * Same as ecs_set_rate(), but assigns a phase offset to the rate filter so that
+ * rate filters with the same rate and source tick on different frames. For
+ * example, four systems with a rate of 4 will each tick on a different frame,
+ * instead of all ticking on the same frame.
+ *
+ * The phase is chosen such that it is shared by the fewest existing rate
+ * filters with the same rate and source. Rate filters that are created while
+ * the world is deferred are not taken into account.
+ *
+ * @param world The world.
+ * @param tick_source The rate filter entity (0 to create one).
+ * @param rate The rate to apply.
+ * @param source The tick source (0 to use frames)
+ * @return The filter entity.
+ */
+FLECS_API
+ecs_entity_t ecs_set_rate_staggered(
+    ecs_world_t *world,
+    ecs_entity_t tick_source,
+    int32_t rate,
+    ecs_entity_t source);
+
 /** Assign tick source to system.
  * Systems can be their own tick source, which can be any of the tick sources
  * (one shot timers, interval times and rate filters). However, in some cases it
@@ -21,12 +21,20 @@ extern "C" {
 
 #define ECS_STRBUF_SMALL_STRING_SIZE (512)
 #define ECS_STRBUF_MAX_LIST_DEPTH (32)
+#define ECS_STRBUF_FLUSH_SIZE (64 * 1024)
 
 typedef struct ecs_strbuf_list_elem {
     int32_t count;
     const char *separator;
 } ecs_strbuf_list_elem;
 
+/* Callback that receives buffer content when buffer is flushed.
+ * Returns 0 on success, non-zero if the data could not be written. */
+typedef int (*ecs_strbuf_flush_action_t)(
+    const char *data,
+    ecs_size_t length,
+    void *ctx);
+
 typedef struct ecs_strbuf_t {
     char *content;
     ecs_size_t length;
@@ -35,6 +43,13 @@ typedef struct ecs_strbuf_t {
     ecs_strbuf_list_elem list_stack[ECS_STRBUF_MAX_LIST_DEPTH];
     int32_t list_sp;
 
+    /* When set, the buffer doesn't grow beyond ECS_STRBUF_FLUSH_SIZE but
+     * passes its content to the flush action when full. Remaining content must
+     * be flushed with ecs_strbuf_flush. */
+    ecs_strbuf_flush_action_t flush_action;
+    void *flush_ctx;
+    bool flush_error;
+
     char small_string[ECS_STRBUF_SMALL_STRING_SIZE];
 } ecs_strbuf_t;
 
@@ -115,7 +130,13 @@ FLECS_API
 char* ecs_strbuf_get_small(
     ecs_strbuf_t *buffer);
 
-/* Reset buffer without returning a string */
+/* Pass remaining content to flush action and reset buffer.
+ * Returns 0 if all content was flushed successfully, -1 otherwise. */
+FLECS_API
+int ecs_strbuf_flush(
+    ecs_strbuf_t *buffer);
+
+/* Reset buffer without returning a string. Doesn't reset flush action. */
 FLECS_API
 void ecs_strbuf_reset(
     ecs_strbuf_t *buffer);
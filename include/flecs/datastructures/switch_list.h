@@ -1,6 +1,6 @@
 /**
  * @file switch_list.h
- * @brief Interleaved linked list for storing mutually exclusive values.
+ * @brief Dense element lists for storing mutually exclusive values.
  */
 
 #ifndef FLECS_SWITCH_LIST_H
@@ -12,18 +12,13 @@
 extern "C" {
 #endif
 
-typedef struct ecs_switch_node_t {
-    uint32_t next;      /* Next node in list */
-    uint32_t prev;      /* Prev node in list */
-} ecs_switch_node_t;
-
 typedef struct ecs_switch_page_t {
-    ecs_vec_t nodes;    /* vec<ecs_switch_node_t> */
     ecs_vec_t values;   /* vec<uint64_t> */
+    ecs_vec_t indices;  /* vec<int32_t> index of element in elements of value */
 } ecs_switch_page_t;
 
 typedef struct ecs_switch_t {
-    ecs_map_t hdrs;     /* map<uint64_t, uint32_t> */
+    ecs_map_t hdrs;     /* map<uint64_t, ecs_vec_t*> dense elements per value */
     ecs_vec_t pages;    /* vec<ecs_switch_page_t> */
 } ecs_switch_t;
 
@@ -69,6 +64,15 @@ uint32_t flecs_switch_next(
     const ecs_switch_t *sw,
     uint32_t previous);
 
+/** Get elements for value.
+ * Returns a dense array with all elements that have the value, or NULL if no
+ * element has had the value. The array remains valid until the switch is 
+ * freed, but its contents change when values are set. */
+FLECS_DBG_API
+const ecs_vec_t* flecs_switch_elements(
+    const ecs_switch_t *sw,
+    uint64_t value);
+
 /** Get target iterator. */
 FLECS_DBG_API
 ecs_map_iter_t flecs_switch_targets(
@@ -127,6 +127,23 @@ typedef
 void* (*ecs_os_api_task_join_t)(
     ecs_os_thread_t thread);
 
+/** OS API thread_set_affinity function type.
+ * Restricts the calling thread to the specified CPUs. Returns zero if
+ * successful, non-zero if failed. */
+typedef
+int (*ecs_os_api_thread_set_affinity_t)(
+    const int32_t *cpus,
+    int32_t count);
+
+/** OS API numa_node_cpus function type.
+ * Writes the CPUs of a NUMA node to cpus_out, up to size elements. Returns the
+ * number of CPUs of the node, or -1 if the node does not exist. */
+typedef
+int32_t (*ecs_os_api_numa_node_cpus_t)(
+    int32_t node,
+    int32_t *cpus_out,
+    int32_t size);
+
 /* Atomic increment / decrement */
 /** OS API ainc function type. */
 typedef
@@ -138,6 +155,15 @@ typedef
 int64_t (*ecs_os_api_lainc_t)(
     int64_t *value);
 
+/** OS API acas function type. 
+ * Atomically replaces the pointer stored in ptr with new_value if it is equal
+ * to old_value. Returns true if the value was replaced. */
+typedef
+bool (*ecs_os_api_acas_t)(
+    void **ptr,
+    void *old_value,
+    void *new_value);
+
 /* Mutex */
 /** OS API mutex_new function type. */
 typedef
@@ -235,6 +261,20 @@ typedef
 void (*ecs_os_api_dlclose_t)(
     ecs_os_dl_t lib);
 
+/** OS API file_map function type.
+ * Maps the contents of a file in read-only memory. Returns NULL if the file
+ * could not be mapped. */
+typedef
+void* (*ecs_os_api_file_map_t)(
+    const char *filename,
+    ecs_size_t *size_out);
+
+/** OS API file_unmap function type. */
+typedef
+void (*ecs_os_api_file_unmap_t)(
+    void *ptr,
+    ecs_size_t size);
+
 /** OS API module_to_path function type. */
 typedef
 char* (*ecs_os_api_module_to_path_t)(
@@ -273,11 +313,16 @@ typedef struct ecs_os_api_t {
     ecs_os_api_thread_new_t task_new_;             /**< task_new callback. */
     ecs_os_api_thread_join_t task_join_;           /**< task_join callback. */
 
+    /* Thread affinity */
+    ecs_os_api_thread_set_affinity_t thread_set_affinity_; /**< thread_set_affinity callback. */
+    ecs_os_api_numa_node_cpus_t numa_node_cpus_;   /**< numa_node_cpus callback. */
+
     /* Atomic increment / decrement */
     ecs_os_api_ainc_t ainc_;                       /**< ainc callback. */
     ecs_os_api_ainc_t adec_;                       /**< adec callback. */
     ecs_os_api_lainc_t lainc_;                     /**< lainc callback. */
     ecs_os_api_lainc_t ladec_;                     /**< ladec callback. */
+    ecs_os_api_acas_t acas_;                       /**< acas callback. */
 
     /* Mutex */
     ecs_os_api_mutex_new_t mutex_new_;             /**< mutex_new callback. */
@@ -314,6 +359,10 @@ typedef struct ecs_os_api_t {
     ecs_os_api_dlproc_t dlproc_;                   /**< dlproc callback. */
     ecs_os_api_dlclose_t dlclose_;                 /**< dlclose callback. */
 
+    /* Memory mapped files */
+    ecs_os_api_file_map_t file_map_;               /**< file_map callback. */
+    ecs_os_api_file_unmap_t file_unmap_;           /**< file_unmap callback. */
+
     /* Overridable function that translates from a logical module id to a
      * shared library filename */
     ecs_os_api_module_to_path_t module_to_dl_;     /**< module_to_dl callback. */
@@ -493,11 +542,16 @@ void ecs_os_set_api_defaults(void);
 #define ecs_os_task_new(callback, param) ecs_os_api.task_new_(callback, param)
 #define ecs_os_task_join(thread) ecs_os_api.task_join_(thread)
 
+/* Thread affinity */
+#define ecs_os_thread_set_affinity(cpus, count) ecs_os_api.thread_set_affinity_(cpus, count)
+#define ecs_os_numa_node_cpus(node, cpus_out, size) ecs_os_api.numa_node_cpus_(node, cpus_out, size)
+
 /* Atomic increment / decrement */
 #define ecs_os_ainc(value) ecs_os_api.ainc_(value)
 #define ecs_os_adec(value) ecs_os_api.adec_(value)
 #define ecs_os_lainc(value) ecs_os_api.lainc_(value)
 #define ecs_os_ladec(value) ecs_os_api.ladec_(value)
+#define ecs_os_acas(ptr, old_value, new_value) ecs_os_api.acas_(ptr, old_value, new_value)
 
 /* Mutex */
 #define ecs_os_mutex_new() ecs_os_api.mutex_new_()
@@ -555,6 +609,10 @@ void ecs_os_set_api_defaults(void);
 #define ecs_os_dlproc(lib, procname) ecs_os_api.dlproc_(lib, procname)
 #define ecs_os_dlclose(lib) ecs_os_api.dlclose_(lib)
 
+/* Memory mapped files */
+#define ecs_os_file_map(filename, size_out) ecs_os_api.file_map_(filename, size_out)
+#define ecs_os_file_unmap(ptr, size) ecs_os_api.file_unmap_(ptr, size)
+
 /* Module id translation */
 #define ecs_os_module_to_dl(lib) ecs_os_api.module_to_dl_(lib)
 #define ecs_os_module_to_etc(lib) ecs_os_api.module_to_etc_(lib)
@@ -735,6 +793,10 @@ bool ecs_os_has_threading(void);
 FLECS_API
 bool ecs_os_has_task_support(void);
 
+/** Are thread affinity functions available? */
+FLECS_API
+bool ecs_os_has_thread_affinity(void);
+
 /** Are time functions available? */
 FLECS_API
 bool ecs_os_has_time(void);
@@ -747,6 +809,10 @@ bool ecs_os_has_logging(void);
 FLECS_API
 bool ecs_os_has_dl(void);
 
+/** Are memory mapped file functions available? */
+FLECS_API
+bool ecs_os_has_file_map(void);
+
 /** Are module path functions available? */
 FLECS_API
 bool ecs_os_has_modules(void);
@@ -57,6 +57,15 @@
 #ifdef FLECS_NO_REST
 #undef FLECS_REST
 #endif
+#ifdef FLECS_NO_TIMELINE
+#undef FLECS_TIMELINE
+#endif
+#ifdef FLECS_NO_BINARY
+#undef FLECS_BINARY
+#endif
+#ifdef FLECS_NO_SNAPSHOT
+#undef FLECS_SNAPSHOT
+#endif
 #ifdef FLECS_NO_JOURNAL
 #undef FLECS_JOURNAL
 #endif
@@ -144,6 +153,27 @@
 #include "../addons/alerts.h"
 #endif
 
+#ifdef FLECS_TIMELINE
+#ifdef FLECS_NO_TIMELINE
+#error "FLECS_NO_TIMELINE failed: TIMELINE is required by other addons"
+#endif
+#include "../addons/timeline.h"
+#endif
+
+#ifdef FLECS_BINARY
+#ifdef FLECS_NO_BINARY
+#error "FLECS_NO_BINARY failed: BINARY is required by other addons"
+#endif
+#include "../addons/binary.h"
+#endif
+
+#ifdef FLECS_SNAPSHOT
+#ifdef FLECS_NO_SNAPSHOT
+#error "FLECS_NO_SNAPSHOT failed: SNAPSHOT is required by other addons"
+#endif
+#include "../addons/snapshot.h"
+#endif
+
 #ifdef FLECS_JSON
 #ifdef FLECS_NO_JSON
 #error "FLECS_NO_JSON failed: JSON is required by other addons"
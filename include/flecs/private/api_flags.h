@@ -23,6 +23,7 @@ extern "C" {
 #define EcsWorldMeasureFrameTime      (1u << 5)
 #define EcsWorldMeasureSystemTime     (1u << 6)
 #define EcsWorldMultiThreaded         (1u << 7)
+#define EcsWorldNoAsyncFlush          (1u << 8)
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -84,6 +85,7 @@ extern "C" {
 #define EcsIdHasOnTableDelete          (1u << 22)
 #define EcsIdIsSparse                  (1u << 23)
 #define EcsIdIsUnion                   (1u << 24)
+#define EcsIdOrderedChildren           (1u << 25)
 #define EcsIdEventMask\
     (EcsIdHasOnAdd|EcsIdHasOnRemove|EcsIdHasOnSet|\
         EcsIdHasOnTableFill|EcsIdHasOnTableEmpty|EcsIdHasOnTableCreate|\
@@ -127,6 +129,7 @@ extern "C" {
 
 /* Same as event flags */
 #define EcsIterTableOnly               (1u << 20u)  /* Result only populates table */
+#define EcsIterSuperseded              (1u << 21u)  /* Followed by event for same entity and id */
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -134,6 +137,7 @@ extern "C" {
 ////////////////////////////////////////////////////////////////////////////////
 
 #define EcsEventTableOnly              (1u << 20u) /* Table event (no data, same as iter flags) */
+#define EcsEventSuperseded             (1u << 21u) /* Followed by event for same entity and id (same as iter flags) */
 #define EcsEventNoOnSet                (1u << 16u) /* Don't emit OnSet for inherited ids */
 
 
@@ -189,6 +193,8 @@ extern "C" {
 #define EcsObserverIsDisabled          (1u << 3u)  /* Is observer entity disabled */
 #define EcsObserverIsParentDisabled    (1u << 4u)  /* Is module parent of observer disabled  */
 #define EcsObserverBypassQuery         (1u << 5u)
+#define EcsObserverAsync               (1u << 6u)  /* Are events queued and ran after merge */
+#define EcsObserverCoalesce            (1u << 7u)  /* Skip superseded OnSet events */
 
 ////////////////////////////////////////////////////////////////////////////////
 //// Table flags (used by ecs_table_t::flags)
@@ -219,8 +225,10 @@ extern "C" {
 #define EcsTableHasOnTableDelete       (1u << 22u)
 #define EcsTableHasSparse              (1u << 23u)
 #define EcsTableHasUnion               (1u << 24u)
+#define EcsTableHasOrderedParent       (1u << 25u) /* Does the table store children of a parent with OrderedChildren */
 
 #define EcsTableHasTraversable         (1u << 26u)
+#define EcsTableHasOrderedChildren     (1u << 27u) /* Does the table have the OrderedChildren trait */
 #define EcsTableMarkedForDelete        (1u << 30u)
 
 /* Composite table flags */
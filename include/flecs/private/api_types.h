@@ -72,6 +72,9 @@ struct ecs_ref_t {
     uint64_t table_id;      /* Table id for detecting ABA issues */
     struct ecs_table_record_t *tr; /* Table record for component */
     ecs_record_t *record;   /* Entity index record */
+    void *ptr;              /* Cached component pointer */
+    uint32_t table_version; /* Table storage version of cached pointer */
+    int32_t row;            /* Entity row of cached pointer */
 };
 
 
@@ -86,6 +89,7 @@ typedef struct ecs_page_iter_t {
 typedef struct ecs_worker_iter_t {
     int32_t index;
     int32_t count;
+    bool tables;                   /* Assign whole tables to workers */
 } ecs_worker_iter_t;
 
 /* Convenience struct to iterate table array for id */
@@ -104,6 +108,7 @@ typedef struct ecs_each_iter_t {
     ecs_size_t sizes;
     int32_t columns;
     const ecs_table_record_t* trs;
+    const ecs_vec_t *ordered; /* Ordered children, if parent has OrderedChildren */
 } ecs_each_iter_t;
 
 typedef struct ecs_query_op_profile_t {
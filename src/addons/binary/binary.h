@@ -0,0 +1,145 @@
+/**
+ * @file addons/binary/binary.h
+ * @brief Binary world serializer, private types and functions.
+ */
+
+#ifndef FLECS_BINARY_PRIVATE_H
+#define FLECS_BINARY_PRIVATE_H
+
+#include "../../private_api.h"
+
+#ifdef FLECS_BINARY
+
+/* A snapshot has the following layout:
+ *
+ *   header
+ *   table *  header.table_count
+ *   name  *  header.name_count      (starts at header.names_offset)
+ *
+ * A table is stored as:
+ *
+ *   table header
+ *   uint64_t ids[type_count]        (table type)
+ *   uint64_t entities[entity_count]
+ *   field * field_count             (component data)
+ *
+ * Entity ids are stored as they were in the serialized world. The name list
+ * contains the name and parent of each named entity that appears in the
+ * snapshot, which is used to map them to entities in the world that loads the
+ * snapshot. All elements are padded to 8 bytes. Integers are stored in native
+ * byte order. */
+
+#define FLECS_BINARY_MAGIC "FLBS"
+#define FLECS_BINARY_VERSION (1)
+#define FLECS_BINARY_BYTE_ORDER (0x01020304u)
+#define FLECS_BINARY_ALIGN (8)
+
+/* Encoding of field data */
+typedef enum ecs_binary_field_kind_t {
+    EcsBinaryRaw = 1,            /* Contiguous array of raw component values */
+    EcsBinaryOps,                /* Values encoded with the type serializer */
+    EcsBinaryIdentifier,         /* String per row for (Identifier, *) pairs */
+    EcsBinaryUnion               /* Target per row for (Relationship, Union) */
+} ecs_binary_field_kind_t;
+
+/* Name entry flags */
+#define EcsBinaryNameIsRow (1u << 0) /* Entity is stored in one of the tables */
+
+typedef struct ecs_binary_header_t {
+    char magic[4];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t table_count;
+    uint32_t name_count;
+    uint32_t names_offset;
+} ecs_binary_header_t;
+
+typedef struct ecs_binary_table_t {
+    uint32_t type_count;
+    uint32_t entity_count;
+    uint32_t field_count;
+    uint32_t reserved;
+} ecs_binary_table_t;
+
+typedef struct ecs_binary_field_t {
+    uint32_t index;              /* Index of id in table type */
+    uint32_t kind;               /* ecs_binary_field_kind_t */
+    uint32_t size;               /* Size of component */
+    uint32_t data_size;          /* Size of data, excluding padding */
+    uint64_t hash;               /* Layout hash of type, 0 if not known */
+} ecs_binary_field_t;
+
+/* Name entry, followed by the name including the terminator */
+typedef struct ecs_binary_name_t {
+    uint64_t entity;
+    uint64_t parent;             /* Parent, 0 if entity is in root */
+    uint32_t flags;
+    uint32_t length;             /* Length of name, excluding terminator */
+} ecs_binary_name_t;
+
+/* An iterator result stream has the following layout:
+ *
+ *   iter header
+ *   field * header.field_count      (field descriptors)
+ *   result *                        (last result has EcsBinaryResultEnd)
+ *
+ * A field descriptor is followed by the field id as string. A result is
+ * stored as:
+ *
+ *   result header
+ *   uint64_t entities[count]
+ *   column * popcount(set_fields)   (one column per set field, in order)
+ *
+ * A column contains an array of count values if the field is matched on the
+ * $this entity, or a single value if the field has a different source. Values
+ * use the same encoding as table fields. */
+
+#define FLECS_BINARY_ITER_MAGIC "FLQR"
+
+/* Result flags */
+#define EcsBinaryResultEnd (1u << 0) /* Last entry in stream, has no data */
+
+typedef struct ecs_binary_iter_header_t {
+    char magic[4];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t field_count;
+} ecs_binary_iter_header_t;
+
+/* Field descriptor, followed by the id string including the terminator */
+typedef struct ecs_binary_iter_field_t {
+    uint64_t id;                 /* Field id, may be a wildcard */
+    uint32_t length;             /* Length of id string, excluding terminator */
+    uint32_t reserved;
+} ecs_binary_iter_field_t;
+
+typedef struct ecs_binary_result_t {
+    uint32_t flags;
+    uint32_t count;              /* Number of entities in result */
+    uint32_t set_fields;         /* Bitset with fields that have a column */
+    uint32_t reserved;
+} ecs_binary_result_t;
+
+typedef struct ecs_binary_column_t {
+    uint64_t id;                 /* Matched id */
+    uint64_t src;                /* Source, 0 if field is matched on $this */
+    uint32_t kind;               /* ecs_binary_field_kind_t, 0 if no data */
+    uint32_t size;               /* Size of component */
+    uint32_t data_size;          /* Size of data, excluding padding */
+    uint32_t reserved;
+} ecs_binary_column_t;
+
+/* Compute hash of type layout. Returns 0 if type has no reflection data. */
+uint64_t flecs_binary_type_hash(
+    const ecs_world_t *world,
+    ecs_entity_t type);
+
+/* Test if values of type must be serialized with the type serializer, because
+ * they own resources or contain entity ids. */
+bool flecs_binary_type_needs_ops(
+    const ecs_world_t *world,
+    const ecs_type_info_t *ti);
+
+#endif
+
+#endif
@@ -0,0 +1,1231 @@
+/**
+ * @file addons/binary/deserialize.c
+ * @brief Load world from binary format.
+ */
+
+#include "binary.h"
+#include "../meta/meta.h"
+
+#ifdef FLECS_BINARY
+
+typedef struct ecs_binary_reader_t {
+    const uint8_t *base;
+    const uint8_t *ptr;
+    const uint8_t *end;
+} ecs_binary_reader_t;
+
+typedef struct ecs_binary_deser_t {
+    ecs_world_t *world;
+    ecs_map_t ids;               /* Serialized entity index -> entity */
+    ecs_map_t names;             /* Serialized entity index -> name entry */
+    ecs_map_t resolving;         /* Name entries that are being resolved */
+    ecs_vec_t entities;          /* vector<ecs_entity_t>, reused per table */
+    ecs_vec_t rows;              /* vector<int32_t>, reused per table */
+    ecs_vec_t unions;            /* vector<ecs_entity_t>, reused per table */
+} ecs_binary_deser_t;
+
+/* Row that's not created in bulk, because the entity already had components */
+#define FLECS_BINARY_ROW_EXISTS (-1)
+
+static
+int flecs_binary_deser_ops(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    ecs_meta_type_op_t *ops,
+    int32_t op_count,
+    void *base,
+    int32_t in_array);
+
+static
+const void* flecs_binary_read(
+    ecs_binary_reader_t *r,
+    ecs_size_t size)
+{
+    if (size < 0 || (r->end - r->ptr) < size) {
+        ecs_err("binary data is truncated");
+        return NULL;
+    }
+
+    const void *result = r->ptr;
+    r->ptr += size;
+    return result;
+}
+
+#define flecs_binary_read_t(r, T, dst)\
+    flecs_binary_read_value(r, dst, ECS_SIZEOF(T))
+
+static
+int flecs_binary_read_value(
+    ecs_binary_reader_t *r,
+    void *dst,
+    ecs_size_t size)
+{
+    const void *src = flecs_binary_read(r, size);
+    if (!src) {
+        return -1;
+    }
+    ecs_os_memcpy(dst, src, size);
+    return 0;
+}
+
+static
+int flecs_binary_read_pad(
+    ecs_binary_reader_t *r)
+{
+    int32_t offset = flecs_uto(int32_t, r->ptr - r->base);
+    int32_t pad = (FLECS_BINARY_ALIGN - (offset & (FLECS_BINARY_ALIGN - 1))) &
+        (FLECS_BINARY_ALIGN - 1);
+    return flecs_binary_read(r, pad) ? 0 : -1;
+}
+
+/* Read string that was stored with its terminator. Returns NULL for strings
+ * that were NULL when serialized, sets error if data is invalid. */
+static
+const char* flecs_binary_read_str(
+    ecs_binary_reader_t *r,
+    bool *err)
+{
+    uint32_t len;
+    if (flecs_binary_read_t(r, uint32_t, &len)) {
+        *err = true;
+        return NULL;
+    }
+
+    if (!len) {
+        return NULL;
+    }
+
+    const char *str = flecs_binary_read(r, flecs_uto(ecs_size_t, len));
+    if (!str || str[len - 1]) {
+        ecs_err("invalid string in binary data");
+        *err = true;
+        return NULL;
+    }
+
+    return str;
+}
+
+static
+ecs_entity_t flecs_binary_new_id(
+    ecs_world_t *world,
+    ecs_entity_t ser_id)
+{
+    /* Use the serialized id if it's not in use */
+    if (!ecs_exists(world, ser_id)) {
+        ecs_make_alive(world, ser_id);
+        return ser_id;
+    }
+
+    /* Try to honor low id requirements */
+    if ((uint32_t)ser_id < FLECS_HI_COMPONENT_ID) {
+        return ecs_new_low_id(world);
+    } else {
+        return ecs_new(world);
+    }
+}
+
+/* Map serialized entity to entity in world. Entities stored in tables and
+ * named entities are resolved before tables are loaded. Other entities are
+ * anonymous entities that are referenced, but not stored in the snapshot. */
+static
+ecs_entity_t flecs_binary_map_entity(
+    ecs_binary_deser_t *deser,
+    ecs_entity_t ser_id)
+{
+    if (!ser_id) {
+        return 0;
+    }
+
+    ecs_map_val_t *ptr = ecs_map_get(&deser->ids, (uint32_t)ser_id);
+    if (ptr) {
+        return ptr[0];
+    }
+
+    ecs_world_t *world = deser->world;
+    ecs_entity_t result;
+    if (ecs_is_alive(world, ser_id)) {
+        result = ser_id;
+    } else if (!ecs_exists(world, ser_id)) {
+        ecs_make_alive(world, ser_id);
+        result = ser_id;
+    } else if (!(ser_id >> 32) && (result = ecs_get_alive(world, ser_id))) {
+        /* Relationship targets are stored without generation */
+    } else {
+        result = flecs_binary_new_id(world, ser_id);
+    }
+
+    ecs_map_insert(&deser->ids, (uint32_t)ser_id, result);
+    return result;
+}
+
+static
+ecs_id_t flecs_binary_map_id(
+    ecs_binary_deser_t *deser,
+    ecs_id_t ser_id)
+{
+    if (ECS_IS_PAIR(ser_id)) {
+        ecs_entity_t first = flecs_binary_map_entity(
+            deser, ECS_PAIR_FIRST(ser_id));
+        ecs_entity_t second = flecs_binary_map_entity(
+            deser, ECS_PAIR_SECOND(ser_id));
+        return ecs_pair(first, second) | (ser_id & ECS_ID_FLAGS_MASK);
+    } else {
+        return flecs_binary_map_entity(deser, ser_id & ECS_COMPONENT_MASK) |
+            (ser_id & ECS_ID_FLAGS_MASK);
+    }
+}
+
+/* Resolve entity for name entry. Returns 0 if the parents of the entry form a
+ * cycle, which can only happen if the data is invalid. */
+static
+ecs_entity_t flecs_binary_resolve_name(
+    ecs_binary_deser_t *deser,
+    const ecs_binary_name_t *entry)
+{
+    ecs_map_val_t *ptr = ecs_map_get(&deser->ids, (uint32_t)entry->entity);
+    if (ptr) {
+        return ptr[0];
+    }
+
+    ecs_world_t *world = deser->world;
+    ecs_entity_t parent = 0;
+    if (entry->parent) {
+        const ecs_binary_name_t *parent_entry = ecs_map_get_deref(
+            &deser->names, ecs_binary_name_t, (uint32_t)entry->parent);
+        if (parent_entry) {
+            ecs_map_val_t *resolving = ecs_map_ensure(
+                &deser->resolving, (uint32_t)entry->entity);
+            if (resolving[0]) {
+                ecs_err("invalid name in binary data: parent cycle");
+                return 0;
+            }
+
+            resolving[0] = 1;
+            parent = flecs_binary_resolve_name(deser, parent_entry);
+            ecs_map_remove(&deser->resolving, (uint32_t)entry->entity);
+            if (!parent) {
+                return 0;
+            }
+        } else {
+            parent = flecs_binary_map_entity(deser, entry->parent);
+        }
+    }
+
+    const char *name = ECS_OFFSET(entry, ECS_SIZEOF(ecs_binary_name_t));
+    ecs_entity_t result = ecs_lookup_child(world, parent, name);
+    if (!result) {
+        result = flecs_binary_new_id(world, entry->entity);
+
+        /* Entities that are stored in a table get their name when the table
+         * is loaded. Create other entities here, so they can be found by name
+         * when the snapshot is loaded again. */
+        if (!(entry->flags & EcsBinaryNameIsRow)) {
+            if (parent) {
+                ecs_add_pair(world, result, EcsChildOf, parent);
+            }
+            ecs_set_name(world, result, name);
+        }
+    }
+
+    ecs_map_insert(&deser->ids, (uint32_t)entry->entity, result);
+    return result;
+}
+
+static
+int flecs_binary_read_names(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    int32_t count)
+{
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        /* Entries are 8 byte aligned relative to the start of the data */
+        const ecs_binary_name_t *entry = flecs_binary_read(
+            r, ECS_SIZEOF(ecs_binary_name_t));
+        if (!entry) {
+            return -1;
+        }
+
+        const char *name = flecs_binary_read(
+            r, flecs_uto(ecs_size_t, entry->length + 1));
+        if (!name || name[entry->length] || flecs_binary_read_pad(r)) {
+            ecs_err("invalid name in binary data");
+            return -1;
+        }
+
+        ecs_map_insert_ptr(&deser->names, (uint32_t)entry->entity, entry);
+    }
+
+    return 0;
+}
+
+/* Skip over field data of table */
+static
+int flecs_binary_skip_fields(
+    ecs_binary_reader_t *r,
+    uint32_t count)
+{
+    uint32_t i;
+    for (i = 0; i < count; i ++) {
+        ecs_binary_field_t field;
+        if (flecs_binary_read_t(r, ecs_binary_field_t, &field)) {
+            return -1;
+        }
+        if (!flecs_binary_read(r, flecs_uto(ecs_size_t, field.data_size))) {
+            return -1;
+        }
+        if (flecs_binary_read_pad(r)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Resolve anonymous entities that are stored in tables. This happens before
+ * named entities are resolved, so that a named entity that is not found can't
+ * take the id of an entity in the snapshot. */
+static
+int flecs_binary_resolve_rows(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    uint32_t table_count)
+{
+    ecs_world_t *world = deser->world;
+    uint32_t t;
+    for (t = 0; t < table_count; t ++) {
+        ecs_binary_table_t hdr;
+        if (flecs_binary_read_t(r, ecs_binary_table_t, &hdr)) {
+            return -1;
+        }
+
+        if (!flecs_binary_read(r,
+            flecs_uto(ecs_size_t, hdr.type_count) * ECS_SIZEOF(ecs_id_t)))
+        {
+            return -1;
+        }
+
+        const uint8_t *entities = flecs_binary_read(r,
+            flecs_uto(ecs_size_t, hdr.entity_count) * ECS_SIZEOF(ecs_entity_t));
+        if (!entities) {
+            return -1;
+        }
+
+        uint32_t i;
+        for (i = 0; i < hdr.entity_count; i ++) {
+            ecs_entity_t e;
+            ecs_os_memcpy_t(&e, &entities[i * sizeof(ecs_entity_t)],
+                ecs_entity_t);
+            if (ecs_map_get(&deser->names, (uint32_t)e)) {
+                continue;
+            }
+
+            if (!ecs_exists(world, e)) {
+                ecs_make_alive(world, e);
+            } else if (!ecs_is_alive(world, e) || ecs_get_name(world, e)) {
+                /* Id was recycled or is used by a named entity */
+                ecs_map_insert(&deser->ids, (uint32_t)e,
+                    flecs_binary_new_id(world, e));
+            }
+        }
+
+        if (flecs_binary_skip_fields(r, hdr.field_count)) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static
+int flecs_binary_deser_elements(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    ecs_entity_t type,
+    void *base,
+    int32_t count)
+{
+    ecs_world_t *world = deser->world;
+    const EcsTypeSerializer *ts = ecs_get(world, type, EcsTypeSerializer);
+    ecs_assert(ts != NULL, ECS_INTERNAL_ERROR, NULL);
+    const EcsComponent *comp = ecs_get(world, type, EcsComponent);
+    ecs_assert(comp != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_meta_type_op_t *ops = ecs_vec_first_t(&ts->ops, ecs_meta_type_op_t);
+    int32_t i, op_count = ecs_vec_count(&ts->ops);
+    for (i = 0; i < count; i ++) {
+        if (flecs_binary_deser_ops(deser, r, ops, op_count,
+            ECS_ELEM(base, comp->size, i), 1))
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* Smallest number of bytes a value of a type can take up in the data */
+static
+ecs_size_t flecs_binary_min_size(
+    const ecs_world_t *world,
+    ecs_entity_t type)
+{
+    const EcsTypeSerializer *ts = ecs_get(world, type, EcsTypeSerializer);
+    ecs_assert(ts != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_meta_type_op_t *ops = ecs_vec_first_t(&ts->ops, ecs_meta_type_op_t);
+    int32_t i, count = ecs_vec_count(&ts->ops);
+    ecs_size_t result = 0;
+    for (i = 0; i < count; i ++) {
+        ecs_meta_type_op_t *op = &ops[i];
+        switch(op->kind) {
+        case EcsOpString:
+        case EcsOpVector:
+            result += ECS_SIZEOF(uint32_t);
+            break;
+        case EcsOpEntity:
+        case EcsOpId:
+            result += ECS_SIZEOF(ecs_id_t);
+            break;
+        case EcsOpEnum:
+        case EcsOpBitmask:
+        case EcsOpBool:
+        case EcsOpChar:
+        case EcsOpByte:
+        case EcsOpU8:
+        case EcsOpU16:
+        case EcsOpU32:
+        case EcsOpU64:
+        case EcsOpI8:
+        case EcsOpI16:
+        case EcsOpI32:
+        case EcsOpI64:
+        case EcsOpF32:
+        case EcsOpF64:
+        case EcsOpUPtr:
+        case EcsOpIPtr:
+            result += op->size;
+            break;
+        case EcsOpArray:
+        case EcsOpOpaque:
+        case EcsOpPush:
+        case EcsOpPop:
+        case EcsOpScope:
+        case EcsOpPrimitive:
+        default:
+            break;
+        }
+    }
+
+    return result;
+}
+
+static
+int flecs_binary_deser_vector(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    ecs_meta_type_op_t *op,
+    ecs_vec_t *vec)
+{
+    ecs_world_t *world = deser->world;
+    const EcsVector *v = ecs_get(world, op->type, EcsVector);
+    ecs_assert(v != NULL, ECS_INTERNAL_ERROR, NULL);
+    const EcsComponent *comp = ecs_get(world, v->type, EcsComponent);
+    ecs_assert(comp != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    uint32_t ucount;
+    if (flecs_binary_read_t(r, uint32_t, &ucount)) {
+        return -1;
+    }
+
+    ecs_size_t size = comp->size;
+    if (ucount > (uint32_t)(INT32_MAX / size)) {
+        ecs_err("binary data is truncated");
+        return -1;
+    }
+
+    /* Check that the data can contain the elements before resizing, so that a
+     * truncated buffer doesn't cause a large allocation. Elements don't have a
+     * fixed size in the data, so this uses the smallest possible size. */
+    int32_t count = flecs_uto(int32_t, ucount);
+    ecs_size_t min_size = flecs_binary_min_size(world, v->type);
+    ecs_binary_reader_t elems_r = *r;
+    if (!flecs_binary_read(&elems_r, min_size * count)) {
+        return -1;
+    }
+
+    const ecs_type_info_t *ti = ecs_get_type_info(world, v->type);
+    ecs_assert(ti != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    int32_t prev_count = vec->count;
+    if (count < prev_count) {
+        if (ti->hooks.dtor) {
+            ti->hooks.dtor(ECS_ELEM(vec->array, size, count),
+                prev_count - count, ti);
+        }
+    }
+
+    ecs_vec_set_count(NULL, vec, size, count);
+
+    if (count > prev_count) {
+        void *elems = ECS_ELEM(vec->array, size, prev_count);
+        if (ti->hooks.ctor) {
+            ti->hooks.ctor(elems, count - prev_count, ti);
+        } else {
+            ecs_os_memset(elems, 0, size * (count - prev_count));
+        }
+    }
+
+    return flecs_binary_deser_elements(deser, r, v->type, vec->array, count);
+}
+
+static
+int flecs_binary_deser_opaque(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    ecs_meta_type_op_t *op,
+    void *ptr)
+{
+    const EcsOpaque *ct = ecs_get(deser->world, op->type, EcsOpaque);
+    ecs_assert(ct != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_size_t elem_size;
+    int32_t count;
+    if (flecs_meta_opaque_span_type(deser->world, ct, &elem_size, &count)) {
+        bool is_vector = !count;
+        if (is_vector) {
+            uint32_t ucount;
+            if (flecs_binary_read_t(r, uint32_t, &ucount)) {
+                return -1;
+            }
+            if (ucount > (uint32_t)(INT32_MAX / elem_size)) {
+                ecs_err("binary data is truncated");
+                return -1;
+            }
+            count = flecs_uto(int32_t, ucount);
+        }
+
+        /* Read elements before resizing so that a truncated buffer doesn't
+         * cause a large allocation */
+        const void *src = flecs_binary_read(r, elem_size * count);
+        if (!src) {
+            return -1;
+        }
+
+        if (is_vector) {
+            if (!ct->resize) {
+                char *path = ecs_get_path(deser->world, op->type);
+                ecs_err("cannot deserialize opaque type '%s': missing resize",
+                    path);
+                ecs_os_free(path);
+                return -1;
+            }
+            ct->resize(ptr, flecs_ito(size_t, count));
+        }
+
+        if (count) {
+            ecs_os_memcpy(ct->data(ptr), src, elem_size * count);
+        }
+        return 0;
+    }
+
+    bool err = false;
+    const char *json = flecs_binary_read_str(r, &err);
+    if (err || !json) {
+        return -1;
+    }
+#ifdef FLECS_JSON
+    if (!ecs_ptr_from_json(deser->world, op->type, ptr, json, NULL)) {
+        return -1;
+    }
+    return 0;
+#else
+    (void)ptr;
+    char *path = ecs_get_path(deser->world, op->type);
+    ecs_err("cannot deserialize opaque type '%s': JSON addon is required",
+        path);
+    ecs_os_free(path);
+    return -1;
+#endif
+}
+
+static
+int flecs_binary_deser_op(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    ecs_meta_type_op_t *op,
+    void *base)
+{
+    void *ptr = ECS_OFFSET(base, op->offset);
+
+    switch(op->kind) {
+    case EcsOpString: {
+        bool err = false;
+        const char *str = flecs_binary_read_str(r, &err);
+        if (err) {
+            return -1;
+        }
+        ecs_os_strset(ptr, str);
+        break;
+    }
+    case EcsOpEntity: {
+        ecs_entity_t e;
+        if (flecs_binary_read_t(r, ecs_entity_t, &e)) {
+            return -1;
+        }
+        *(ecs_entity_t*)ptr = flecs_binary_map_entity(deser, e);
+        break;
+    }
+    case EcsOpId: {
+        ecs_id_t id;
+        if (flecs_binary_read_t(r, ecs_id_t, &id)) {
+            return -1;
+        }
+        *(ecs_id_t*)ptr = id ? flecs_binary_map_id(deser, id) : 0;
+        break;
+    }
+    case EcsOpArray: {
+        const EcsArray *a = ecs_get(deser->world, op->type, EcsArray);
+        ecs_assert(a != NULL, ECS_INTERNAL_ERROR, NULL);
+        return flecs_binary_deser_elements(deser, r, a->type, ptr, a->count);
+    }
+    case EcsOpVector:
+        return flecs_binary_deser_vector(deser, r, op, ptr);
+    case EcsOpOpaque:
+        return flecs_binary_deser_opaque(deser, r, op, ptr);
+    case EcsOpEnum:
+    case EcsOpBitmask:
+    case EcsOpBool:
+    case EcsOpChar:
+    case EcsOpByte:
+    case EcsOpU8:
+    case EcsOpU16:
+    case EcsOpU32:
+    case EcsOpU64:
+    case EcsOpI8:
+    case EcsOpI16:
+    case EcsOpI32:
+    case EcsOpI64:
+    case EcsOpF32:
+    case EcsOpF64:
+    case EcsOpUPtr:
+    case EcsOpIPtr:
+        return flecs_binary_read_value(r, ptr, op->size);
+    case EcsOpPush:
+    case EcsOpPop:
+    case EcsOpScope:
+    case EcsOpPrimitive:
+    default:
+        ecs_throw(ECS_INTERNAL_ERROR, NULL);
+    }
+
+    return 0;
+error:
+    return -1;
+}
+
+/* Walks type ops in the same order as flecs_binary_ser_ops */
+static
+int flecs_binary_deser_ops(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    ecs_meta_type_op_t *ops,
+    int32_t op_count,
+    void *base,
+    int32_t in_array)
+{
+    int32_t i, j;
+    for (i = 0; i < op_count; i ++) {
+        ecs_meta_type_op_t *op = &ops[i];
+
+        if (in_array <= 0 && op->count > 1) {
+            for (j = 0; j < op->count; j ++) {
+                if (flecs_binary_deser_ops(deser, r, op, op->op_count,
+                    ECS_OFFSET(base, j * op->size), 1))
+                {
+                    return -1;
+                }
+            }
+
+            i += op->op_count - 1;
+            continue;
+        }
+
+        if (op->kind == EcsOpPush) {
+            in_array --;
+        } else if (op->kind == EcsOpPop) {
+            in_array ++;
+        } else if (flecs_binary_deser_op(deser, r, op, base)) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* Check if stored field can be loaded into component of world */
+static
+int flecs_binary_validate_field(
+    ecs_world_t *world,
+    const ecs_binary_field_t *field,
+    ecs_id_t id,
+    const ecs_id_record_t *idr)
+{
+    const ecs_type_info_t *ti = idr ? idr->type_info : NULL;
+
+    switch(field->kind) {
+    case EcsBinaryRaw:
+    case EcsBinaryOps:
+        if (!ti) {
+            break;
+        }
+        if (ti->size != flecs_uto(ecs_size_t, field->size)) {
+            break;
+        }
+        if (field->kind == EcsBinaryRaw) {
+            if (flecs_binary_type_needs_ops(world, ti)) {
+                break;
+            }
+            uint64_t hash = flecs_binary_type_hash(world, ti->component);
+            if (hash && field->hash && hash != field->hash) {
+                break;
+            }
+        } else {
+            if (flecs_binary_type_hash(world, ti->component) != field->hash) {
+                break;
+            }
+        }
+        return 0;
+    case EcsBinaryIdentifier:
+        if (ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == ecs_id(EcsIdentifier)) {
+            return 0;
+        }
+        break;
+    case EcsBinaryUnion:
+        if (idr && (idr->flags & EcsIdIsUnion)) {
+            return 0;
+        }
+        break;
+    default:
+        break;
+    }
+
+    char *id_str = ecs_id_str(world, id);
+    ecs_err("cannot load values for '%s': component does not match snapshot",
+        id_str);
+    ecs_os_free(id_str);
+    return -1;
+}
+
+static
+void* flecs_binary_field_ptr(
+    ecs_binary_deser_t *deser,
+    ecs_table_t *table,
+    int32_t column,
+    int32_t row,
+    int32_t i,
+    ecs_id_t id)
+{
+    int32_t table_row = ecs_vec_get_t(&deser->rows, int32_t, i)[0];
+    if (table_row != FLECS_BINARY_ROW_EXISTS && column != -1) {
+        ecs_column_t *c = &table->data.columns[column];
+        return ECS_ELEM(c->data, c->ti->size, row + table_row);
+    }
+
+    ecs_entity_t e = ecs_vec_get_t(&deser->entities, ecs_entity_t, i)[0];
+    return ecs_get_mut_id(deser->world, e, id);
+}
+
+static
+int flecs_binary_deser_field(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    const ecs_binary_field_t *field,
+    ecs_table_t *table,
+    int32_t row,
+    int32_t bulk_count,
+    ecs_id_t id)
+{
+    ecs_world_t *world = deser->world;
+    ecs_binary_reader_t data = {
+        .base = r->base,
+        .ptr = r->ptr,
+        .end = r->ptr + field->data_size
+    };
+
+    if (!flecs_binary_read(r, flecs_uto(ecs_size_t, field->data_size)) ||
+        flecs_binary_read_pad(r))
+    {
+        return -1;
+    }
+
+    ecs_id_record_t *idr = flecs_id_record_get(world, id);
+    if (flecs_binary_validate_field(world, field, id, idr)) {
+        return -1;
+    }
+
+    int32_t i, count = ecs_vec_count(&deser->entities);
+    const int32_t *rows = ecs_vec_first(&deser->rows);
+    const ecs_table_record_t *tr = flecs_table_record_get(world, table, id);
+    ecs_assert(tr != NULL, ECS_INTERNAL_ERROR, NULL);
+    int32_t column = tr->column;
+
+    if (field->kind == EcsBinaryRaw) {
+        ecs_size_t size = flecs_uto(ecs_size_t, field->size);
+        const void *src = flecs_binary_read(&data, size * count);
+        if (!src) {
+            return -1;
+        }
+
+        if (column != -1 && bulk_count == count) {
+            /* All entities were created by the loader, copy entire column */
+            ecs_column_t *c = &table->data.columns[column];
+            ecs_os_memcpy(ECS_ELEM(c->data, size, row), src, size * count);
+            return 0;
+        }
+
+        for (i = 0; i < count; i ++) {
+            if (rows[i] == FLECS_BINARY_ROW_EXISTS &&
+                id == ecs_id(EcsComponent))
+            {
+                /* Don't overwrite component registered by application */
+                continue;
+            }
+            ecs_os_memcpy(flecs_binary_field_ptr(deser, table, column, row,
+                i, id), ECS_ELEM(src, size, i), size);
+        }
+    } else if (field->kind == EcsBinaryOps) {
+        const EcsTypeSerializer *ts = ecs_get(
+            world, idr->type_info->component, EcsTypeSerializer);
+        ecs_meta_type_op_t *ops = ecs_vec_first_t(&ts->ops, ecs_meta_type_op_t);
+        int32_t op_count = ecs_vec_count(&ts->ops);
+        for (i = 0; i < count; i ++) {
+            if (flecs_binary_deser_ops(deser, &data, ops, op_count,
+                flecs_binary_field_ptr(deser, table, column, row, i, id), 0))
+            {
+                return -1;
+            }
+        }
+    } else if (field->kind == EcsBinaryIdentifier) {
+        for (i = 0; i < count; i ++) {
+            bool err = false;
+            const char *str = flecs_binary_read_str(&data, &err);
+            if (err) {
+                return -1;
+            }
+            if (rows[i] == FLECS_BINARY_ROW_EXISTS &&
+                ECS_PAIR_SECOND(id) == EcsName)
+            {
+                /* Entity was found by name */
+                continue;
+            }
+            EcsIdentifier *ptr = flecs_binary_field_ptr(
+                deser, table, column, row, i, id);
+            ecs_os_strset(&ptr->value, str);
+        }
+    } else if (field->kind == EcsBinaryUnion) {
+        ecs_vec_clear(&deser->unions);
+        for (i = 0; i < count; i ++) {
+            ecs_entity_t tgt;
+            if (flecs_binary_read_t(&data, ecs_entity_t, &tgt)) {
+                return -1;
+            }
+            ecs_vec_append_t(NULL, &deser->unions, ecs_entity_t)[0] =
+                flecs_binary_map_entity(deser, tgt);
+        }
+    }
+
+    return 0;
+}
+
+/* Apply OnSet and union targets after fields are loaded */
+static
+void flecs_binary_field_set(
+    ecs_binary_deser_t *deser,
+    const ecs_binary_field_t *field,
+    ecs_table_t *table,
+    int32_t row,
+    int32_t bulk_count,
+    ecs_id_t id)
+{
+    ecs_world_t *world = deser->world;
+    int32_t i, count = ecs_vec_count(&deser->entities);
+    const ecs_entity_t *entities = ecs_vec_first(&deser->entities);
+    const int32_t *rows = ecs_vec_first(&deser->rows);
+
+    if (field->kind == EcsBinaryUnion) {
+        ecs_entity_t rel = ecs_pair_first(world, id);
+        const ecs_entity_t *tgts = ecs_vec_first(&deser->unions);
+        for (i = 0; i < count; i ++) {
+            if (tgts[i]) {
+                ecs_add_pair(world, entities[i], rel, tgts[i]);
+            }
+        }
+        return;
+    }
+
+    if (bulk_count) {
+        ecs_type_t type = { .array = &id, .count = 1 };
+        flecs_notify_on_set(world, table, row, bulk_count, &type, true);
+    }
+
+    if (bulk_count != count) {
+        for (i = 0; i < count; i ++) {
+            if (rows[i] == FLECS_BINARY_ROW_EXISTS) {
+                ecs_modified_id(world, entities[i], id);
+            }
+        }
+    }
+}
+
+static
+ecs_table_t* flecs_binary_find_table(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r,
+    uint32_t type_count,
+    ecs_id_t *ids,
+    ecs_table_diff_builder_t *diff)
+{
+    ecs_world_t *world = deser->world;
+    ecs_table_t *table = &world->store.root;
+    uint32_t i;
+    for (i = 0; i < type_count; i ++) {
+        ecs_id_t id;
+        if (flecs_binary_read_t(r, ecs_id_t, &id)) {
+            return NULL;
+        }
+
+        ids[i] = flecs_binary_map_id(deser, id);
+
+        ecs_table_diff_t temp_diff = ECS_TABLE_DIFF_INIT;
+        table = flecs_table_traverse_add(world, table, &ids[i], &temp_diff);
+        ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+        flecs_table_diff_build_append_table(world, diff, &temp_diff);
+    }
+
+    return table;
+}
+
+static
+int flecs_binary_load_table(
+    ecs_binary_deser_t *deser,
+    ecs_binary_reader_t *r)
+{
+    ecs_world_t *world = deser->world;
+    ecs_binary_table_t hdr;
+    if (flecs_binary_read_t(r, ecs_binary_table_t, &hdr)) {
+        return -1;
+    }
+
+    ecs_id_t *ids = ecs_os_malloc_n(ecs_id_t, flecs_uto(int32_t, hdr.type_count));
+    ecs_table_diff_builder_t diff = ECS_TABLE_DIFF_INIT;
+    flecs_table_diff_builder_init(world, &diff);
+    int result = -1;
+
+    ecs_table_t *table = flecs_binary_find_table(
+        deser, r, hdr.type_count, ids, &diff);
+    if (!table) {
+        goto done;
+    }
+
+    const uint8_t *ser_entities = flecs_binary_read(r,
+        flecs_uto(ecs_size_t, hdr.entity_count) * ECS_SIZEOF(ecs_entity_t));
+    if (!ser_entities) {
+        goto done;
+    }
+
+    /* Find entities that don't have components yet, which can be created in
+     * bulk. Other entities are moved to the table one by one. */
+    int32_t i, count = flecs_uto(int32_t, hdr.entity_count), bulk_count = 0;
+    ecs_vec_set_count_t(NULL, &deser->entities, ecs_entity_t, count);
+    ecs_vec_set_count_t(NULL, &deser->rows, int32_t, count);
+    ecs_entity_t *entities = ecs_vec_first(&deser->entities);
+    int32_t *rows = ecs_vec_first(&deser->rows);
+
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e;
+        ecs_os_memcpy_t(&e, &ser_entities[i * ECS_SIZEOF(ecs_entity_t)],
+            ecs_entity_t);
+        ecs_map_val_t *ptr = ecs_map_get(&deser->ids, (uint32_t)e);
+        if (ptr) {
+            e = ptr[0];
+        }
+
+        ecs_record_t *rec = flecs_entities_get(world, e);
+        ecs_assert(rec != NULL, ECS_INTERNAL_ERROR, NULL);
+        if (!rec->table) {
+            rows[i] = bulk_count ++;
+        } else {
+            rows[i] = FLECS_BINARY_ROW_EXISTS;
+        }
+        entities[i] = e;
+    }
+
+    for (i = 0; i < count; i ++) {
+        if (rows[i] == FLECS_BINARY_ROW_EXISTS) {
+            uint32_t t;
+            for (t = 0; t < hdr.type_count; t ++) {
+                if (ECS_IS_PAIR(ids[t]) && ECS_PAIR_SECOND(ids[t]) == EcsUnion) {
+                    continue; /* Added when target is set */
+                }
+                ecs_add_id(world, entities[i], ids[t]);
+            }
+        }
+    }
+
+    /* Create entities in bulk. Commands from observers are deferred until all
+     * component values are loaded. */
+    ecs_stage_t *stage = world->stages[0];
+    flecs_defer_begin(world, stage);
+
+    int32_t row = 0;
+    if (bulk_count) {
+        ecs_entity_t *bulk_entities = entities;
+        if (bulk_count != count) {
+            bulk_entities = ecs_os_malloc_n(ecs_entity_t, bulk_count);
+            for (i = 0; i < count; i ++) {
+                if (rows[i] != FLECS_BINARY_ROW_EXISTS) {
+                    bulk_entities[rows[i]] = entities[i];
+                }
+            }
+        }
+
+        ecs_table_diff_t td;
+        flecs_table_diff_build_noalloc(&diff, &td);
+        flecs_bulk_new(world, table, bulk_entities, NULL, bulk_count, NULL,
+            false, &row, &td);
+
+        if (bulk_entities != entities) {
+            ecs_os_free(bulk_entities);
+        }
+    }
+
+    /* Fields are applied after all fields are read, so OnSet observers see
+     * all values of the entity. */
+    const uint8_t *fields = r->ptr;
+    uint32_t f;
+    for (f = 0; f < hdr.field_count; f ++) {
+        ecs_binary_field_t field;
+        if (flecs_binary_read_t(r, ecs_binary_field_t, &field)) {
+            flecs_defer_end(world, stage);
+            goto done;
+        }
+
+        if (field.index >= hdr.type_count) {
+            ecs_err("invalid field in binary data");
+            flecs_defer_end(world, stage);
+            goto done;
+        }
+
+        if (field.kind == EcsBinaryUnion) {
+            /* Union targets are set after the entities are created */
+            if (!flecs_binary_read(r, flecs_uto(ecs_size_t, field.data_size))
+                || flecs_binary_read_pad(r))
+            {
+                flecs_defer_end(world, stage);
+                goto done;
+            }
+            continue;
+        }
+
+        if (flecs_binary_deser_field(deser, r, &field, table, row, bulk_count,
+            ids[field.index]))
+        {
+            flecs_defer_end(world, stage);
+            goto done;
+        }
+    }
+
+    ecs_binary_reader_t fr = { .base = r->base, .ptr = fields, .end = r->ptr };
+    for (f = 0; f < hdr.field_count; f ++) {
+        ecs_binary_field_t field;
+        flecs_binary_read_t(&fr, ecs_binary_field_t, &field);
+        if (field.kind != EcsBinaryUnion) {
+            flecs_binary_field_set(
+                deser, &field, table, row, bulk_count, ids[field.index]);
+        }
+        flecs_binary_read(&fr, flecs_uto(ecs_size_t, field.data_size));
+        flecs_binary_read_pad(&fr);
+    }
+
+    flecs_defer_end(world, stage);
+
+    /* Set union targets */
+    fr.ptr = fields;
+    for (f = 0; f < hdr.field_count; f ++) {
+        ecs_binary_field_t field;
+        flecs_binary_read_t(&fr, ecs_binary_field_t, &field);
+        if (field.kind == EcsBinaryUnion) {
+            if (flecs_binary_deser_field(deser, &fr, &field, table, row,
+                bulk_count, ids[field.index]))
+            {
+                goto done;
+            }
+            flecs_binary_field_set(
+                deser, &field, table, row, bulk_count, ids[field.index]);
+        } else {
+            flecs_binary_read(&fr, flecs_uto(ecs_size_t, field.data_size));
+            flecs_binary_read_pad(&fr);
+        }
+    }
+
+    result = 0;
+done:
+    flecs_table_diff_builder_fini(world, &diff);
+    ecs_os_free(ids);
+    return result;
+}
+
+int ecs_world_from_binary(
+    ecs_world_t *world,
+    const void *data,
+    ecs_size_t size)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(data != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION,
+        "cannot load binary data while world is deferred");
+
+    ecs_binary_reader_t r = {
+        .base = data,
+        .ptr = data,
+        .end = ECS_OFFSET(data, size)
+    };
+
+    ecs_binary_header_t hdr;
+    if (flecs_binary_read_t(&r, ecs_binary_header_t, &hdr)) {
+        goto error;
+    }
+
+    if (ecs_os_memcmp(hdr.magic, FLECS_BINARY_MAGIC, 4)) {
+        ecs_err("data is not in flecs binary format");
+        goto error;
+    }
+
+    if (hdr.version != FLECS_BINARY_VERSION) {
+        ecs_err("unsupported binary format version %u", hdr.version);
+        goto error;
+    }
+
+    if (hdr.byte_order != FLECS_BINARY_BYTE_ORDER) {
+        ecs_err("binary data was stored with a different byte order");
+        goto error;
+    }
+
+    if (hdr.names_offset > flecs_ito(uint32_t, size)) {
+        ecs_err("binary data is truncated");
+        goto error;
+    }
+
+    ecs_binary_deser_t deser = { .world = world };
+    ecs_map_init(&deser.ids, &world->allocator);
+    ecs_map_init(&deser.names, &world->allocator);
+    ecs_map_init(&deser.resolving, &world->allocator);
+    ecs_vec_init_t(NULL, &deser.entities, ecs_entity_t, 0);
+    ecs_vec_init_t(NULL, &deser.rows, int32_t, 0);
+    ecs_vec_init_t(NULL, &deser.unions, ecs_entity_t, 0);
+
+    /* Snapshot already contains instance children, don't instantiate prefab
+     * hierarchies when loading (IsA, prefab) pairs. */
+    ecs_stage_t *stage = world->stages[0];
+    ecs_entity_t prev_base = stage->base;
+    stage->base = EcsIsA;
+
+    int result = -1;
+    const uint8_t *tables = r.ptr;
+    ecs_binary_reader_t names = {
+        .base = r.base,
+        .ptr = ECS_OFFSET(data, hdr.names_offset),
+        .end = r.end
+    };
+
+    if (flecs_binary_read_names(&deser, &names,
+        flecs_uto(int32_t, hdr.name_count)))
+    {
+        goto done;
+    }
+
+    r.end = ECS_OFFSET(data, hdr.names_offset);
+    if (flecs_binary_resolve_rows(&deser, &r, hdr.table_count)) {
+        goto done;
+    }
+
+    ecs_map_iter_t it = ecs_map_iter(&deser.names);
+    while (ecs_map_next(&it)) {
+        if (!flecs_binary_resolve_name(&deser, ecs_map_ptr(&it))) {
+            goto done;
+        }
+    }
+
+    r.ptr = tables;
+    uint32_t t;
+    for (t = 0; t < hdr.table_count; t ++) {
+        if (flecs_binary_load_table(&deser, &r)) {
+            goto done;
+        }
+    }
+
+    result = 0;
+done:
+    stage->base = prev_base;
+    ecs_map_fini(&deser.ids);
+    ecs_map_fini(&deser.names);
+    ecs_map_fini(&deser.resolving);
+    ecs_vec_fini_t(NULL, &deser.entities, ecs_entity_t);
+    ecs_vec_fini_t(NULL, &deser.rows, int32_t);
+    ecs_vec_fini_t(NULL, &deser.unions, ecs_entity_t);
+    return result;
+error:
+    return -1;
+}
+
+int ecs_world_from_binary_file(
+    ecs_world_t *world,
+    const char *filename)
+{
+    ecs_check(filename != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_size_t size = 0;
+    if (ecs_os_has_file_map()) {
+        void *data = ecs_os_file_map(filename, &size);
+        if (data) {
+            int result = ecs_world_from_binary(world, data, size);
+            ecs_os_file_unmap(data, size);
+            return result;
+        }
+    }
+
+    /* File could not be mapped, read it into memory */
+    FILE *file;
+    ecs_os_fopen(&file, filename, "rb");
+    if (!file) {
+        ecs_err("cannot open file '%s' for reading", filename);
+        goto error;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long bytes = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (bytes <= 0 || bytes > INT32_MAX) {
+        ecs_err("cannot read file '%s'", filename);
+        fclose(file);
+        goto error;
+    }
+
+    size = (ecs_size_t)bytes;
+    void *data = ecs_os_malloc(size);
+    size_t read = fread(data, 1, flecs_itosize(size), file);
+    fclose(file);
+
+    int result = -1;
+    if (read == flecs_itosize(size)) {
+        result = ecs_world_from_binary(world, data, size);
+    } else {
+        ecs_err("cannot read file '%s'", filename);
+    }
+
+    ecs_os_free(data);
+    return result;
+error:
+    return -1;
+}
+
+#endif
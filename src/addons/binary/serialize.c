@@ -0,0 +1,860 @@
+/**
+ * @file addons/binary/serialize.c
+ * @brief Serialize world and iterator results to binary format.
+ */
+
+#include "binary.h"
+#include "../meta/meta.h"
+
+#ifdef FLECS_BINARY
+
+typedef struct ecs_binary_ser_t {
+    ecs_world_t *world;
+    ecs_vec_t buf;               /* vector<uint8_t> */
+    ecs_map_t refs;              /* Referenced entities, keyed by entity index */
+    ecs_map_t tables;            /* Serialized tables */
+} ecs_binary_ser_t;
+
+static
+int flecs_binary_ser_ops(
+    ecs_binary_ser_t *ser,
+    ecs_meta_type_op_t *ops,
+    int32_t op_count,
+    const void *base,
+    int32_t in_array);
+
+static
+bool flecs_binary_ops_need_ser(
+    const ecs_world_t *world,
+    const EcsTypeSerializer *ts)
+{
+    ecs_meta_type_op_t *ops = ecs_vec_first_t(&ts->ops, ecs_meta_type_op_t);
+    int32_t i, count = ecs_vec_count(&ts->ops);
+    for (i = 0; i < count; i ++) {
+        ecs_meta_type_op_t *op = &ops[i];
+        switch(op->kind) {
+        case EcsOpString:
+        case EcsOpEntity:
+        case EcsOpId:
+        case EcsOpVector:
+        case EcsOpOpaque:
+            return true;
+        case EcsOpArray: {
+            const EcsArray *a = ecs_get(world, op->type, EcsArray);
+            ecs_assert(a != NULL, ECS_INTERNAL_ERROR, NULL);
+            const EcsTypeSerializer *elem = ecs_get(
+                world, a->type, EcsTypeSerializer);
+            if (elem && flecs_binary_ops_need_ser(world, elem)) {
+                return true;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return false;
+}
+
+bool flecs_binary_type_needs_ops(
+    const ecs_world_t *world,
+    const ecs_type_info_t *ti)
+{
+    if (ti->hooks.copy || ti->hooks.move || ti->hooks.dtor) {
+        return true;
+    }
+
+    const EcsTypeSerializer *ts = ecs_get(
+        world, ti->component, EcsTypeSerializer);
+    if (!ts) {
+        return false;
+    }
+
+    return flecs_binary_ops_need_ser(world, ts);
+}
+
+uint64_t flecs_binary_type_hash(
+    const ecs_world_t *world,
+    ecs_entity_t type)
+{
+    const EcsTypeSerializer *ts = ecs_get(world, type, EcsTypeSerializer);
+    if (!ts) {
+        return 0;
+    }
+
+    ecs_meta_type_op_t *ops = ecs_vec_first_t(&ts->ops, ecs_meta_type_op_t);
+    int32_t i, count = ecs_vec_count(&ts->ops);
+    uint64_t hash = 0;
+    for (i = 0; i < count; i ++) {
+        ecs_meta_type_op_t *op = &ops[i];
+        int32_t layout[4] = { op->kind, op->offset, op->count, op->size };
+        hash ^= flecs_hash(layout, ECS_SIZEOF(layout)) + 0x9e3779b97f4a7c15 +
+            (hash << 6) + (hash >> 2);
+    }
+
+    /* 0 is reserved for types without reflection data */
+    return hash ? hash : 1;
+}
+
+static
+void* flecs_binary_append(
+    ecs_binary_ser_t *ser,
+    ecs_size_t size)
+{
+    return ecs_vec_grow_t(NULL, &ser->buf, uint8_t, size);
+}
+
+static
+void flecs_binary_write(
+    ecs_binary_ser_t *ser,
+    const void *ptr,
+    ecs_size_t size)
+{
+    if (size) {
+        ecs_os_memcpy(flecs_binary_append(ser, size), ptr, size);
+    }
+}
+
+static
+void flecs_binary_pad(
+    ecs_binary_ser_t *ser)
+{
+    int32_t pad = (FLECS_BINARY_ALIGN -
+        (ecs_vec_count(&ser->buf) & (FLECS_BINARY_ALIGN - 1))) &
+            (FLECS_BINARY_ALIGN - 1);
+    if (pad) {
+        ecs_os_memset(flecs_binary_append(ser, pad), 0, pad);
+    }
+}
+
+static
+void flecs_binary_write_str(
+    ecs_binary_ser_t *ser,
+    const char *str)
+{
+    /* Length includes the terminator, so strings can be used in place */
+    uint32_t len = str ? flecs_ito(uint32_t, ecs_os_strlen(str) + 1) : 0;
+    flecs_binary_write(ser, &len, ECS_SIZEOF(uint32_t));
+    flecs_binary_write(ser, str, flecs_uto(ecs_size_t, len));
+}
+
+/* Store entity so the name list can include it if it has a name. Parents are
+ * stored as well, since they're needed to look up the entity by name. */
+static
+void flecs_binary_ref(
+    ecs_binary_ser_t *ser,
+    ecs_entity_t e)
+{
+    if (!ecs_map_is_init(&ser->refs)) {
+        return; /* Iterator results don't store names */
+    }
+
+    while (e) {
+        ecs_map_val_t *ptr = ecs_map_ensure(&ser->refs, (uint32_t)e);
+        if (ptr[0]) {
+            break;
+        }
+
+        ptr[0] = e;
+        if (!ecs_is_alive(ser->world, e)) {
+            break;
+        }
+
+        e = ecs_get_target(ser->world, e, EcsChildOf, 0);
+    }
+}
+
+static
+void flecs_binary_ref_id(
+    ecs_binary_ser_t *ser,
+    ecs_id_t id)
+{
+    if (ECS_IS_PAIR(id)) {
+        flecs_binary_ref(ser, ecs_pair_first(ser->world, id));
+        flecs_binary_ref(ser, ecs_pair_second(ser->world, id));
+    } else {
+        flecs_binary_ref(ser, id & ECS_COMPONENT_MASK);
+    }
+}
+
+static
+int flecs_binary_ser_elements(
+    ecs_binary_ser_t *ser,
+    ecs_entity_t type,
+    const void *base,
+    int32_t count)
+{
+    const EcsTypeSerializer *ts = ecs_get(ser->world, type, EcsTypeSerializer);
+    ecs_assert(ts != NULL, ECS_INTERNAL_ERROR, NULL);
+    const EcsComponent *comp = ecs_get(ser->world, type, EcsComponent);
+    ecs_assert(comp != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_meta_type_op_t *ops = ecs_vec_first_t(&ts->ops, ecs_meta_type_op_t);
+    int32_t i, op_count = ecs_vec_count(&ts->ops);
+    for (i = 0; i < count; i ++) {
+        if (flecs_binary_ser_ops(ser, ops, op_count,
+            ECS_ELEM(base, comp->size, i), 1))
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static
+int flecs_binary_ser_opaque(
+    ecs_binary_ser_t *ser,
+    ecs_meta_type_op_t *op,
+    const void *ptr)
+{
+    /* Opaque types with a contiguous span of primitive values are stored like
+     * vectors and arrays, with the element count for vectors. */
+    const EcsOpaque *ct = ecs_get(ser->world, op->type, EcsOpaque);
+    ecs_assert(ct != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_size_t elem_size;
+    int32_t count;
+    if (flecs_meta_opaque_span_type(ser->world, ct, &elem_size, &count)) {
+        if (!count) {
+            uint32_t ucount = flecs_uto(uint32_t, ct->count(ptr));
+            flecs_binary_write(ser, &ucount, ECS_SIZEOF(uint32_t));
+            count = flecs_uto(int32_t, ucount);
+        }
+        if (count) {
+            flecs_binary_write(ser, ct->data(ECS_CONST_CAST(void*, ptr)), 
+                elem_size * count);
+        }
+        return 0;
+    }
+
+#ifdef FLECS_JSON
+    /* Opaque types can have any representation, store them as JSON */
+    char *json = ecs_ptr_to_json(ser->world, op->type, ptr);
+    if (!json) {
+        return -1;
+    }
+    flecs_binary_write_str(ser, json);
+    ecs_os_free(json);
+    return 0;
+#else
+    (void)ptr;
+    char *path = ecs_get_path(ser->world, op->type);
+    ecs_err("cannot serialize opaque type '%s': JSON addon is required", path);
+    ecs_os_free(path);
+    return -1;
+#endif
+}
+
+static
+int flecs_binary_ser_op(
+    ecs_binary_ser_t *ser,
+    ecs_meta_type_op_t *op,
+    const void *base)
+{
+    const void *ptr = ECS_OFFSET(base, op->offset);
+
+    switch(op->kind) {
+    case EcsOpString:
+        flecs_binary_write_str(ser, *(const char* const*)ptr);
+        break;
+    case EcsOpEntity: {
+        ecs_entity_t e = *(const ecs_entity_t*)ptr;
+        flecs_binary_ref(ser, e);
+        flecs_binary_write(ser, &e, ECS_SIZEOF(ecs_entity_t));
+        break;
+    }
+    case EcsOpId: {
+        ecs_id_t id = *(const ecs_id_t*)ptr;
+        flecs_binary_ref_id(ser, id);
+        flecs_binary_write(ser, &id, ECS_SIZEOF(ecs_id_t));
+        break;
+    }
+    case EcsOpArray: {
+        const EcsArray *a = ecs_get(ser->world, op->type, EcsArray);
+        ecs_assert(a != NULL, ECS_INTERNAL_ERROR, NULL);
+        return flecs_binary_ser_elements(ser, a->type, ptr, a->count);
+    }
+    case EcsOpVector: {
+        const EcsVector *v = ecs_get(ser->world, op->type, EcsVector);
+        ecs_assert(v != NULL, ECS_INTERNAL_ERROR, NULL);
+        const ecs_vec_t *vec = ptr;
+        uint32_t count = flecs_ito(uint32_t, ecs_vec_count(vec));
+        flecs_binary_write(ser, &count, ECS_SIZEOF(uint32_t));
+        return flecs_binary_ser_elements(
+            ser, v->type, vec->array, vec->count);
+    }
+    case EcsOpOpaque:
+        return flecs_binary_ser_opaque(ser, op, ptr);
+    case EcsOpEnum:
+    case EcsOpBitmask:
+    case EcsOpBool:
+    case EcsOpChar:
+    case EcsOpByte:
+    case EcsOpU8:
+    case EcsOpU16:
+    case EcsOpU32:
+    case EcsOpU64:
+    case EcsOpI8:
+    case EcsOpI16:
+    case EcsOpI32:
+    case EcsOpI64:
+    case EcsOpF32:
+    case EcsOpF64:
+    case EcsOpUPtr:
+    case EcsOpIPtr:
+        flecs_binary_write(ser, ptr, op->size);
+        break;
+    case EcsOpPush:
+    case EcsOpPop:
+    case EcsOpScope:
+    case EcsOpPrimitive:
+    default:
+        ecs_throw(ECS_INTERNAL_ERROR, NULL);
+    }
+
+    return 0;
+error:
+    return -1;
+}
+
+/* Iterate over a slice of the type ops array. Ops are walked the same way as
+ * by the JSON serializer, but member names and scopes aren't stored since the
+ * deserializer walks the same ops. */
+static
+int flecs_binary_ser_ops(
+    ecs_binary_ser_t *ser,
+    ecs_meta_type_op_t *ops,
+    int32_t op_count,
+    const void *base,
+    int32_t in_array)
+{
+    int32_t i, j;
+    for (i = 0; i < op_count; i ++) {
+        ecs_meta_type_op_t *op = &ops[i];
+
+        if (in_array <= 0 && op->count > 1) {
+            /* Inline array */
+            for (j = 0; j < op->count; j ++) {
+                if (flecs_binary_ser_ops(ser, op, op->op_count,
+                    ECS_OFFSET(base, j * op->size), 1))
+                {
+                    return -1;
+                }
+            }
+
+            i += op->op_count - 1;
+            continue;
+        }
+
+        if (op->kind == EcsOpPush) {
+            in_array --;
+        } else if (op->kind == EcsOpPop) {
+            in_array ++;
+        } else if (flecs_binary_ser_op(ser, op, base)) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* Get pointer to component value. Sparse components aren't stored in table
+ * columns, so they have to be looked up per entity. */
+static
+const void* flecs_binary_field_ptr(
+    const ecs_table_t *table,
+    const ecs_id_record_t *idr,
+    int32_t column,
+    const ecs_entity_t *entities,
+    int32_t offset,
+    int32_t i)
+{
+    if (column != -1) {
+        const ecs_column_t *c = &table->data.columns[column];
+        return ECS_ELEM(c->data, c->ti->size, offset + i);
+    }
+    return flecs_sparse_get_any(idr->sparse, 0, entities[i]);
+}
+
+static
+int flecs_binary_ser_field(
+    ecs_binary_ser_t *ser,
+    const ecs_table_t *table,
+    int32_t type_index,
+    int32_t offset,
+    int32_t count,
+    const ecs_entity_t *entities,
+    uint32_t *field_count)
+{
+    ecs_world_t *world = ser->world;
+    ecs_id_t id = table->type.array[type_index];
+    ecs_id_record_t *idr = flecs_id_record_get(world, id);
+    ecs_assert(idr != NULL, ECS_INTERNAL_ERROR, NULL);
+    int32_t column = ecs_table_type_to_column_index(table, type_index);
+    int32_t i;
+
+    ecs_binary_field_t field = { .index = flecs_ito(uint32_t, type_index) };
+
+    if (ECS_IS_PAIR(id) && ECS_PAIR_SECOND(id) == EcsUnion) {
+        field.kind = EcsBinaryUnion;
+    } else if (column == -1 && !(idr->flags & EcsIdIsSparse)) {
+        return 0; /* Tag */
+    } else if (!idr->type_info) {
+        return 0;
+    } else if (ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == ecs_id(EcsIdentifier)) {
+        field.kind = EcsBinaryIdentifier;
+    } else {
+        const ecs_type_info_t *ti = idr->type_info;
+        field.size = flecs_ito(uint32_t, ti->size);
+        field.hash = flecs_binary_type_hash(world, ti->component);
+        if (!flecs_binary_type_needs_ops(world, ti)) {
+            field.kind = EcsBinaryRaw;
+        } else if (field.hash) {
+            field.kind = EcsBinaryOps;
+        } else {
+            /* Type owns resources but has no reflection data */
+            return 0;
+        }
+    }
+
+    int32_t header = ecs_vec_count(&ser->buf);
+    flecs_binary_append(ser, ECS_SIZEOF(ecs_binary_field_t));
+    int32_t start = ecs_vec_count(&ser->buf);
+
+    if (field.kind == EcsBinaryRaw) {
+        if (column != -1) {
+            flecs_binary_write(ser,
+                flecs_binary_field_ptr(table, idr, column, entities, offset, 0),
+                    flecs_uto(ecs_size_t, field.size) * count);
+        } else {
+            for (i = 0; i < count; i ++) {
+                flecs_binary_write(ser, flecs_binary_field_ptr(
+                    table, idr, column, entities, offset, i),
+                        flecs_uto(ecs_size_t, field.size));
+            }
+        }
+    } else if (field.kind == EcsBinaryOps) {
+        const EcsTypeSerializer *ts = ecs_get(
+            world, idr->type_info->component, EcsTypeSerializer);
+        ecs_meta_type_op_t *ops = ecs_vec_first_t(&ts->ops, ecs_meta_type_op_t);
+        int32_t op_count = ecs_vec_count(&ts->ops);
+        for (i = 0; i < count; i ++) {
+            if (flecs_binary_ser_ops(ser, ops, op_count, flecs_binary_field_ptr(
+                table, idr, column, entities, offset, i), 0))
+            {
+                return -1;
+            }
+        }
+    } else if (field.kind == EcsBinaryIdentifier) {
+        for (i = 0; i < count; i ++) {
+            const EcsIdentifier *ptr = flecs_binary_field_ptr(
+                table, idr, column, entities, offset, i);
+            flecs_binary_write_str(ser, ptr->value);
+        }
+    } else if (field.kind == EcsBinaryUnion) {
+        for (i = 0; i < count; i ++) {
+            ecs_entity_t tgt = ecs_get_target(
+                world, entities[i], ecs_pair_first(world, id), 0);
+            flecs_binary_ref(ser, tgt);
+            flecs_binary_write(ser, &tgt, ECS_SIZEOF(ecs_entity_t));
+        }
+    }
+
+    field.data_size = flecs_ito(uint32_t, ecs_vec_count(&ser->buf) - start);
+    flecs_binary_pad(ser);
+    ecs_os_memcpy_t(ecs_vec_get_t(&ser->buf, uint8_t, header), &field,
+        ecs_binary_field_t);
+    (*field_count) ++;
+
+    return 0;
+}
+
+static
+int flecs_binary_ser_table(
+    ecs_binary_ser_t *ser,
+    const ecs_table_t *table,
+    int32_t offset,
+    int32_t count,
+    const ecs_entity_t *entities)
+{
+    ecs_binary_table_t hdr = {
+        .type_count = flecs_ito(uint32_t, table->type.count),
+        .entity_count = flecs_ito(uint32_t, count)
+    };
+
+    int32_t header = ecs_vec_count(&ser->buf);
+    flecs_binary_append(ser, ECS_SIZEOF(ecs_binary_table_t));
+
+    int32_t i;
+    for (i = 0; i < table->type.count; i ++) {
+        flecs_binary_ref_id(ser, table->type.array[i]);
+    }
+
+    if (table->flags & EcsTableHasName) {
+        for (i = 0; i < count; i ++) {
+            flecs_binary_ref(ser, entities[i]);
+        }
+    }
+
+    flecs_binary_write(ser, table->type.array,
+        table->type.count * ECS_SIZEOF(ecs_id_t));
+    flecs_binary_write(ser, entities, count * ECS_SIZEOF(ecs_entity_t));
+
+    for (i = 0; i < table->type.count; i ++) {
+        if (flecs_binary_ser_field(ser, table, i, offset, count, entities,
+            &hdr.field_count))
+        {
+            return -1;
+        }
+    }
+
+    ecs_os_memcpy_t(ecs_vec_get_t(&ser->buf, uint8_t, header), &hdr,
+        ecs_binary_table_t);
+
+    ecs_map_ensure(&ser->tables, table->id);
+
+    return 0;
+}
+
+static
+void flecs_binary_ser_names(
+    ecs_binary_ser_t *ser,
+    ecs_binary_header_t *hdr)
+{
+    ecs_world_t *world = ser->world;
+    ecs_map_iter_t it = ecs_map_iter(&ser->refs);
+    while (ecs_map_next(&it)) {
+        ecs_entity_t e = ecs_map_value(&it);
+        if (!ecs_is_alive(world, e)) {
+            continue;
+        }
+
+        const char *name = ecs_get_name(world, e);
+        if (!name) {
+            continue;
+        }
+
+        ecs_record_t *r = flecs_entities_get(world, e);
+        ecs_binary_name_t entry = {
+            .entity = e,
+            .parent = ecs_get_target(world, e, EcsChildOf, 0),
+            .length = flecs_ito(uint32_t, ecs_os_strlen(name))
+        };
+
+        if (r->table && ecs_map_get(&ser->tables, r->table->id)) {
+            entry.flags |= EcsBinaryNameIsRow;
+        }
+
+        flecs_binary_write(ser, &entry, ECS_SIZEOF(ecs_binary_name_t));
+        flecs_binary_write(ser, name, flecs_uto(ecs_size_t, entry.length + 1));
+        flecs_binary_pad(ser);
+        hdr->name_count ++;
+    }
+}
+
+void* ecs_world_to_binary(
+    ecs_world_t *world,
+    ecs_size_t *size_out)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(size_out != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    /* Serialize the same entities as ecs_world_to_json */
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {
+            {
+                .id = ecs_pair(EcsChildOf, EcsFlecs),
+                .oper = EcsNot,
+                .src.id = EcsSelf|EcsUp
+            },
+            {
+                .id = EcsModule,
+                .oper = EcsNot,
+                .src.id = EcsSelf|EcsUp
+            }
+        },
+        .flags = EcsQueryMatchDisabled|EcsQueryMatchPrefab
+    });
+    if (!q) {
+        goto error;
+    }
+
+    ecs_binary_ser_t ser = { .world = world };
+    ecs_vec_init_t(NULL, &ser.buf, uint8_t, 0);
+    ecs_map_init(&ser.refs, &world->allocator);
+    ecs_map_init(&ser.tables, &world->allocator);
+
+    ecs_binary_header_t hdr = {
+        .version = FLECS_BINARY_VERSION,
+        .byte_order = FLECS_BINARY_BYTE_ORDER
+    };
+    ecs_os_memcpy(hdr.magic, FLECS_BINARY_MAGIC, 4);
+    flecs_binary_append(&ser, ECS_SIZEOF(ecs_binary_header_t));
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        if (!it.count) {
+            continue;
+        }
+
+        if (flecs_binary_ser_table(
+            &ser, it.table, it.offset, it.count, it.entities))
+        {
+            ecs_iter_fini(&it);
+            goto cleanup;
+        }
+
+        hdr.table_count ++;
+    }
+
+    hdr.names_offset = flecs_ito(uint32_t, ecs_vec_count(&ser.buf));
+    flecs_binary_ser_names(&ser, &hdr);
+
+    ecs_os_memcpy_t(ecs_vec_first(&ser.buf), &hdr, ecs_binary_header_t);
+
+    ecs_map_fini(&ser.refs);
+    ecs_map_fini(&ser.tables);
+    ecs_query_fini(q);
+
+    *size_out = ecs_vec_count(&ser.buf);
+    return ecs_vec_first(&ser.buf);
+cleanup:
+    ecs_vec_fini_t(NULL, &ser.buf, uint8_t);
+    ecs_map_fini(&ser.refs);
+    ecs_map_fini(&ser.tables);
+    ecs_query_fini(q);
+error:
+    return NULL;
+}
+
+int ecs_world_to_binary_file(
+    ecs_world_t *world,
+    const char *filename)
+{
+    ecs_check(filename != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_size_t size;
+    void *data = ecs_world_to_binary(world, &size);
+    if (!data) {
+        goto error;
+    }
+
+    FILE *file;
+    ecs_os_fopen(&file, filename, "wb");
+    if (!file) {
+        ecs_err("cannot open file '%s' for writing", filename);
+        ecs_os_free(data);
+        goto error;
+    }
+
+    size_t written = fwrite(data, 1, flecs_itosize(size), file);
+    fclose(file);
+    ecs_os_free(data);
+
+    if (written != flecs_itosize(size)) {
+        ecs_err("failed to write world to '%s'", filename);
+        goto error;
+    }
+
+    return 0;
+error:
+    return -1;
+}
+
+static
+void flecs_binary_ser_iter_fields(
+    ecs_binary_ser_t *ser,
+    const ecs_iter_t *it)
+{
+    ecs_binary_iter_header_t hdr = {
+        .version = FLECS_BINARY_VERSION,
+        .byte_order = FLECS_BINARY_BYTE_ORDER,
+        .field_count = flecs_ito(uint32_t, it->field_count)
+    };
+    ecs_os_memcpy(hdr.magic, FLECS_BINARY_ITER_MAGIC, 4);
+    flecs_binary_write(ser, &hdr, ECS_SIZEOF(ecs_binary_iter_header_t));
+
+    int8_t f;
+    for (f = 0; f < it->field_count; f ++) {
+        ecs_id_t id = it->query ? it->query->ids[f] : it->ids[f];
+        char *str = ecs_id_str(ser->world, id);
+        ecs_binary_iter_field_t field = {
+            .id = id,
+            .length = flecs_ito(uint32_t, ecs_os_strlen(str))
+        };
+        flecs_binary_write(ser, &field, ECS_SIZEOF(ecs_binary_iter_field_t));
+        flecs_binary_write(ser, str, flecs_uto(ecs_size_t, field.length + 1));
+        flecs_binary_pad(ser);
+        ecs_os_free(str);
+    }
+}
+
+static
+int flecs_binary_ser_column(
+    ecs_binary_ser_t *ser,
+    const ecs_iter_t *it,
+    int8_t f,
+    bool row_field)
+{
+    ecs_world_t *world = ser->world;
+    ecs_id_t id = it->ids[f];
+    ecs_binary_column_t col = {
+        .id = id,
+        .src = it->sources[f]
+    };
+
+    /* Fields with a source other than $this have a single value */
+    int32_t i, count = col.src ? 1 : it->count;
+    const ecs_type_info_t *ti = NULL;
+    void *ptr = NULL;
+
+    if (it->query && !(it->query->data_fields & (1u << f))) {
+        /* Tag */
+    } else if (!(ti = ecs_get_type_info(world, id))) {
+        /* Id has no data */
+    } else if (!row_field && !(ptr = ecs_field_w_size(
+        it, flecs_itosize(ti->size), f)))
+    {
+        /* Iterator didn't populate field */
+    } else if (ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == ecs_id(EcsIdentifier)) {
+        col.kind = EcsBinaryIdentifier;
+    } else if (!flecs_binary_type_needs_ops(world, ti)) {
+        col.kind = EcsBinaryRaw;
+    } else if (flecs_binary_type_hash(world, ti->component)) {
+        col.kind = EcsBinaryOps;
+    }
+
+    if (col.kind) {
+        col.size = flecs_ito(uint32_t, ti->size);
+    }
+
+    int32_t header = ecs_vec_count(&ser->buf);
+    flecs_binary_append(ser, ECS_SIZEOF(ecs_binary_column_t));
+    int32_t start = ecs_vec_count(&ser->buf);
+
+    for (i = 0; i < count; i ++) {
+        const void *elem;
+        if (!col.kind) {
+            break;
+        } else if (row_field) {
+            elem = ecs_field_at_w_size(it, 0, f, i);
+        } else if (col.kind == EcsBinaryRaw) {
+            /* Columns are contiguous, copy all values at once */
+            flecs_binary_write(ser, ptr, ti->size * count);
+            break;
+        } else {
+            elem = ECS_ELEM(ptr, ti->size, i);
+        }
+
+        if (col.kind == EcsBinaryRaw) {
+            flecs_binary_write(ser, elem, ti->size);
+        } else if (col.kind == EcsBinaryIdentifier) {
+            flecs_binary_write_str(ser, ((const EcsIdentifier*)elem)->value);
+        } else {
+            const EcsTypeSerializer *ts = ecs_get(
+                world, ti->component, EcsTypeSerializer);
+            if (flecs_binary_ser_ops(ser, ecs_vec_first(&ts->ops),
+                ecs_vec_count(&ts->ops), elem, 0))
+            {
+                return -1;
+            }
+        }
+    }
+
+    col.data_size = flecs_ito(uint32_t, ecs_vec_count(&ser->buf) - start);
+    flecs_binary_pad(ser);
+    ecs_os_memcpy_t(ecs_vec_get_t(&ser->buf, uint8_t, header), &col,
+        ecs_binary_column_t);
+
+    return 0;
+}
+
+static
+int flecs_binary_ser_result(
+    ecs_binary_ser_t *ser,
+    const ecs_iter_t *it)
+{
+    ecs_termset_t row_fields = it->query ? it->query->row_fields : 0;
+    ecs_binary_result_t hdr = {
+        .count = flecs_ito(uint32_t, it->count),
+        .set_fields = it->set_fields
+    };
+
+    flecs_binary_write(ser, &hdr, ECS_SIZEOF(ecs_binary_result_t));
+    flecs_binary_write(ser, it->entities,
+        it->count * ECS_SIZEOF(ecs_entity_t));
+
+    int8_t f;
+    for (f = 0; f < it->field_count; f ++) {
+        ecs_termset_t field_bit = (ecs_termset_t)(1u << f);
+        if (!(it->set_fields & field_bit)) {
+            continue;
+        }
+
+        if (flecs_binary_ser_column(ser, it, f,
+            (row_fields & field_bit) != 0))
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int ecs_iter_to_binary_buf(
+    ecs_iter_t *it,
+    ecs_strbuf_t *buf)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(buf != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_binary_ser_t ser = { .world = it->real_world };
+    ecs_vec_init_t(NULL, &ser.buf, uint8_t, 0);
+
+    flecs_binary_ser_iter_fields(&ser, it);
+
+    /* Encode one result at a time so the buffer stays small, and the output
+     * buffer can be flushed while serializing. */
+    ecs_iter_next_action_t next = it->next;
+    while (next(it)) {
+        ecs_strbuf_appendstrn(buf, ecs_vec_first(&ser.buf),
+            ecs_vec_count(&ser.buf));
+        ecs_vec_clear(&ser.buf);
+
+        if (flecs_binary_ser_result(&ser, it)) {
+            ecs_iter_fini(it);
+            ecs_vec_fini_t(NULL, &ser.buf, uint8_t);
+            goto error;
+        }
+    }
+
+    ecs_binary_result_t end = { .flags = EcsBinaryResultEnd };
+    flecs_binary_write(&ser, &end, ECS_SIZEOF(ecs_binary_result_t));
+    ecs_strbuf_appendstrn(buf, ecs_vec_first(&ser.buf),
+        ecs_vec_count(&ser.buf));
+    ecs_vec_fini_t(NULL, &ser.buf, uint8_t);
+
+    return 0;
+error:
+    return -1;
+}
+
+void* ecs_iter_to_binary(
+    ecs_iter_t *it,
+    ecs_size_t *size_out)
+{
+    ecs_check(size_out != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    if (ecs_iter_to_binary_buf(it, &buf)) {
+        ecs_strbuf_reset(&buf);
+        goto error;
+    }
+
+    *size_out = ecs_strbuf_written(&buf);
+    return ecs_strbuf_get(&buf);
+error:
+    return NULL;
+}
+
+#endif
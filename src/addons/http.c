@@ -138,6 +138,8 @@ typedef struct ecs_http_request_entry_t {
     int32_t content_length;
     int code;
     double time;
+    char *content_type;          /* Content type of cached reply */
+    char *accept;                /* Accept header of request */
 } ecs_http_request_entry_t;
 
 /* HTTP server struct */
@@ -545,7 +547,8 @@ static
 ecs_http_request_entry_t* http_find_request_entry(
     ecs_http_server_t *srv,
     const char *array,
-    int32_t count)
+    int32_t count,
+    const char *accept_hdr)
 {
     ecs_http_request_key_t key;
     key.array = array;
@@ -558,7 +561,14 @@ ecs_http_request_entry_t* http_find_request_entry(
     if (entry) {
         double tf = ecs_time_measure(&t);
         if ((tf - entry->time) < srv->cache_timeout) {
-            return entry;
+            /* Handlers can select the reply format based on the Accept
+             * header, so only reuse replies for the same header. */
+            if (!entry->accept == !accept_hdr) {
+                if (!accept_hdr || !ecs_os_strcmp(entry->accept, accept_hdr))
+                {
+                    return entry;
+                }
+            }
         }
     }
     return NULL;
@@ -588,10 +598,16 @@ void http_insert_request_entry(
         entry = elem.value;
     } else {
         ecs_os_free(entry->content);
+        ecs_os_free(entry->content_type);
+        ecs_os_free(entry->accept);
     }
 
+    const char *accept_hdr = ecs_http_get_header(&req->pub, "Accept");
     ecs_time_t t = {0, 0};
     entry->time = ecs_time_measure(&t);
+    entry->content_type = reply->content_type ? 
+        ecs_os_strdup(reply->content_type) : NULL;
+    entry->accept = accept_hdr ? ecs_os_strdup(accept_hdr) : NULL;
     entry->content_length = ecs_strbuf_written(&reply->body);
     entry->content = ecs_strbuf_get(&reply->body);
     entry->code = reply->code;
@@ -666,7 +682,8 @@ ecs_http_request_entry_t* http_enqueue_request(
             /* Check cache for GET requests */
             if (frag->method == EcsHttpGet) {
                 ecs_http_request_entry_t *entry = 
-                    http_find_request_entry(srv, res, frag->header_offsets[0]);
+                    http_find_request_entry(srv, res, frag->header_offsets[0],
+                        ecs_http_get_header(&req.pub, "Accept"));
                 if (entry) {
                     /* If an entry is found, don't enqueue a request. Instead
                      * return the cached response immediately. */
@@ -1086,7 +1103,7 @@ void http_recv_connection(
                         ecs_http_reply_t reply;
                         reply.body = ECS_STRBUF_INIT;
                         reply.code = entry->code;
-                        reply.content_type = "application/json";
+                        reply.content_type = entry->content_type;
                         reply.headers = ECS_STRBUF_INIT;
                         reply.status = "OK";
                         ecs_strbuf_appendstrn(&reply.body, 
@@ -1383,6 +1400,8 @@ void http_purge_request_cache(
                 /* Safe, code owns the value */
                 ecs_os_free(ECS_CONST_CAST(char*, key->array));
                 ecs_os_free(entry->content);
+                ecs_os_free(entry->content_type);
+                ecs_os_free(entry->accept);
                 flecs_hm_bucket_remove(&srv->request_cache, bucket, 
                     ecs_map_key(&it), i);
             }
@@ -1661,11 +1680,12 @@ int ecs_http_server_http_request(
     }
 
     ecs_http_request_entry_t *entry = 
-        http_find_request_entry(srv, request.res, request.req_len);
+        http_find_request_entry(srv, request.res, request.req_len,
+            ecs_http_get_header(&request.pub, "Accept"));
     if (entry) {
         reply_out->body = ECS_STRBUF_INIT;
         reply_out->code = entry->code;
-        reply_out->content_type = "application/json";
+        reply_out->content_type = entry->content_type;
         reply_out->headers = ECS_STRBUF_INIT;
         reply_out->status = "OK";
         ecs_strbuf_appendstrn(&reply_out->body, 
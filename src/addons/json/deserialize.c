@@ -16,6 +16,8 @@ typedef struct {
     ecs_vec_t remove_ids;
     ecs_map_t anonymous_ids;
     ecs_map_t missing_reflection;
+    ecs_hashmap_t lookup_cache;     /* Resolved names, valid for one document */
+    ecs_vec_t lookup_names;         /* vector<char*>, keys of lookup cache */
     const char *expr;
 } ecs_from_json_ctx_t;
 
@@ -29,6 +31,8 @@ void flecs_from_json_ctx_init(
     ecs_vec_init_t(a, &ctx->remove_ids, ecs_id_t, 0);
     ecs_map_init(&ctx->anonymous_ids, a);
     ecs_map_init(&ctx->missing_reflection, a);
+    flecs_name_index_init(&ctx->lookup_cache, a);
+    ecs_vec_init_t(a, &ctx->lookup_names, char*, 0);
 }
 
 static
@@ -39,6 +43,14 @@ void flecs_from_json_ctx_fini(
     ecs_vec_fini_t(ctx->a, &ctx->remove_ids, ecs_record_t*);
     ecs_map_fini(&ctx->anonymous_ids);
     ecs_map_fini(&ctx->missing_reflection);
+    flecs_name_index_fini(&ctx->lookup_cache);
+
+    int32_t i, count = ecs_vec_count(&ctx->lookup_names);
+    char **names = ecs_vec_first(&ctx->lookup_names);
+    for (i = 0; i < count; i ++) {
+        flecs_strfree(ctx->a, names[i]);
+    }
+    ecs_vec_fini_t(ctx->a, &ctx->lookup_names, char*);
 }
 
 static
@@ -109,8 +121,9 @@ static
 ecs_entity_t flecs_json_ensure_entity(
     ecs_world_t *world,
     const char *name,
-    ecs_map_t *anonymous_ids)
+    ecs_from_json_ctx_t *ctx)
 {
+    ecs_map_t *anonymous_ids = &ctx->anonymous_ids;
     ecs_entity_t e = 0;
 
     if (flecs_name_is_id(name)) {
@@ -162,6 +175,37 @@ ecs_entity_t flecs_json_ensure_entity(
     return e;
 }
 
+/* Lookup component, tag or relationship. Documents refer to the same ids many
+ * times, so the result of the lookup is cached for the rest of the document. 
+ * The cache is only used with the builtin lookup action, as the result of a
+ * custom lookup action may change between calls. */
+static
+ecs_entity_t flecs_json_lookup_key(
+    ecs_world_t *world,
+    const char *name,
+    const ecs_from_json_desc_t *desc,
+    ecs_from_json_ctx_t *ctx)
+{
+    if (desc->lookup_ctx != ctx) {
+        return flecs_json_lookup(world, 0, name, desc);
+    }
+
+    ecs_size_t length = ecs_os_strlen(name);
+    uint64_t hash = flecs_hash(name, length);
+    ecs_entity_t e = flecs_name_index_find(
+        &ctx->lookup_cache, name, length, hash);
+    if (!e) {
+        e = flecs_json_lookup(world, 0, name, desc);
+        if (e) {
+            char *key = flecs_strdup(ctx->a, name);
+            ecs_vec_append_t(ctx->a, &ctx->lookup_names, char*)[0] = key;
+            flecs_name_index_ensure(&ctx->lookup_cache, e, key, length, hash);
+        }
+    }
+
+    return e;
+}
+
 static
 bool flecs_json_add_id_to_type(
     ecs_id_t id)
@@ -206,7 +250,7 @@ const char* flecs_json_deser_tags(
             goto error;
         }
 
-        ecs_entity_t tag = flecs_json_lookup(world, 0, str, desc);
+        ecs_entity_t tag = flecs_json_lookup_key(world, str, desc, ctx);
         if (flecs_json_add_id_to_type(tag)) {
             ecs_vec_append_t(ctx->a, &ctx->table_type, ecs_id_t)[0] = tag;
         }
@@ -265,7 +309,7 @@ const char* flecs_json_deser_pairs(
             goto error;
         }
 
-        ecs_entity_t rel = flecs_json_lookup(world, 0, token, desc);
+        ecs_entity_t rel = flecs_json_lookup_key(world, token, desc, ctx);
 
         bool multiple_targets = false;
 
@@ -273,7 +317,8 @@ const char* flecs_json_deser_pairs(
             json = flecs_json_parse(json, &token_kind, token);
             
             if (token_kind == JsonString) {
-                ecs_entity_t tgt = flecs_json_lookup(world, 0, token, desc);
+                ecs_entity_t tgt = flecs_json_lookup_key(
+                    world, token, desc, ctx);
                 ecs_id_t id = ecs_pair(rel, tgt);
                 ecs_add_id(world, e, id);
                 if (flecs_json_add_id_to_type(id)) {
@@ -373,7 +418,7 @@ const char* flecs_json_deser_components(
         ecs_id_t id = 0;
 
         if (token[0] != '(') {
-            id = flecs_json_lookup(world, 0, token, desc);
+            id = flecs_json_lookup_key(world, token, desc, ctx);
         } else {
             char token_buffer[256];
             ecs_term_t term = {0};
@@ -384,10 +429,10 @@ const char* flecs_json_deser_components(
             ecs_assert(term.first.name != NULL, ECS_INTERNAL_ERROR, NULL);
             ecs_assert(term.second.name != NULL, ECS_INTERNAL_ERROR, NULL);
 
-            ecs_entity_t rel = flecs_json_lookup(
-                world, 0, term.first.name, desc);
-            ecs_entity_t tgt = flecs_json_lookup(
-                world, 0, term.second.name, desc);
+            ecs_entity_t rel = flecs_json_lookup_key(
+                world, term.first.name, desc, ctx);
+            ecs_entity_t tgt = flecs_json_lookup_key(
+                world, term.second.name, desc, ctx);
             
             id = ecs_pair(rel, tgt);
         }
@@ -734,7 +779,7 @@ const char* ecs_entity_from_json(
     if (!desc.lookup_action) {
         desc.lookup_action = (ecs_entity_t(*)(
             const ecs_world_t*, const char*, void*))flecs_json_ensure_entity;
-        desc.lookup_ctx = &ctx.anonymous_ids;
+        desc.lookup_ctx = &ctx;
     }
 
     json = flecs_entity_from_json(world, e, json, &desc, &ctx);
@@ -768,7 +813,7 @@ const char* ecs_world_from_json(
     if (!desc.lookup_action) {
         desc.lookup_action = (ecs_entity_t(*)(
             const ecs_world_t*, const char*, void*))flecs_json_ensure_entity;
-        desc.lookup_ctx = &ctx.anonymous_ids;
+        desc.lookup_ctx = &ctx;
     }
 
     json = flecs_json_expect(json, JsonObjectOpen, token, &desc);
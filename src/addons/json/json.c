@@ -81,6 +81,14 @@ const char* flecs_json_parse(
                 break;
             }
 
+            if (ch != '\\') {
+                /* Fast path for characters that don't need unescaping */
+                token_ptr[0] = ch;
+                token_ptr ++;
+                json ++;
+                continue;
+            }
+
             json = flecs_chrparse(json, token_ptr ++);
         }
 
@@ -221,7 +221,7 @@ void flecs_json_serialize_query(
 
 int flecs_json_ser_type(
     const ecs_world_t *world,
-    const ecs_vec_t *ser,
+    const EcsTypeSerializer *ser,
     const void *base,
     ecs_strbuf_t *str);
 
@@ -210,7 +210,7 @@ int flecs_json_serialize_iter_result_field_values(
         }
 
         flecs_json_next(buf);
-        if (flecs_json_ser_type(world, &value_ctx->ser->ops, ptr, buf) != 0) {
+        if (flecs_json_ser_type(world, value_ctx->ser, ptr, buf) != 0) {
             return -1;
         }
     }
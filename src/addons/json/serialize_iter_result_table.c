@@ -312,7 +312,7 @@ int flecs_json_serialize_table_components(
         if (has_reflection && (!desc || desc->serialize_values)) {
             ecs_assert(type_ser != NULL, ECS_INTERNAL_ERROR, NULL);
             if (flecs_json_ser_type(
-                world, &type_ser->ops, ptr, buf) != 0) 
+                world, type_ser, ptr, buf) != 0) 
             {
                 goto error;
             }
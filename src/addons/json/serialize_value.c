@@ -24,6 +24,11 @@ int flecs_json_ser_type_op(
     const void *base,
     ecs_strbuf_t *str);
 
+static
+const struct ecs_json_ser_plan_t* flecs_json_ser_plan_get(
+    const ecs_world_t *world,
+    const EcsTypeSerializer *ser);
+
 /* Serialize enumeration */
 static
 int flecs_json_ser_enum(
@@ -156,8 +161,30 @@ int flecs_json_ser_type_elements(
     ecs_meta_type_op_t *ops = ecs_vec_first_t(&ser->ops, ecs_meta_type_op_t);
     int32_t op_count = ecs_vec_count(&ser->ops);
 
-    return flecs_json_ser_elements(
-        world, ops, op_count, base, elem_count, comp->size, str, is_array);
+    /* Elements of arrays don't serialize the first op as inline array, which
+     * the compiled serializer can't express. */
+    if (!flecs_json_ser_plan_get(world, ser) || (is_array && ops[0].count > 1)) {
+        return flecs_json_ser_elements(
+            world, ops, op_count, base, elem_count, comp->size, str, is_array);
+    }
+
+    flecs_json_array_push(str);
+
+    const void *ptr = base;
+    ecs_size_t size = comp->size;
+
+    int i;
+    for (i = 0; i < elem_count; i ++) {
+        ecs_strbuf_list_next(str);
+        if (flecs_json_ser_type(world, ser, ptr, str)) {
+            return -1;
+        }
+        ptr = ECS_OFFSET(ptr, size);
+    }
+
+    flecs_json_array_pop(str);
+
+    return 0;
 }
 
 /* Serialize array */
@@ -241,6 +268,21 @@ int json_ser_custom_type(
     ecs_assert(ct->as_type != 0, ECS_INVALID_OPERATION, 
         "opaque type %s has not populated as_type field",
             ecs_get_name(world, op->type));
+
+    /* Serialize elements directly if type has contiguous span interface */
+    ecs_size_t elem_size;
+    int32_t count;
+    ecs_entity_t elem_type = flecs_meta_opaque_span_type(
+        world, ct, &elem_size, &count);
+    if (elem_type) {
+        bool is_array = count != 0;
+        if (!is_array) {
+            count = flecs_uto(int32_t, ct->count(base));
+        }
+        return flecs_json_ser_type_elements(world, elem_type, 
+            ct->data(ECS_CONST_CAST(void*, base)), count, str, is_array);
+    }
+
     ecs_assert(ct->serialize != NULL, ECS_INVALID_OPERATION,
         "opaque type %s does not have serialize interface", 
             ecs_get_name(world, op->type));
@@ -487,15 +529,409 @@ error:
     return -1;
 }
 
+/* Compiled serializer.
+ * Type ops are compiled to a flat list of instructions that each have a
+ * precomputed prefix with the braces, separators and member name that precede
+ * the value. The prefixes of adjacent members are merged, so that serializing
+ * a struct of primitive members takes a single append per member. Values that
+ * are not primitives are forwarded to the regular type op serializer. */
+
+typedef enum ecs_json_ser_op_kind_t {
+    EcsJsonOpLiteral,   /* Only append prefix */
+    EcsJsonOpElements,  /* Inline array, element ops follow instruction */
+    EcsJsonOpValue,     /* Forward to type op serializer */
+    EcsJsonOpBool,
+    EcsJsonOpU8,
+    EcsJsonOpU16,
+    EcsJsonOpU32,
+    EcsJsonOpI8,
+    EcsJsonOpI16,
+    EcsJsonOpI32,
+    EcsJsonOpI64,
+    EcsJsonOpF32,
+    EcsJsonOpF64
+} ecs_json_ser_op_kind_t;
+
+typedef struct ecs_json_ser_op_t {
+    ecs_json_ser_op_kind_t kind;
+    int32_t prefix;             /* Offset of prefix in plan string */
+    int32_t prefix_len;
+    ecs_size_t offset;          /* Offset of value */
+    int32_t type_op;            /* Index of type op (EcsJsonOpValue) */
+    int32_t elem_count;         /* Number of elements (EcsJsonOpElements) */
+    ecs_size_t elem_size;       /* Size of element (EcsJsonOpElements) */
+    int32_t op_count;           /* Number of element ops (EcsJsonOpElements) */
+} ecs_json_ser_op_t;
+
+typedef struct ecs_json_ser_plan_t ecs_json_ser_plan_t;
+
+struct ecs_json_ser_plan_t {
+    ecs_vec_t ops;              /* vector<ecs_json_ser_op_t> */
+    ecs_vec_t str;              /* vector<char>, prefix strings */
+};
+
+typedef struct ecs_json_ser_compiler_t {
+    ecs_json_ser_plan_t *plan;
+    int32_t pending;            /* Start of prefix for next instruction */
+    int32_t sp;
+    int32_t member_count[ECS_META_MAX_SCOPE_DEPTH];
+} ecs_json_ser_compiler_t;
+
+static
+void flecs_json_ser_plan_append(
+    ecs_json_ser_compiler_t *c,
+    const char *str,
+    int32_t len)
+{
+    ecs_vec_t *v = &c->plan->str;
+    int32_t count = ecs_vec_count(v);
+    ecs_vec_set_count_t(NULL, v, char, count + len);
+    ecs_os_memcpy(ecs_vec_get_t(v, char, count), str, len);
+}
+
+static
+ecs_json_ser_op_t* flecs_json_ser_plan_op(
+    ecs_json_ser_compiler_t *c,
+    ecs_json_ser_op_kind_t kind,
+    const ecs_meta_type_op_t *op,
+    int32_t type_op)
+{
+    ecs_json_ser_op_t *result = ecs_vec_append_t(
+        NULL, &c->plan->ops, ecs_json_ser_op_t);
+    int32_t str_count = ecs_vec_count(&c->plan->str);
+    result->kind = kind;
+    result->prefix = c->pending;
+    result->prefix_len = str_count - c->pending;
+    result->offset = op ? op->offset : 0;
+    result->type_op = type_op;
+    result->elem_count = 0;
+    result->elem_size = 0;
+    result->op_count = 0;
+    c->pending = str_count;
+    return result;
+}
+
+static
+ecs_json_ser_op_kind_t flecs_json_ser_plan_kind(
+    ecs_meta_type_op_kind_t kind)
+{
+    switch(kind) {
+    case EcsOpBool: return EcsJsonOpBool;
+    case EcsOpByte: return EcsJsonOpU8;
+    case EcsOpU8: return EcsJsonOpU8;
+    case EcsOpU16: return EcsJsonOpU16;
+    case EcsOpU32: return EcsJsonOpU32;
+    case EcsOpI8: return EcsJsonOpI8;
+    case EcsOpI16: return EcsJsonOpI16;
+    case EcsOpI32: return EcsJsonOpI32;
+    case EcsOpI64: return EcsJsonOpI64;
+    case EcsOpF32: return EcsJsonOpF32;
+    case EcsOpF64: return EcsJsonOpF64;
+    default: return EcsJsonOpValue;
+    }
+}
+
+/* Mirrors the control flow of flecs_json_ser_type_ops */
+static
+int flecs_json_ser_plan_compile(
+    ecs_json_ser_compiler_t *c,
+    const ecs_meta_type_op_t *ops,
+    int32_t start,
+    int32_t op_count,
+    int32_t in_array)
+{
+    int32_t i, end = start + op_count;
+    for (i = start; i < end; i ++) {
+        const ecs_meta_type_op_t *op = &ops[i];
+
+        if (in_array <= 0) {
+            if (op->name) {
+                if (!c->sp) {
+                    /* Member outside of struct scope */
+                    return -1;
+                }
+
+                if (c->member_count[c->sp] ++) {
+                    flecs_json_ser_plan_append(c, ", ", 2);
+                }
+                flecs_json_ser_plan_append(c, "\"", 1);
+                flecs_json_ser_plan_append(c, op->name, 
+                    ecs_os_strlen(op->name));
+                flecs_json_ser_plan_append(c, "\":", 2);
+            }
+
+            if (op->count > 1) {
+                flecs_json_ser_plan_append(c, "[", 1);
+                int32_t elem = ecs_vec_count(&c->plan->ops);
+                flecs_json_ser_plan_op(c, EcsJsonOpElements, op, i);
+
+                /* Compile element ops in their own scope */
+                int32_t sp = c->sp;
+                c->sp = 0;
+                if (flecs_json_ser_plan_compile(
+                    c, ops, i, op->op_count, 1)) 
+                {
+                    return -1;
+                }
+                if (c->pending != ecs_vec_count(&c->plan->str)) {
+                    flecs_json_ser_plan_op(c, EcsJsonOpLiteral, NULL, -1);
+                }
+                c->sp = sp;
+
+                ecs_json_ser_op_t *elem_op = ecs_vec_get_t(
+                    &c->plan->ops, ecs_json_ser_op_t, elem);
+                elem_op->elem_count = op->count;
+                elem_op->elem_size = op->size;
+                elem_op->op_count = ecs_vec_count(&c->plan->ops) - elem - 1;
+
+                flecs_json_ser_plan_append(c, "]", 1);
+                i += op->op_count - 1;
+                continue;
+            }
+        }
+
+        switch(op->kind) {
+        case EcsOpPush:
+            if ((c->sp + 1) >= ECS_META_MAX_SCOPE_DEPTH) {
+                return -1;
+            }
+            c->member_count[++ c->sp] = 0;
+            flecs_json_ser_plan_append(c, "{", 1);
+            in_array --;
+            break;
+        case EcsOpPop:
+            if (!c->sp) {
+                return -1;
+            }
+            c->sp --;
+            flecs_json_ser_plan_append(c, "}", 1);
+            in_array ++;
+            break;
+        case EcsOpScope:
+        case EcsOpPrimitive:
+            return -1;
+        default:
+            flecs_json_ser_plan_op(c, flecs_json_ser_plan_kind(op->kind), op, i);
+            break;
+        }
+    }
+
+    return 0;
+}
+
+void flecs_json_ser_plan_fini(
+    ecs_json_ser_plan_t *plan)
+{
+    if (plan) {
+        ecs_vec_fini_t(NULL, &plan->ops, ecs_json_ser_op_t);
+        ecs_vec_fini_t(NULL, &plan->str, char);
+        ecs_os_free(plan);
+    }
+}
+
+/* Compile type ops to plan. If the type can't be compiled, the plan has no ops
+ * and the type op serializer is used. */
+static
+ecs_json_ser_plan_t* flecs_json_ser_plan_init(
+    const ecs_vec_t *v_ops)
+{
+    ecs_json_ser_plan_t *plan = ecs_os_calloc_t(ecs_json_ser_plan_t);
+    int32_t count = ecs_vec_count(v_ops);
+    if (!count) {
+        return plan;
+    }
+
+    ecs_json_ser_compiler_t c = { .plan = plan };
+    if (flecs_json_ser_plan_compile(&c, 
+        ecs_vec_first_t(v_ops, ecs_meta_type_op_t), 0, count, 0)) 
+    {
+        ecs_vec_fini_t(NULL, &plan->ops, ecs_json_ser_op_t);
+        ecs_vec_fini_t(NULL, &plan->str, char);
+        return plan;
+    }
+
+    if (c.pending != ecs_vec_count(&plan->str)) {
+        flecs_json_ser_plan_op(&c, EcsJsonOpLiteral, NULL, -1);
+    }
+
+    return plan;
+}
+
+/* Get plan for type, compile it if the type hasn't been serialized yet. Plans
+ * aren't compiled while the world is in multithreaded mode, as other threads 
+ * could be reading the type serializer. */
+static
+const ecs_json_ser_plan_t* flecs_json_ser_plan_get(
+    const ecs_world_t *world,
+    const EcsTypeSerializer *ser)
+{
+    const ecs_json_ser_plan_t *plan = ser->json;
+    if (!plan) {
+        const ecs_world_t *real_world = ecs_get_world(world);
+        if (real_world->flags & EcsWorldMultiThreaded) {
+            return NULL;
+        }
+
+        plan = ECS_CONST_CAST(EcsTypeSerializer*, ser)->json = 
+            flecs_json_ser_plan_init(&ser->ops);
+    }
+
+    if (!ecs_vec_count(&plan->ops)) {
+        return NULL;
+    }
+
+    return plan;
+}
+
+static
+bool flecs_json_ser_plan_primitive(
+    const ecs_json_ser_op_t *op,
+    const void *ptr,
+    ecs_strbuf_t *str)
+{
+    switch(op->kind) {
+    case EcsJsonOpBool:
+        if (*(const bool*)ptr) {
+            ecs_strbuf_appendlit(str, "true");
+        } else {
+            ecs_strbuf_appendlit(str, "false");
+        }
+        break;
+    case EcsJsonOpU8:
+        ecs_strbuf_appendint(str, flecs_uto(int64_t, *(const uint8_t*)ptr));
+        break;
+    case EcsJsonOpU16:
+        ecs_strbuf_appendint(str, flecs_uto(int64_t, *(const uint16_t*)ptr));
+        break;
+    case EcsJsonOpU32:
+        ecs_strbuf_appendint(str, flecs_uto(int64_t, *(const uint32_t*)ptr));
+        break;
+    case EcsJsonOpI8:
+        ecs_strbuf_appendint(str, flecs_ito(int64_t, *(const int8_t*)ptr));
+        break;
+    case EcsJsonOpI16:
+        ecs_strbuf_appendint(str, flecs_ito(int64_t, *(const int16_t*)ptr));
+        break;
+    case EcsJsonOpI32:
+        ecs_strbuf_appendint(str, flecs_ito(int64_t, *(const int32_t*)ptr));
+        break;
+    case EcsJsonOpI64: {
+        int64_t v = *(const int64_t*)ptr;
+        if (v >= 2147483648) {
+            /* Large integers are quoted, as they may not fit in a double */
+            ecs_strbuf_appendch(str, '"');
+            ecs_strbuf_appendint(str, v);
+            ecs_strbuf_appendch(str, '"');
+        } else {
+            ecs_strbuf_appendint(str, v);
+        }
+        break;
+    }
+    case EcsJsonOpF32:
+        ecs_strbuf_appendflt(str, (ecs_f64_t)*(const ecs_f32_t*)ptr, '"');
+        break;
+    case EcsJsonOpF64:
+        ecs_strbuf_appendflt(str, *(const ecs_f64_t*)ptr, '"');
+        break;
+    case EcsJsonOpLiteral:
+    case EcsJsonOpElements:
+    case EcsJsonOpValue:
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/* Run a slice of the instructions of a compiled serializer */
+static
+int flecs_json_ser_plan_ops(
+    const ecs_world_t *world,
+    const ecs_json_ser_plan_t *plan,
+    const ecs_json_ser_op_t *ops,
+    int32_t op_count,
+    ecs_meta_type_op_t *type_ops,
+    const void *base,
+    ecs_strbuf_t *str)
+{
+    const char *prefix = ecs_vec_first_t(&plan->str, char);
+
+    for (int i = 0; i < op_count; i ++) {
+        const ecs_json_ser_op_t *op = &ops[i];
+
+        if (op->prefix_len) {
+            ecs_strbuf_appendstrn(str, &prefix[op->prefix], op->prefix_len);
+        }
+
+        if (op->kind == EcsJsonOpElements) {
+            const ecs_json_ser_op_t *elem_ops = &ops[i + 1];
+            int32_t e, elem_op_count = op->op_count;
+            const void *ptr = base;
+
+            if (elem_op_count == 1 && !elem_ops->prefix_len && 
+                elem_ops->kind > EcsJsonOpValue) 
+            {
+                /* Fast path for inline arrays of primitives */
+                for (e = 0; e < op->elem_count; e ++) {
+                    if (e) {
+                        ecs_strbuf_appendlit(str, ", ");
+                    }
+                    flecs_json_ser_plan_primitive(elem_ops, 
+                        ECS_OFFSET(ptr, elem_ops->offset), str);
+                    ptr = ECS_OFFSET(ptr, op->elem_size);
+                }
+            } else {
+                for (e = 0; e < op->elem_count; e ++) {
+                    if (e) {
+                        ecs_strbuf_appendlit(str, ", ");
+                    }
+                    if (flecs_json_ser_plan_ops(world, plan, elem_ops, 
+                        elem_op_count, type_ops, ptr, str))
+                    {
+                        return -1;
+                    }
+                    ptr = ECS_OFFSET(ptr, op->elem_size);
+                }
+            }
+
+            i += elem_op_count;
+            continue;
+        }
+
+        if (op->kind == EcsJsonOpLiteral) {
+            continue;
+        }
+
+        if (!flecs_json_ser_plan_primitive(
+            op, ECS_OFFSET(base, op->offset), str)) 
+        {
+            if (flecs_json_ser_type_op(
+                world, &type_ops[op->type_op], base, str)) 
+            {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
 /* Iterate over the type ops of a type */
 int flecs_json_ser_type(
     const ecs_world_t *world,
-    const ecs_vec_t *v_ops,
+    const EcsTypeSerializer *ser,
     const void *base, 
     ecs_strbuf_t *str) 
 {
-    ecs_meta_type_op_t *ops = ecs_vec_first_t(v_ops, ecs_meta_type_op_t);
-    int32_t count = ecs_vec_count(v_ops);
+    ecs_meta_type_op_t *ops = ecs_vec_first_t(&ser->ops, ecs_meta_type_op_t);
+    const ecs_json_ser_plan_t *plan = flecs_json_ser_plan_get(world, ser);
+    if (plan) {
+        return flecs_json_ser_plan_ops(world, plan, 
+            ecs_vec_first_t(&plan->ops, ecs_json_ser_op_t),
+            ecs_vec_count(&plan->ops), ops, base, str);
+    }
+
+    int32_t count = ecs_vec_count(&ser->ops);
     return flecs_json_ser_type_ops(world, ops, count, base, str, 0);
 }
 
@@ -515,7 +951,7 @@ int flecs_array_to_json_buf_w_type_data(
 
         do {
             ecs_strbuf_list_next(buf);
-            if (flecs_json_ser_type(world, &ser->ops, ptr, buf)) {
+            if (flecs_json_ser_type(world, ser, ptr, buf)) {
                 return -1;
             }
 
@@ -524,7 +960,7 @@ int flecs_array_to_json_buf_w_type_data(
 
         flecs_json_array_pop(buf);
     } else {
-        if (flecs_json_ser_type(world, &ser->ops, ptr, buf)) {
+        if (flecs_json_ser_type(world, ser, ptr, buf)) {
             return -1;
         }
     }
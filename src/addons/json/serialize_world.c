@@ -8,6 +8,189 @@
 
 #ifdef FLECS_JSON
 
+/* Worlds with fewer entities are serialized on the calling thread */
+#define FLECS_JSON_PARALLEL_MIN (4096)
+
+/* Query result that is serialized by one or more tasks */
+typedef struct ecs_json_world_result_t {
+    ecs_table_t *table;
+    const ecs_entity_t *entities;
+    int32_t offset;
+    int32_t count;
+} ecs_json_world_result_t;
+
+/* Range of entities (across all results) serialized by a single task */
+typedef struct ecs_json_world_job_t {
+    ecs_world_t *world;
+    const ecs_iter_to_json_desc_t *desc;
+    const ecs_json_world_result_t *results;
+    int32_t result_count;
+    int64_t begin;                   /* First entity */
+    int64_t end;                     /* Last entity + 1 */
+    ecs_strbuf_t buf;
+    int ret;
+} ecs_json_world_job_t;
+
+static
+void flecs_json_world_job_run(
+    ecs_json_world_job_t *job)
+{
+    ecs_json_ser_ctx_t ser_ctx;
+    ecs_os_zeromem(&ser_ctx);
+
+    /* Results of all jobs are elements of the same array */
+    ecs_strbuf_list_push(&job->buf, "", ", ");
+
+    int64_t offset = 0;
+    int32_t i;
+    for (i = 0; i < job->result_count; i ++) {
+        const ecs_json_world_result_t *r = &job->results[i];
+        int64_t r_begin = offset;
+        int64_t r_end = offset + r->count;
+        offset = r_end;
+
+        if (r_end <= job->begin) {
+            continue;
+        }
+        if (r_begin >= job->end) {
+            break;
+        }
+
+        /* Rows are serialized independently, so a result can be split up
+         * between jobs without changing the output. */
+        int32_t from = (int32_t)(ECS_MAX(job->begin, r_begin) - r_begin);
+        int32_t to = (int32_t)(ECS_MIN(job->end, r_end) - r_begin);
+        ecs_iter_t it = {
+            .world = job->world,
+            .real_world = job->world,
+            .table = r->table,
+            .entities = &r->entities[from],
+            .offset = r->offset + from,
+            .count = to - from,
+            .flags = EcsIterNoData
+        };
+
+        if (flecs_json_serialize_iter_result(
+            job->world, &it, &job->buf, job->desc, &ser_ctx))
+        {
+            job->ret = -1;
+            break;
+        }
+    }
+
+    ecs_strbuf_list_pop(&job->buf, "");
+}
+
+static
+void* flecs_json_world_job_task(
+    void *arg)
+{
+    flecs_json_world_job_run(arg);
+    return NULL;
+}
+
+/* Serialize world on multiple threads. Query results are collected on the
+ * calling thread, after which the entities are divided in equal ranges between
+ * the jobs. Each job serializes to its own buffer, and the buffers are appended
+ * to the output in order. */
+static
+int flecs_world_to_json_parallel(
+    ecs_world_t *world,
+    ecs_query_t *q,
+    ecs_strbuf_t *buf_out,
+    const ecs_iter_to_json_desc_t *json_desc,
+    int32_t thread_count)
+{
+    ecs_vec_t results;
+    ecs_vec_init_t(NULL, &results, ecs_json_world_result_t, 0);
+
+    int64_t total = 0;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    ECS_BIT_SET(it.flags, EcsIterNoData);
+    while (ecs_query_next(&it)) {
+        ecs_json_world_result_t *r = ecs_vec_append_t(
+            NULL, &results, ecs_json_world_result_t);
+        r->table = it.table;
+        r->entities = it.entities;
+        r->offset = it.offset;
+        r->count = it.count;
+        total += it.count;
+    }
+
+    int32_t i, job_count = thread_count;
+    if (total < FLECS_JSON_PARALLEL_MIN) {
+        job_count = 1;
+    }
+
+    ecs_json_world_job_t *jobs = ecs_os_calloc_n(
+        ecs_json_world_job_t, job_count);
+    ecs_os_thread_t *tasks = ecs_os_malloc_n(ecs_os_thread_t, job_count);
+    for (i = 0; i < job_count; i ++) {
+        jobs[i].world = world;
+        jobs[i].desc = json_desc;
+        jobs[i].results = ecs_vec_first(&results);
+        jobs[i].result_count = ecs_vec_count(&results);
+        jobs[i].begin = total * i / job_count;
+        jobs[i].end = total * (i + 1) / job_count;
+    }
+
+    /* Prevent jobs from modifying world caches (such as the path cache) while
+     * other jobs are reading from them. */
+    ecs_world_t *real_world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    ecs_flags32_t mt_flag = real_world->flags & EcsWorldMultiThreaded;
+    if (job_count > 1) {
+        real_world->flags |= EcsWorldMultiThreaded;
+    }
+
+    for (i = 1; i < job_count; i ++) {
+        tasks[i] = ecs_os_task_new(flecs_json_world_job_task, &jobs[i]);
+    }
+
+    flecs_json_world_job_run(&jobs[0]);
+
+    for (i = 1; i < job_count; i ++) {
+        ecs_os_task_join(tasks[i]);
+    }
+
+    real_world->flags &= ~EcsWorldMultiThreaded;
+    real_world->flags |= mt_flag;
+
+    int ret = 0;
+    flecs_json_object_push(buf_out);
+    flecs_json_memberl(buf_out, "results");
+    flecs_json_array_push(buf_out);
+
+    for (i = 0; i < job_count; i ++) {
+        ecs_json_world_job_t *job = &jobs[i];
+        ecs_size_t len = ecs_strbuf_written(&job->buf);
+        if (job->ret) {
+            ret = -1;
+        }
+
+        if (ret || !len) {
+            ecs_strbuf_reset(&job->buf);
+            continue;
+        }
+
+        char *str = ecs_strbuf_get(&job->buf);
+        ecs_strbuf_list_appendstrn(buf_out, str, len);
+        ecs_os_free(str);
+    }
+
+    flecs_json_array_pop(buf_out);
+    flecs_json_object_pop(buf_out);
+
+    ecs_os_free(tasks);
+    ecs_os_free(jobs);
+    ecs_vec_fini_t(NULL, &results, ecs_json_world_result_t);
+
+    if (ret) {
+        ecs_strbuf_reset(buf_out);
+    }
+
+    return ret;
+}
+
 int ecs_world_to_json_buf(
     ecs_world_t *world,
     ecs_strbuf_t *buf_out,
@@ -42,7 +225,6 @@ int ecs_world_to_json_buf(
         return -1;
     }
 
-    ecs_iter_t it = ecs_query_iter(world, q);
     ecs_iter_to_json_desc_t json_desc = { 
         .serialize_table = true,
         .serialize_full_paths = true,
@@ -50,7 +232,21 @@ int ecs_world_to_json_buf(
         .serialize_values = true
     };
 
-    int ret = ecs_iter_to_json_buf(&it, buf_out, &json_desc);
+    int ret;
+    int32_t thread_count = desc ? desc->thread_count : 0;
+
+    /* The parallel serializer keeps the output of each job in memory. Don't use
+     * it when the output buffer is flushed, as the output is streamed. */
+    if (thread_count > 1 && ecs_os_has_task_support() && 
+        !buf_out->flush_action) 
+    {
+        ret = flecs_world_to_json_parallel(
+            world, q, buf_out, &json_desc, thread_count);
+    } else {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        ret = ecs_iter_to_json_buf(&it, buf_out, &json_desc);
+    }
+
     ecs_query_fini(q);
     return ret;
 }
@@ -138,6 +138,18 @@ ecs_meta_type_op_t* flecs_meta_cursor_get_ptr(
         scope->ptr = ecs_vec_first(scope->vector);
     } else if (opaque) {
         if (scope->is_collection) {
+            if (!opaque->ensure_element && opaque->data) {
+                /* Grow collection and get element from contiguous span */
+                size_t elem = flecs_ito(size_t, scope->elem_cur);
+                if (opaque->count && opaque->resize && 
+                    opaque->count(scope->ptr) <= elem) 
+                {
+                    opaque->resize(scope->ptr, elem + 1);
+                }
+                scope->is_empty_scope = false;
+                return ECS_ELEM(opaque->data(scope->ptr), size, scope->elem_cur);
+            }
+
             if (!opaque->ensure_element) {
                 char *str = ecs_get_path(world, scope->type);
                 ecs_err("missing ensure_element for opaque type %s", str);
@@ -297,6 +309,15 @@ int ecs_meta_member(
         return -1;
     }
 
+    /* Members are usually assigned in declaration order, in which case the
+     * cursor already points to the member and lookup can be skipped. */
+    if (!scope->opaque && scope->op_cur < scope->op_count) {
+        const char *cur_name = scope->ops[scope->op_cur].name;
+        if (cur_name && !ecs_os_strcmp(cur_name, name)) {
+            return 0;
+        }
+    }
+
     const uint64_t *cur_ptr = flecs_name_index_find_ptr(members, name, 0, 0);
     if (!cur_ptr) {
         char *path = ecs_get_path(world, scope->type);
@@ -42,6 +42,11 @@ void ecs_meta_dtor_serialized(
     }
 
     ecs_vec_fini_t(NULL, &ptr->ops, ecs_meta_type_op_t);
+
+#ifdef FLECS_JSON
+    flecs_json_ser_plan_fini(ptr->json);
+#endif
+    ptr->json = NULL;
 }
 
 static ECS_COPY(EcsTypeSerializer, dst, src, {
@@ -58,12 +63,17 @@ static ECS_COPY(EcsTypeSerializer, dst, src, {
             op->members = flecs_name_index_copy(op->members);
         }
     }
+
+    /* JSON serializer is compiled on first use */
+    dst->json = NULL;
 })
 
 static ECS_MOVE(EcsTypeSerializer, dst, src, {
     ecs_meta_dtor_serialized(dst);
     dst->ops = src->ops;
+    dst->json = src->json;
     src->ops = (ecs_vec_t){0};
+    src->json = NULL;
 })
 
 static ECS_DTOR(EcsTypeSerializer, ptr, { 
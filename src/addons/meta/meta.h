@@ -19,6 +19,16 @@ void ecs_meta_dtor_serialized(
 ecs_meta_type_op_kind_t flecs_meta_primitive_to_op_kind(
     ecs_primitive_kind_t kind);
 
+/* Get element type of an opaque type that stores its elements as a contiguous
+ * array of primitive values (see EcsOpaque::data). Returns 0 if the opaque type
+ * doesn't have a span interface. For arrays, array_count is set to the number
+ * of elements, for vectors it is set to 0. */
+ecs_entity_t flecs_meta_opaque_span_type(
+    const ecs_world_t *world,
+    const EcsOpaque *opaque,
+    ecs_size_t *elem_size,
+    int32_t *array_count);
+
 bool flecs_unit_validate(
     ecs_world_t *world,
     ecs_entity_t t,
@@ -34,6 +44,12 @@ int flecs_expr_ser_primitive(
     ecs_strbuf_t *str,
     bool is_expr);
 
+#ifdef FLECS_JSON
+/* Free JSON serializer plan. Implemented by the JSON addon. */
+void flecs_json_ser_plan_fini(
+    struct ecs_json_ser_plan_t *plan);
+#endif
+
 #endif
 
 #endif
@@ -296,4 +296,42 @@ void ecs_meta_type_serialized_init(
     }
 }
 
+ecs_entity_t flecs_meta_opaque_span_type(
+    const ecs_world_t *world,
+    const EcsOpaque *opaque,
+    ecs_size_t *elem_size,
+    int32_t *array_count)
+{
+    if (!opaque->data || !opaque->as_type) {
+        return 0;
+    }
+
+    ecs_entity_t elem_type;
+    const EcsArray *a = ecs_get(world, opaque->as_type, EcsArray);
+    if (a) {
+        elem_type = a->type;
+        *array_count = a->count;
+    } else {
+        const EcsVector *v = ecs_get(world, opaque->as_type, EcsVector);
+        if (!v || !opaque->count) {
+            return 0;
+        }
+        elem_type = v->type;
+        *array_count = 0;
+    }
+
+    /* Strings, entities and ids can't be copied as is */
+    const EcsPrimitive *p = ecs_get(world, elem_type, EcsPrimitive);
+    if (!p || p->kind == EcsString || p->kind == EcsEntity || 
+        p->kind == EcsId) 
+    {
+        return 0;
+    }
+
+    const EcsComponent *comp = ecs_get(world, elem_type, EcsComponent);
+    ecs_assert(comp != NULL, ECS_INTERNAL_ERROR, NULL);
+    *elem_size = comp->size;
+    return elem_type;
+}
+
 #endif
@@ -3,6 +3,12 @@
  * @brief Builtin implementation for OS API.
  */
 
+/* Required for thread affinity functions on Linux. Must be defined before any
+ * system header is included. */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "../../private_api.h"
 
 #ifdef FLECS_OS_API_IMPL
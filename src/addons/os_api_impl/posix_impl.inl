@@ -13,6 +13,17 @@
 #include <time.h>
 #endif
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#if !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 /* This mutex is used to emulate atomic operations when the gnu builtins are
  * not supported. This is probably not very fast but if the compiler doesn't
  * support the gnu built-ins, then speed is probably not a priority. */
@@ -51,6 +62,138 @@ ecs_os_thread_id_t posix_thread_self(void)
     return (ecs_os_thread_id_t)pthread_self();
 }
 
+static
+int posix_thread_set_affinity(
+    const int32_t *cpus,
+    int32_t count)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        if (cpus[i] < 0 || cpus[i] >= CPU_SETSIZE) {
+            return -1;
+        }
+        CPU_SET((size_t)cpus[i], &set);
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+#else
+    /* Not all platforms allow for pinning threads (like macOS) */
+    (void)cpus;
+    (void)count;
+    return -1;
+#endif
+}
+
+static
+int32_t posix_numa_node_cpus(
+    int32_t node,
+    int32_t *cpus_out,
+    int32_t size)
+{
+#if defined(__linux__)
+    char path[64];
+    snprintf(path, sizeof(path), 
+        "/sys/devices/system/node/node%d/cpulist", node);
+
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return -1;
+    }
+
+    /* Parse list with CPU ranges, like "0-15,32-47" */
+    char buf[1024];
+    char *ptr = fgets(buf, sizeof(buf), file);
+    fclose(file);
+    if (!ptr) {
+        return -1;
+    }
+
+    int32_t count = 0;
+    while (*ptr && *ptr != '\n') {
+        char *end;
+        long first = strtol(ptr, &end, 10), last = first;
+        if (end == ptr) {
+            return -1;
+        }
+
+        ptr = end;
+        if (*ptr == '-') {
+            ptr ++;
+            last = strtol(ptr, &end, 10);
+            if (end == ptr) {
+                return -1;
+            }
+            ptr = end;
+        }
+
+        long cpu;
+        for (cpu = first; cpu <= last; cpu ++) {
+            if (count < size) {
+                cpus_out[count] = (int32_t)cpu;
+            }
+            count ++;
+        }
+
+        if (*ptr == ',') {
+            ptr ++;
+        }
+    }
+
+    return count;
+#else
+    (void)node;
+    (void)cpus_out;
+    (void)size;
+    return -1;
+#endif
+}
+
+#if !defined(__EMSCRIPTEN__)
+static
+void* posix_file_map(
+    const char *filename,
+    ecs_size_t *size_out)
+{
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1) {
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) || !st.st_size || st.st_size > INT32_MAX) {
+        close(fd);
+        return NULL;
+    }
+
+    int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+    /* Contents is read front to back, so fault in all pages up front */
+    flags |= MAP_POPULATE;
+#endif
+
+    void *ptr = mmap(NULL, (size_t)st.st_size, PROT_READ, flags, fd, 0);
+    close(fd); /* Mapping remains valid after closing the file */
+    if (ptr == MAP_FAILED) {
+        return NULL;
+    }
+
+    *size_out = (ecs_size_t)st.st_size;
+    return ptr;
+}
+
+static
+void posix_file_unmap(
+    void *ptr,
+    ecs_size_t size)
+{
+    munmap(ptr, (size_t)size);
+}
+#endif
+
 static
 int32_t posix_ainc(
     int32_t *count)
@@ -131,6 +274,30 @@ int64_t posix_ladec(
 #endif
 }
 
+static
+bool posix_acas(
+    void **ptr,
+    void *old_value,
+    void *new_value)
+{
+#ifdef __GNUC__
+    return __sync_bool_compare_and_swap(ptr, old_value, new_value);
+#else
+    bool result = false;
+    if (pthread_mutex_lock(&atomic_mutex)) {
+	    abort();
+    }
+    if (*ptr == old_value) {
+        *ptr = new_value;
+        result = true;
+    }
+    if (pthread_mutex_unlock(&atomic_mutex)) {
+	    abort();
+    }
+    return result;
+#endif
+}
+
 static
 ecs_os_mutex_t posix_mutex_new(void) {
     pthread_mutex_t *mutex = ecs_os_malloc(sizeof(pthread_mutex_t));
@@ -308,10 +475,17 @@ void ecs_set_os_api_impl(void) {
     api.thread_self_ = posix_thread_self;
     api.task_new_ = posix_thread_new;
     api.task_join_ = posix_thread_join;
+    api.thread_set_affinity_ = posix_thread_set_affinity;
+    api.numa_node_cpus_ = posix_numa_node_cpus;
+#if !defined(__EMSCRIPTEN__)
+    api.file_map_ = posix_file_map;
+    api.file_unmap_ = posix_file_unmap;
+#endif
     api.ainc_ = posix_ainc;
     api.adec_ = posix_adec;
     api.lainc_ = posix_lainc;
     api.ladec_ = posix_ladec;
+    api.acas_ = posix_acas;
     api.mutex_new_ = posix_mutex_new;
     api.mutex_free_ = posix_mutex_free;
     api.mutex_lock_ = posix_mutex_lock;
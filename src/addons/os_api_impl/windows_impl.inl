@@ -57,6 +57,101 @@ ecs_os_thread_id_t win_thread_self(void)
     return (ecs_os_thread_id_t)GetCurrentThreadId();
 }
 
+/* Only supports CPUs in the processor group of the calling thread */
+static
+int win_thread_set_affinity(
+    const int32_t *cpus,
+    int32_t count)
+{
+    DWORD_PTR mask = 0;
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        if (cpus[i] < 0 || cpus[i] >= (int32_t)(sizeof(DWORD_PTR) * 8)) {
+            return -1;
+        }
+        mask |= (DWORD_PTR)1 << cpus[i];
+    }
+
+    if (!SetThreadAffinityMask(GetCurrentThread(), mask)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+static
+int32_t win_numa_node_cpus(
+    int32_t node,
+    int32_t *cpus_out,
+    int32_t size)
+{
+    ULONGLONG mask = 0;
+    if (node < 0 || node > 255) {
+        return -1;
+    }
+
+    if (!GetNumaNodeProcessorMask((UCHAR)node, &mask)) {
+        return -1;
+    }
+
+    int32_t cpu, count = 0;
+    for (cpu = 0; cpu < 64; cpu ++) {
+        if (mask & ((ULONGLONG)1 << cpu)) {
+            if (count < size) {
+                cpus_out[count] = cpu;
+            }
+            count ++;
+        }
+    }
+
+    return count;
+}
+
+static
+void* win_file_map(
+    const char *filename,
+    ecs_size_t *size_out)
+{
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || !size.QuadPart || 
+        size.QuadPart > INT32_MAX) 
+    {
+        CloseHandle(file);
+        return NULL;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) {
+        return NULL;
+    }
+
+    /* View keeps a reference to the mapping, so it can be closed here */
+    void *ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!ptr) {
+        return NULL;
+    }
+
+    *size_out = (ecs_size_t)size.QuadPart;
+    return ptr;
+}
+
+static
+void win_file_unmap(
+    void *ptr,
+    ecs_size_t size)
+{
+    (void)size;
+    UnmapViewOfFile(ptr);
+}
+
 static
 int32_t win_ainc(
     int32_t *count) 
@@ -85,6 +180,16 @@ int64_t win_ladec(
     return InterlockedDecrement64(count);
 }
 
+static
+bool win_acas(
+    void **ptr,
+    void *old_value,
+    void *new_value)
+{
+    return InterlockedCompareExchangePointer(
+        (PVOID volatile*)ptr, new_value, old_value) == old_value;
+}
+
 static
 ecs_os_mutex_t win_mutex_new(void) {
     CRITICAL_SECTION *mutex = ecs_os_malloc_t(CRITICAL_SECTION);
@@ -266,10 +371,15 @@ void ecs_set_os_api_impl(void) {
     api.thread_self_ = win_thread_self;
     api.task_new_ = win_thread_new;
     api.task_join_ = win_thread_join;
+    api.thread_set_affinity_ = win_thread_set_affinity;
+    api.numa_node_cpus_ = win_numa_node_cpus;
+    api.file_map_ = win_file_map;
+    api.file_unmap_ = win_file_unmap;
     api.ainc_ = win_ainc;
     api.adec_ = win_adec;
     api.lainc_ = win_lainc;
     api.ladec_ = win_ladec;
+    api.acas_ = win_acas;
     api.mutex_new_ = win_mutex_new;
     api.mutex_free_ = win_mutex_free;
     api.mutex_lock_ = win_mutex_lock;
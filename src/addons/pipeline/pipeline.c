@@ -8,6 +8,7 @@
 
 #ifdef FLECS_PIPELINE
 #include "pipeline.h"
+#include "../timeline/timeline.h"
 
 static void flecs_pipeline_free(
     ecs_pipeline_state_t *p) 
@@ -17,6 +18,7 @@ static void flecs_pipeline_free(
         ecs_allocator_t *a = &world->allocator;
         ecs_vec_fini_t(a, &p->ops, ecs_pipeline_op_t);
         ecs_vec_fini_t(a, &p->systems, ecs_entity_t);
+        ecs_vec_fini_t(a, &p->entries, ecs_pipeline_entry_t);
         ecs_os_free(p->iters);
         ecs_query_fini(p->query);
         ecs_os_free(p);
@@ -251,153 +253,349 @@ EcsPoly* flecs_pipeline_term_system(
     return poly;
 }
 
+/* Hash the term data that determines how a system is scheduled. This detects
+ * systems that were recreated with a different query, even if the allocator
+ * handed out the same system and query addresses. */
 static
-bool flecs_pipeline_build(
+uint64_t flecs_pipeline_query_hash(
+    const ecs_query_t *query)
+{
+    uint64_t hash = 0;
+    int32_t t, term_count = query->term_count;
+    for (t = 0; t < term_count; t ++) {
+        const ecs_term_t *term = &query->terms[t];
+        uint64_t data[5] = { hash, term->id, term->src.id, 
+            (uint64_t)term->inout, (uint64_t)term->oper };
+        hash = flecs_hash(data, ECS_SIZEOF(data));
+    }
+    return hash;
+}
+
+static
+bool flecs_pipeline_entry_eq(
+    const ecs_pipeline_entry_t *e1,
+    const ecs_pipeline_entry_t *e2)
+{
+    return e1->system == e2->system && e1->sys == e2->sys &&
+        e1->query == e2->query && e1->query_hash == e2->query_hash &&
+        e1->active == e2->active && 
+        e1->sys_multi_threaded == e2->sys_multi_threaded &&
+        e1->sys_immediate == e2->sys_immediate;
+}
+
+static
+bool flecs_pipeline_entry_state_eq(
+    const ecs_pipeline_entry_t *e1,
+    const ecs_pipeline_entry_t *e2)
+{
+    return e1->merge == e2->merge &&
+        e1->multi_threaded == e2->multi_threaded &&
+        e1->immediate == e2->immediate &&
+        e1->first == e2->first;
+}
+
+static
+void flecs_pipeline_entry_copy_state(
+    ecs_pipeline_entry_t *dst,
+    const ecs_pipeline_entry_t *src)
+{
+    dst->merge = src->merge;
+    dst->multi_threaded = src->multi_threaded;
+    dst->immediate = src->immediate;
+    dst->first = src->first;
+}
+
+/* Collect systems in the order in which the pipeline query returns them */
+static
+void flecs_pipeline_collect(
     ecs_world_t *world,
-    ecs_pipeline_state_t *pq)
+    ecs_iter_t *it,
+    ecs_vec_t *entries)
 {
-    ecs_iter_t it = ecs_query_iter(world, pq->query);
+    ecs_allocator_t *a = &world->allocator;
+    while (ecs_query_next(it)) {
+        EcsPoly *poly = flecs_pipeline_term_system(it);
+        bool is_active = ecs_table_get_type_index(
+            world, it->table, EcsEmpty) == -1;
 
-    int32_t new_match_count = ecs_query_match_count(pq->query);
-    if (pq->match_count == new_match_count) {
-        /* No need to rebuild the pipeline */
-        ecs_iter_fini(&it);
-        return false;
+        int32_t i;
+        for (i = 0; i < it->count; i ++) {
+            flecs_poly_assert(poly[i].poly, ecs_system_t);
+            ecs_system_t *sys = (ecs_system_t*)poly[i].poly;
+            ecs_pipeline_entry_t *e = ecs_vec_append_t(
+                a, entries, ecs_pipeline_entry_t);
+            ecs_os_zeromem(e);
+            e->system = it->entities[i];
+            e->sys = sys;
+            e->query = sys->query;
+            e->query_hash = flecs_pipeline_query_hash(sys->query);
+            e->active = is_active;
+            e->sys_multi_threaded = sys->multi_threaded;
+            e->sys_immediate = sys->immediate;
+        }
     }
+}
 
-    world->info.pipeline_build_count_total ++;
-    pq->rebuild_count ++;
-
+/* Compute where merges must be inserted. Write state is reset at each merge,
+ * which means that the schedule after a merge only depends on the systems that
+ * come after it. Systems that come before the last merge preceding the first
+ * changed system keep their schedule, and scheduling stops when it has caught 
+ * up with the previous schedule after the last changed system. Returns the
+ * number of systems for which terms were checked. */
+static
+int32_t flecs_pipeline_schedule(
+    ecs_world_t *world,
+    const ecs_vec_t *prev_entries,
+    ecs_vec_t *entries)
+{
     ecs_allocator_t *a = &world->allocator;
-    ecs_pipeline_op_t *op = NULL;
+    int32_t prev_count = ecs_vec_count(prev_entries);
+    int32_t count = ecs_vec_count(entries);
+    const ecs_pipeline_entry_t *prev = ecs_vec_first_t(
+        prev_entries, ecs_pipeline_entry_t);
+    ecs_pipeline_entry_t *cur = ecs_vec_first_t(entries, ecs_pipeline_entry_t);
+
+    /* Find number of unchanged systems at start and end of the pipeline */
+    int32_t head = 0, tail = 0, max = ECS_MIN(prev_count, count);
+    while (head < max && flecs_pipeline_entry_eq(&prev[head], &cur[head])) {
+        head ++;
+    }
+    while (tail < (max - head) && flecs_pipeline_entry_eq(
+        &prev[prev_count - tail - 1], &cur[count - tail - 1])) 
+    {
+        tail ++;
+    }
+
+    /* Find last merge in unchanged part */
+    int32_t start = head - 1;
+    while (start >= 0 && !prev[start].merge) {
+        start --;
+    }
+
     ecs_write_state_t ws = {0};
     ecs_map_init(&ws.ids, a);
     ecs_map_init(&ws.wildcard_ids, a);
 
-    ecs_vec_reset_t(a, &pq->ops, ecs_pipeline_op_t);
-    ecs_vec_reset_t(a, &pq->systems, ecs_entity_t);
-
     bool multi_threaded = false;
     bool immediate = false;
     bool first = true;
+    int32_t i, checked = 0;
 
-    /* Iterate systems in pipeline, add ops for running / merging */
-    while (ecs_query_next(&it)) {
-        EcsPoly *poly = flecs_pipeline_term_system(&it);
-        bool is_active = ecs_table_get_type_index(
-            world, it.table, EcsEmpty) == -1;
-
-        int32_t i;
-        for (i = 0; i < it.count; i ++) {
-            flecs_poly_assert(poly[i].poly, ecs_system_t);
-            ecs_system_t *sys = (ecs_system_t*)poly[i].poly;
-            ecs_query_t *q = sys->query;
+    if (start >= 0) {
+        /* Reuse schedule up to and including the merge */
+        for (i = 0; i <= start; i ++) {
+            flecs_pipeline_entry_copy_state(&cur[i], &prev[i]);
+        }
 
-            bool needs_merge = false;
-            needs_merge = flecs_pipeline_check_terms(
-                world, q, is_active, &ws);
+        multi_threaded = prev[start].multi_threaded;
+        immediate = prev[start].immediate;
+        first = prev[start].first;
 
-            if (is_active) {
-                if (first) {
-                    multi_threaded = sys->multi_threaded;
-                    immediate = sys->immediate;
-                    first = false;
-                }
+        /* Write state after a merge only contains what the system writes */
+        if (cur[start].active) {
+            flecs_pipeline_check_terms(world, cur[start].sys->query, true, &ws);
+            checked ++;
+        }
+    }
 
-                if (sys->multi_threaded != multi_threaded) {
-                    needs_merge = true;
-                    multi_threaded = sys->multi_threaded;
-                }
-                if (sys->immediate != immediate) {
-                    needs_merge = true;
-                    immediate = sys->immediate;
-                }
+    for (i = start + 1; i < count; i ++) {
+        ecs_pipeline_entry_t *e = &cur[i];
+        ecs_system_t *sys = e->sys;
+        ecs_query_t *q = sys->query;
+        bool is_active = e->active;
+
+        bool needs_merge = false;
+        needs_merge = flecs_pipeline_check_terms(
+            world, q, is_active, &ws);
+        checked ++;
+
+        if (is_active) {
+            if (first) {
+                multi_threaded = sys->multi_threaded;
+                immediate = sys->immediate;
+                first = false;
             }
 
-            if (immediate) {
+            if (sys->multi_threaded != multi_threaded) {
+                needs_merge = true;
+                multi_threaded = sys->multi_threaded;
+            }
+            if (sys->immediate != immediate) {
                 needs_merge = true;
+                immediate = sys->immediate;
             }
+        }
 
-            if (needs_merge) {
-                /* After merge all components will be merged, so reset state */
-                flecs_pipeline_reset_write_state(&ws);
-
-                /* An inactive system can insert a merge if one of its 
-                 * components got written, which could make the system 
-                 * active. If this is the only system in the pipeline operation,
-                 * it results in an empty operation when we get here. If that's
-                 * the case, reuse the empty operation for the next op. */
-                if (op && op->count) {
-                    op = NULL;
-                }
+        if (immediate) {
+            needs_merge = true;
+        }
 
-                /* Re-evaluate columns to set write flags if system is active.
-                 * If system is inactive, it can't write anything and so it
-                 * should not insert unnecessary merges.  */
-                needs_merge = false;
-                if (is_active) {
-                    needs_merge = flecs_pipeline_check_terms(
-                        world, q, true, &ws);
-                }
+        if (needs_merge) {
+            /* After merge all components will be merged, so reset state */
+            flecs_pipeline_reset_write_state(&ws);
 
-                /* The component states were just reset, so if we conclude that
-                 * another merge is needed something is wrong. */
-                ecs_assert(needs_merge == false, ECS_INTERNAL_ERROR, NULL);        
+            /* Re-evaluate columns to set write flags if system is active.
+             * If system is inactive, it can't write anything and so it
+             * should not insert unnecessary merges.  */
+            needs_merge = false;
+            if (is_active) {
+                needs_merge = flecs_pipeline_check_terms(
+                    world, q, true, &ws);
             }
 
-            if (!op) {
-                op = ecs_vec_append_t(a, &pq->ops, ecs_pipeline_op_t);
-                op->offset = ecs_vec_count(&pq->systems);
-                op->count = 0;
-                op->multi_threaded = false;
-                op->immediate = false;
-                op->time_spent = 0;
-                op->commands_enqueued = 0;
-            }
+            /* The component states were just reset, so if we conclude that
+             * another merge is needed something is wrong. */
+            ecs_assert(needs_merge == false, ECS_INTERNAL_ERROR, NULL);
 
-            /* Don't increase count for inactive systems, as they are ignored by
-             * the query used to run the pipeline. */
-            if (is_active) {
-                ecs_vec_append_t(a, &pq->systems, ecs_entity_t)[0] = 
-                    it.entities[i];
-                if (!op->count) {
-                    op->multi_threaded = multi_threaded;
-                    op->immediate = immediate;
+            e->merge = true;
+        }
+
+        e->multi_threaded = multi_threaded;
+        e->immediate = immediate;
+        e->first = first;
+
+        /* If a merge is inserted at the same system as in the previous 
+         * schedule and nothing changes after it, the remainder of the previous
+         * schedule can be reused. */
+        if (e->merge && i >= (count - tail)) {
+            int32_t prev_i = i - count + prev_count;
+            if (flecs_pipeline_entry_state_eq(e, &prev[prev_i])) {
+                for (i ++, prev_i ++; i < count; i ++, prev_i ++) {
+                    flecs_pipeline_entry_copy_state(&cur[i], &prev[prev_i]);
                 }
-                op->count ++;
+                break;
+            }
+        }
+    }
+
+    ecs_map_fini(&ws.ids);
+    ecs_map_fini(&ws.wildcard_ids);
+
+    return checked;
+}
+
+/* Convert schedule into operations for running and merging systems */
+static
+void flecs_pipeline_build_ops(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_pipeline_op_t *op = NULL;
+
+    ecs_vec_reset_t(a, &pq->ops, ecs_pipeline_op_t);
+    ecs_vec_reset_t(a, &pq->systems, ecs_entity_t);
+
+    int32_t i, count = ecs_vec_count(&pq->entries);
+    ecs_pipeline_entry_t *entries = ecs_vec_first_t(
+        &pq->entries, ecs_pipeline_entry_t);
+    for (i = 0; i < count; i ++) {
+        ecs_pipeline_entry_t *e = &entries[i];
+
+        /* An inactive system can insert a merge if one of its components got 
+         * written, which could make the system active. If this is the only 
+         * system in the pipeline operation, it results in an empty operation 
+         * when we get here. If that's the case, reuse the empty operation for 
+         * the next op. */
+        if (e->merge && op && op->count) {
+            op = NULL;
+        }
+
+        if (!op) {
+            op = ecs_vec_append_t(a, &pq->ops, ecs_pipeline_op_t);
+            op->offset = ecs_vec_count(&pq->systems);
+            op->count = 0;
+            op->multi_threaded = false;
+            op->immediate = false;
+            op->time_spent = 0;
+            op->commands_enqueued = 0;
+        }
+
+        /* Don't increase count for inactive systems, as they are ignored by
+         * the query used to run the pipeline. */
+        if (e->active) {
+            ecs_vec_append_t(a, &pq->systems, ecs_entity_t)[0] = e->system;
+            if (!op->count) {
+                op->multi_threaded = e->multi_threaded;
+                op->immediate = e->immediate;
             }
+            op->count ++;
         }
     }
 
     if (op && !op->count && ecs_vec_count(&pq->ops) > 1) {
         ecs_vec_remove_last(&pq->ops);
     }
+}
 
-    ecs_map_fini(&ws.ids);
-    ecs_map_fini(&ws.wildcard_ids);
+static
+bool flecs_pipeline_build(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq)
+{
+    /* Creating the iterator updates the query cache, so do this before
+     * checking the match count */
+    ecs_iter_t it = ecs_query_iter(world, pq->query);
 
-    op = ecs_vec_first_t(&pq->ops, ecs_pipeline_op_t);
+    int32_t new_match_count = ecs_query_match_count(pq->query);
+    if (pq->match_count == new_match_count) {
+        /* No need to rebuild the pipeline */
+        ecs_iter_fini(&it);
+        return false;
+    }
+
+    world->info.pipeline_build_count_total ++;
+    pq->rebuild_count ++;
+
+    ecs_time_t t = {0};
+    bool measure_time = world->flags & EcsWorldMeasureSystemTime;
+    if (measure_time) {
+        ecs_time_measure(&t);
+    }
+
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t entries;
+    ecs_vec_init_t(a, &entries, ecs_pipeline_entry_t, 
+        ecs_vec_count(&pq->entries));
+    flecs_pipeline_collect(world, &it, &entries);
+
+    int32_t checked = flecs_pipeline_schedule(world, &pq->entries, &entries);
+    if (checked < ecs_vec_count(&entries)) {
+        pq->rebuild_incremental_count ++;
+    }
+    pq->rebuild_system_count = checked;
+
+    ecs_vec_fini_t(a, &pq->entries, ecs_pipeline_entry_t);
+    pq->entries = entries;
+
+    flecs_pipeline_build_ops(world, pq);
+
+    ecs_pipeline_op_t *op = ecs_vec_first_t(&pq->ops, ecs_pipeline_op_t);
 
     if (!op) {
         ecs_dbg("#[green]pipeline#[reset] is empty");
         return true;
     } else {
         /* Add schedule to debug tracing */
-        ecs_dbg("#[bold]pipeline rebuild");
+        ecs_dbg("#[bold]pipeline rebuild (%d systems checked)", checked);
         ecs_log_push_1();
 
         ecs_dbg("#[green]schedule#[reset]: threading: %d, staging: %d:", 
             op->multi_threaded, !op->immediate);
         ecs_log_push_1();
 
-        int32_t i, count = ecs_vec_count(&pq->systems);
+        int32_t i = 0, e, count = ecs_vec_count(&pq->entries);
         int32_t op_index = 0, ran_since_merge = 0;
-        ecs_entity_t *systems = ecs_vec_first_t(&pq->systems, ecs_entity_t);
-        for (i = 0; i < count; i ++) {
-            ecs_entity_t system = systems[i];
-            const EcsPoly *poly = ecs_get_pair(world, system, EcsPoly, EcsSystem);
-            flecs_poly_assert(poly->poly, ecs_system_t);
-            ecs_system_t *sys = (ecs_system_t*)poly->poly;
+        ecs_pipeline_entry_t *log_entries = ecs_vec_first_t(
+            &pq->entries, ecs_pipeline_entry_t);
+        for (e = 0; e < count; e ++) {
+            if (!log_entries[e].active) {
+                continue;
+            }
+
+            ecs_entity_t system = log_entries[e].system;
+            ecs_system_t *sys = log_entries[e].sys;
+            (void)system;
 
 #ifdef FLECS_LOG_1
             char *path = ecs_get_path(world, system);
@@ -445,6 +643,8 @@ bool flecs_pipeline_build(
                     pq->cur_i = 0;
                 }
             }
+
+            i ++;
         }
 
         ecs_log_pop_1();
@@ -453,6 +653,10 @@ bool flecs_pipeline_build(
 
     pq->match_count = new_match_count;
 
+    if (measure_time) {
+        pq->rebuild_time_spent += ecs_time_measure(&t);
+    }
+
     ecs_assert(pq->cur_op <= ecs_vec_last_t(&pq->ops, ecs_pipeline_op_t),
         ECS_INTERNAL_ERROR, NULL);
 
@@ -489,6 +693,13 @@ bool flecs_pipeline_update(
      * notify appropriate queries so caches are up to date. This includes the
      * pipeline query. */
     if (start_of_frame) {
+        /* Create system for async observers the first time one is used */
+        if (!world->async_system && 
+            ecs_vec_count(&world->store.async_observers)) 
+        {
+            ecs_set_async_observer_phase(world, 0);
+        }
+
         ecs_run_aperiodic(world, 0);
     }
 
@@ -666,7 +877,10 @@ void flecs_run_pipeline(
                 pq->cur_op->commands_enqueued += ecs_vec_count(&s->cmd->queue);
             }
 
+            flecs_timeline_begin(stage);
             ecs_readonly_end(world);
+            flecs_timeline_end(stage, EcsTimelineMerge, 0, 0, 1);
+
             if (measure_time) {
                 pq->cur_op->time_spent += ecs_time_measure(&mt);
             }
@@ -810,6 +1024,102 @@ error:
     return 0;
 }
 
+static
+void flecs_async_flush_system(
+    ecs_iter_t *it)
+{
+    ecs_async_flush(it->world);
+}
+
+void ecs_set_async_flush_phase(
+    ecs_world_t *world,
+    ecs_entity_t phase)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION, 
+        "cannot set async flush phase while world is in readonly mode");
+
+    ecs_entity_t module = ecs_get_parent(world, ecs_id(EcsPipeline));
+    ecs_entity_t system = ecs_lookup_child(world, module, "AsyncFlush");
+    if (system) {
+        ecs_delete(world, system);
+    }
+
+    if (!phase) {
+        ECS_BIT_CLEAR(world->flags, EcsWorldNoAsyncFlush);
+        return;
+    }
+
+    ecs_check(ecs_has_id(world, phase, EcsPhase), ECS_INVALID_PARAMETER,
+        "entity passed to ecs_set_async_flush_phase is not a phase");
+
+    /* Flush async commands from an immediate system. This inserts a sync
+     * point before the system, and ensures that the commands are merged before
+     * systems in the next phase run. */
+    system = ecs_system(world, {
+        .entity = ecs_entity(world, { 
+            .parent = module,
+            .name = "AsyncFlush",
+            .add = ecs_ids( ecs_dependson(phase) )
+        }),
+        .callback = flecs_async_flush_system,
+        .immediate = true
+    });
+    ecs_assert(system != 0, ECS_INTERNAL_ERROR, NULL);
+
+    ECS_BIT_SET(world->flags, EcsWorldNoAsyncFlush);
+error:
+    return;
+}
+
+static
+void flecs_async_observers_system(
+    ecs_iter_t *it)
+{
+    ecs_world_t *world = it->real_world;
+    int32_t stage_index = 0, stage_count = 1;
+    if (world->flags & EcsWorldMultiThreaded) {
+        stage_index = ecs_stage_get_id(it->world);
+        stage_count = ecs_get_stage_count(world);
+    }
+
+    flecs_observers_run_async(it->world, stage_index, stage_count);
+}
+
+void ecs_set_async_observer_phase(
+    ecs_world_t *world,
+    ecs_entity_t phase)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION, 
+        "cannot set async observer phase while world is in readonly mode");
+
+    if (!phase) {
+        phase = EcsPostUpdate;
+    }
+
+    ecs_check(ecs_has_id(world, phase, EcsPhase), ECS_INVALID_PARAMETER,
+        "entity passed to ecs_set_async_observer_phase is not a phase");
+
+    if (world->async_system && ecs_is_alive(world, world->async_system)) {
+        ecs_delete(world, world->async_system);
+    }
+
+    ecs_entity_t module = ecs_get_parent(world, ecs_id(EcsPipeline));
+    world->async_system = ecs_system(world, {
+        .entity = ecs_entity(world, { 
+            .parent = module,
+            .name = "AsyncObservers",
+            .add = ecs_ids( ecs_dependson(phase) )
+        }),
+        .callback = flecs_async_observers_system,
+        .multi_threaded = true
+    });
+    ecs_assert(world->async_system != 0, ECS_INTERNAL_ERROR, NULL);
+error:
+    return;
+}
+
 ecs_entity_t ecs_pipeline_init(
     ecs_world_t *world,
     const ecs_pipeline_desc_t *desc)
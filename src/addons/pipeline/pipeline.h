@@ -19,15 +19,37 @@ typedef struct ecs_pipeline_op_t {
     bool immediate;           /* Whether systems are staged or not */
 } ecs_pipeline_op_t;
 
+/** Schedule data for a system in the pipeline.
+ * This type is the element type in the "entries" vector of a pipeline, which
+ * contains both active and inactive systems. It is used to find which part of
+ * the schedule needs to be recomputed when the pipeline is rebuilt. */
+typedef struct ecs_pipeline_entry_t {
+    ecs_entity_t system;        /* System entity */
+    ecs_system_t *sys;          /* System object */
+    ecs_query_t *query;         /* System query */
+    uint64_t query_hash;        /* Hash of term data used for scheduling */
+    bool active;                /* Whether the system is active */
+    bool sys_multi_threaded;    /* Value of system multi_threaded flag */
+    bool sys_immediate;         /* Value of system immediate flag */
+    bool merge;                 /* Whether a merge is inserted before system */
+    bool multi_threaded;        /* Schedule threading state after system */
+    bool immediate;             /* Schedule staging state after system */
+    bool first;                 /* No active system up to and including this */
+} ecs_pipeline_entry_t;
+
 struct ecs_pipeline_state_t {
     ecs_query_t *query;         /* Pipeline query */
     ecs_vec_t ops;              /* Pipeline schedule */
     ecs_vec_t systems;          /* Vector with system ids */
+    ecs_vec_t entries;          /* Schedule data for all matched systems */
 
     ecs_entity_t last_system;   /* Last system ran by pipeline */
     ecs_id_record_t *idr_inactive; /* Cached record for quick inactive test */
     int32_t match_count;        /* Used to track of rebuild is necessary */
     int32_t rebuild_count;      /* Number of pipeline rebuilds */
+    int32_t rebuild_incremental_count; /* Rebuilds that reused schedule */
+    int32_t rebuild_system_count; /* Systems checked during last rebuild */
+    double rebuild_time_spent;  /* Time spent rebuilding pipeline */
     ecs_iter_t *iters;          /* Iterator for worker(s) */
     int32_t iter_count;
 
@@ -8,17 +8,21 @@
 
 #ifdef FLECS_PIPELINE
 #include "pipeline.h"
+#include "../timeline/timeline.h"
 
 /* Synchronize workers */
 static
 void flecs_sync_worker(
-    ecs_world_t* world)
+    ecs_stage_t *stage)
 {
+    ecs_world_t *world = stage->world;
     int32_t stage_count = ecs_get_stage_count(world);
     if (stage_count <= 1) {
         return;
     }
 
+    flecs_timeline_begin(stage);
+
     /* Signal that thread is waiting */
     ecs_os_mutex_lock(world->sync_mutex);
     if (++world->workers_waiting == (stage_count - 1)) {
@@ -29,6 +33,25 @@ void flecs_sync_worker(
     /* Wait until main thread signals that thread can continue */
     ecs_os_cond_wait(world->worker_cond, world->sync_mutex);
     ecs_os_mutex_unlock(world->sync_mutex);
+
+    flecs_timeline_end(stage, EcsTimelineSync, 0, stage->id, stage_count);
+}
+
+/* Pin calling thread to the CPUs of the stage */
+static
+void flecs_stage_apply_affinity(
+    ecs_stage_t *stage)
+{
+    stage->cpus_changed = false;
+    if (!stage->cpu_count) {
+        return;
+    }
+
+    if (ecs_os_thread_set_affinity(stage->cpus, stage->cpu_count)) {
+        ecs_warn("failed to set affinity for thread of stage %d", stage->id);
+    } else {
+        ecs_dbg_2("worker %d: pinned to %d cpus", stage->id, stage->cpu_count);
+    }
 }
 
 /* Worker thread */
@@ -42,6 +65,12 @@ void* flecs_worker(void *arg) {
 
     ecs_dbg_2("worker %d: start", stage->id);
 
+    /* Apply affinity if it was set before the thread started. Task threads
+     * can run on a different thread each frame, so the affinity is always
+     * (re)applied here. Stage memory is created on the main thread by
+     * flecs_stage_new, so pinning doesn't change where it is allocated. */
+    flecs_stage_apply_affinity(stage);
+
     /* Start worker, increase counter so main thread knows how many
      * workers are ready */
     ecs_os_mutex_lock(world->sync_mutex);
@@ -54,6 +83,10 @@ void* flecs_worker(void *arg) {
     ecs_os_mutex_unlock(world->sync_mutex);
 
     while (!(world->flags & EcsWorldQuitWorkers)) {
+        if (stage->cpus_changed) {
+            flecs_stage_apply_affinity(stage);
+        }
+
         ecs_entity_t old_scope = ecs_set_scope((ecs_world_t*)stage, 0);
 
         ecs_dbg_3("worker %d: run", stage->id);
@@ -62,7 +95,7 @@ void* flecs_worker(void *arg) {
 
         ecs_set_scope((ecs_world_t*)stage, old_scope);
 
-        flecs_sync_worker(world);
+        flecs_sync_worker(stage);
     }
 
     ecs_dbg_2("worker %d: finalizing", stage->id);
@@ -149,6 +182,8 @@ void flecs_wait_for_sync(
 
     ecs_dbg_3("#[bold]pipeline: waiting for worker sync");
 
+    flecs_timeline_begin(world->stages[0]);
+
     ecs_os_mutex_lock(world->sync_mutex);
     if (world->workers_waiting != (stage_count - 1)) {
         ecs_os_cond_wait(world->sync_cond, world->sync_mutex);
@@ -161,6 +196,8 @@ void flecs_wait_for_sync(
     world->workers_waiting = 0;
     ecs_os_mutex_unlock(world->sync_mutex);
 
+    flecs_timeline_end(world->stages[0], EcsTimelineSync, 0, 0, stage_count);
+
     ecs_dbg_3("#[bold]pipeline: workers synced");
 }
 
@@ -238,6 +275,10 @@ void flecs_workers_progress(
 
     /* Run pipeline on main thread */
     ecs_world_t *stage = ecs_get_stage(world, 0);
+    if (world->stages[0]->cpus_changed) {
+        flecs_stage_apply_affinity(world->stages[0]);
+    }
+
     ecs_entity_t old_scope = ecs_set_scope((ecs_world_t*)stage, 0);
     flecs_run_pipeline(stage, pq, delta_time);
     ecs_set_scope((ecs_world_t*)stage, old_scope);
@@ -308,4 +349,84 @@ bool ecs_using_task_threads(
     return world->workers_use_task_api;
 }
 
+int ecs_set_stage_affinity(
+    ecs_world_t *world,
+    int32_t stage_id,
+    const int32_t *cpus,
+    int32_t count)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(stage_id >= 0 && stage_id < world->stage_count,
+        ECS_INVALID_PARAMETER, "invalid stage id");
+    ecs_check(count >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || cpus != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION,
+        "cannot set stage affinity while world is progressing");
+
+    if (count && !ecs_os_has_thread_affinity()) {
+        ecs_err("cannot set stage affinity: OS API does not support affinity");
+        goto error;
+    }
+
+    ecs_stage_t *stage = world->stages[stage_id];
+    ecs_os_free(stage->cpus);
+    stage->cpus = NULL;
+    stage->cpu_count = count;
+    stage->numa_node = -1;
+
+    if (count) {
+        ecs_size_t size = count * ECS_SIZEOF(int32_t);
+        stage->cpus = ecs_os_memdup(cpus, size);
+        stage->cpus_changed = true;
+    }
+
+    return 0;
+error:
+    return -1;
+}
+
+int ecs_set_stage_numa_node(
+    ecs_world_t *world,
+    int32_t stage_id,
+    int32_t node)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(node >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(ecs_os_api.numa_node_cpus_ != NULL, ECS_MISSING_OS_API,
+        "numa_node_cpus");
+
+    /* First call obtains the number of CPUs of the node */
+    int32_t count = ecs_os_numa_node_cpus(node, NULL, 0);
+    if (count <= 0) {
+        ecs_err("cannot find cpus for numa node %d", node);
+        goto error;
+    }
+
+    int32_t *cpus = ecs_os_malloc_n(int32_t, count);
+    count = ecs_os_numa_node_cpus(node, cpus, count);
+    int result = ecs_set_stage_affinity(world, stage_id, cpus, count);
+    ecs_os_free(cpus);
+    if (result) {
+        goto error;
+    }
+
+    world->stages[stage_id]->numa_node = node;
+
+    return 0;
+error:
+    return -1;
+}
+
+int32_t ecs_get_stage_numa_node(
+    const ecs_world_t *world,
+    int32_t stage_id)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(stage_id >= 0 && stage_id < world->stage_count,
+        ECS_INVALID_PARAMETER, "invalid stage id");
+    return world->stages[stage_id]->numa_node;
+error:
+    return -1;
+}
+
 #endif
@@ -13,6 +13,9 @@
 /* Retain captured commands for one minute at 60 FPS */
 #define FLECS_REST_COMMAND_RETAIN_COUNT (60 * 60)
 
+/* Content type of query results in binary format */
+#define FLECS_REST_BINARY_CONTENT_TYPE "application/octet-stream"
+
 static ECS_TAG_DECLARE(EcsRestPlecs);
 
 typedef struct {
@@ -159,6 +162,27 @@ void flecs_rest_string_param(
     }
 }
 
+#ifdef FLECS_BINARY
+/* Binary query results are requested with format=binary, or by a client that
+ * accepts the binary content type. */
+static
+bool flecs_rest_binary_requested(
+    const ecs_http_request_t *req)
+{
+    const char *format = ecs_http_get_param(req, "format");
+    if (format) {
+        return !ecs_os_strcmp(format, "binary");
+    }
+
+    const char *accept_hdr = ecs_http_get_header(req, "Accept");
+    if (accept_hdr) {
+        return strstr(accept_hdr, FLECS_REST_BINARY_CONTENT_TYPE) != NULL;
+    }
+
+    return false;
+}
+#endif
+
 static
 void flecs_rest_parse_json_ser_entity_params(
     ecs_world_t *world,
@@ -585,6 +609,19 @@ void flecs_rest_iter_to_reply(
     }
 
     ecs_iter_t pit = ecs_page_iter(it, offset, limit);
+
+#ifdef FLECS_BINARY
+    if (flecs_rest_binary_requested(req)) {
+        reply->content_type = FLECS_REST_BINARY_CONTENT_TYPE;
+        if (ecs_iter_to_binary_buf(&pit, &reply->body)) {
+            ecs_strbuf_reset(&reply->body);
+            reply->content_type = "application/json";
+            flecs_rest_reply_set_captured_log(reply);
+        }
+        return;
+    }
+#endif
+
     if (ecs_iter_to_json_buf(&pit, &reply->body, &desc)) {
         flecs_rest_reply_set_captured_log(reply);
     }
@@ -837,6 +874,7 @@ void flecs_world_stats_to_json(
     ECS_GAUGE_APPEND(reply, stats, queries.query_count, "Queries in the world");
     ECS_GAUGE_APPEND(reply, stats, queries.observer_count, "Observers in the world");
     ECS_GAUGE_APPEND(reply, stats, queries.system_count, "Systems in the world");
+    ECS_GAUGE_APPEND(reply, stats, queries.async_event_count, "Events queued for async observers");
 
     ECS_COUNTER_APPEND(reply, stats, memory.alloc_count, "Allocations by OS API");
     ECS_COUNTER_APPEND(reply, stats, memory.realloc_count, "Reallocs by OS API");
@@ -1431,6 +1469,37 @@ bool flecs_rest_get_commands_request(
     return true;
 }
 
+#ifdef FLECS_TIMELINE
+static
+bool flecs_rest_get_timeline(
+    ecs_world_t *world,
+    const ecs_http_request_t* req,
+    ecs_http_reply_t *reply)
+{
+    (void)req;
+
+    if (ecs_timeline_to_json_buf(world, &reply->body)) {
+        flecs_reply_error(reply, "timeline recording is not enabled");
+        reply->code = 400;
+    }
+
+    return true;
+}
+#else
+static
+bool flecs_rest_get_timeline(
+    ecs_world_t *world,
+    const ecs_http_request_t* req,
+    ecs_http_reply_t *reply)
+{
+    (void)world;
+    (void)req;
+    flecs_reply_error(reply, "timeline addon is not available");
+    reply->code = 400;
+    return true;
+}
+#endif
+
 static
 bool flecs_rest_reply(
     const ecs_http_request_t* req,
@@ -1479,6 +1548,10 @@ bool flecs_rest_reply(
         /* Commands request endpoint (request commands from specific frame) */
         } else if (!ecs_os_strncmp(req->path, "commands/frame/", 15)) {
             return flecs_rest_get_commands_request(world, impl, req, reply);
+
+        /* Timeline endpoint */
+        } else if (!ecs_os_strcmp(req->path, "timeline")) {
+            return flecs_rest_get_timeline(world, req, reply);
         }
 
     } else if (req->method == EcsHttpPut) {
@@ -208,6 +208,38 @@ int expr_ser_vector(
     return expr_ser_type_elements(world, v->type, array, count, str, false);
 }
 
+/* Serialize opaque type. Only opaque types that store their elements as a
+ * contiguous array of primitive values can be serialized to an expression. */
+static
+int expr_ser_opaque(
+    const ecs_world_t *world,
+    ecs_meta_type_op_t *op, 
+    const void *ptr, 
+    ecs_strbuf_t *str) 
+{
+    const EcsOpaque *ct = ecs_get(world, op->type, EcsOpaque);
+    ecs_assert(ct != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_size_t elem_size;
+    int32_t count;
+    ecs_entity_t elem_type = flecs_meta_opaque_span_type(
+        world, ct, &elem_size, &count);
+    if (!elem_type) {
+        char *path = ecs_get_path(world, op->type);
+        ecs_err("cannot serialize opaque type '%s' to expression", path);
+        ecs_os_free(path);
+        return -1;
+    }
+
+    bool is_array = count != 0;
+    if (!is_array) {
+        count = flecs_uto(int32_t, ct->count(ptr));
+    }
+
+    return expr_ser_type_elements(world, elem_type, 
+        ct->data(ECS_CONST_CAST(void*, ptr)), count, str, is_array);
+}
+
 /* Forward serialization to the different type kinds */
 static
 int flecs_expr_ser_type_op(
@@ -243,6 +275,11 @@ int flecs_expr_ser_type_op(
             goto error;
         }
         break;
+    case EcsOpOpaque:
+        if (expr_ser_opaque(world, op, ECS_OFFSET(ptr, op->offset), str)) {
+            goto error;
+        }
+        break;
     case EcsOpScope:
     case EcsOpPrimitive:
     case EcsOpBool:
@@ -263,7 +300,6 @@ int flecs_expr_ser_type_op(
     case EcsOpEntity:
     case EcsOpId:
     case EcsOpString:
-    case EcsOpOpaque:
         if (flecs_expr_ser_primitive(world, flecs_expr_op_to_primitive_kind(op->kind), 
             ECS_OFFSET(ptr, op->offset), str, is_expr))
         {
@@ -0,0 +1,1151 @@
+/**
+ * @file addons/snapshot/delta.c
+ * @brief Encode and apply changes between a snapshot and a world.
+ *
+ * A delta has the following layout:
+ *
+ *   magic, version
+ *   deleted entities
+ *   ids referenced by the delta
+ *   entity records
+ *   column records
+ *
+ * Entity records store the ids that were added to and removed from an entity,
+ * and the values that changed when the entity moved to another table. Column
+ * records store the values that changed for entities that did not move, with
+ * entity ids stored as the difference with the entity of the previous row.
+ *
+ * Integers are stored as variable length integers. Values of components without
+ * lifecycle hooks are stored as the XOR of the new value and the previous value
+ * (or zero for added components), which is encoded as alternating runs of zero
+ * bytes and literal bytes. Values of the (Identifier, *) components are stored
+ * as strings.
+ */
+
+#include "snapshot.h"
+
+#ifdef FLECS_SNAPSHOT
+
+#define FLECS_DELTA_MAGIC "FLDT"
+#define FLECS_DELTA_VERSION (1)
+
+/* Id element is written as path instead of entity id */
+#define EcsDeltaFirstIsPath (1u << 0)
+#define EcsDeltaSecondIsPath (1u << 1)
+
+/* Encoding of component values */
+typedef enum ecs_delta_value_kind_t {
+    EcsDeltaNone = 0,            /* No value, or value is not encoded */
+    EcsDeltaXor,                 /* Zero-run encoded XOR of raw values */
+    EcsDeltaString               /* String value of identifier */
+} ecs_delta_value_kind_t;
+
+typedef struct ecs_delta_id_t {
+    ecs_id_t id;
+    ecs_delta_value_kind_t kind;
+    ecs_size_t size;
+} ecs_delta_id_t;
+
+typedef struct ecs_delta_writer_t {
+    ecs_world_t *world;
+    ecs_map_t id_index;          /* id -> index in ids + 1 */
+    ecs_vec_t ids;               /* vector<ecs_delta_id_t> */
+    ecs_vec_t deleted;           /* vector<uint8_t> */
+    ecs_vec_t entities;          /* vector<uint8_t> */
+    ecs_vec_t columns;           /* vector<uint8_t> */
+    ecs_vec_t tmp;               /* vector<uint8_t>, values of current record */
+    int32_t deleted_count;
+    int32_t entity_count;
+    int32_t column_count;
+} ecs_delta_writer_t;
+
+typedef struct ecs_delta_reader_t {
+    const uint8_t *ptr;
+    const uint8_t *end;
+} ecs_delta_reader_t;
+
+static
+void flecs_delta_write_varint(
+    ecs_vec_t *buf,
+    uint64_t value)
+{
+    uint8_t bytes[10];
+    int32_t count = 0;
+    do {
+        uint8_t byte = (uint8_t)(value & 0x7f);
+        value >>= 7;
+        if (value) {
+            byte |= 0x80;
+        }
+        bytes[count ++] = byte;
+    } while (value);
+
+    ecs_os_memcpy(ecs_vec_grow_t(NULL, buf, uint8_t, count), bytes, count);
+}
+
+static
+void flecs_delta_write_bytes(
+    ecs_vec_t *buf,
+    const void *ptr,
+    ecs_size_t size)
+{
+    if (size) {
+        ecs_os_memcpy(ecs_vec_grow_t(NULL, buf, uint8_t, size), ptr, size);
+    }
+}
+
+static
+void flecs_delta_write_str(
+    ecs_vec_t *buf,
+    const char *str)
+{
+    /* Length includes the terminator, so strings can be used in place */
+    ecs_size_t len = str ? ecs_os_strlen(str) + 1 : 0;
+    flecs_delta_write_varint(buf, flecs_ito(uint64_t, len));
+    flecs_delta_write_bytes(buf, str, len);
+}
+
+/* Write XOR of two values as alternating runs of zero and literal bytes. If
+ * prev is NULL, the value is encoded as XOR with zero. */
+static
+void flecs_delta_write_xor(
+    ecs_vec_t *buf,
+    const uint8_t *prev,
+    const uint8_t *cur,
+    ecs_size_t size)
+{
+    ecs_size_t i = 0;
+    while (i < size) {
+        ecs_size_t start = i;
+        while (i < size && (prev ? prev[i] : 0) == cur[i]) {
+            i ++;
+        }
+
+        flecs_delta_write_varint(buf, flecs_ito(uint64_t, i - start));
+        if (i == size) {
+            break;
+        }
+
+        start = i;
+        while (i < size && (prev ? prev[i] : 0) != cur[i]) {
+            i ++;
+        }
+
+        flecs_delta_write_varint(buf, flecs_ito(uint64_t, i - start));
+        uint8_t *dst = ecs_vec_grow_t(NULL, buf, uint8_t, i - start);
+        ecs_size_t j;
+        for (j = start; j < i; j ++) {
+            dst[j - start] = (uint8_t)((prev ? prev[j] : 0) ^ cur[j]);
+        }
+    }
+}
+
+static
+ecs_delta_value_kind_t flecs_delta_value_kind(
+    const ecs_type_info_t *ti)
+{
+    if (!ti) {
+        return EcsDeltaNone;
+    }
+
+    if (ti->component == ecs_id(EcsIdentifier)) {
+        return EcsDeltaString;
+    }
+
+    /* Values that own resources cannot be encoded as raw bytes */
+    if (ti->hooks.copy || ti->hooks.move || ti->hooks.dtor) {
+        return EcsDeltaNone;
+    }
+
+    return EcsDeltaXor;
+}
+
+/* Test if entity in id must be written as path. Entities that are not part of
+ * the replicated state, like components and modules, are looked up by path in
+ * the world that applies the delta. */
+static
+bool flecs_delta_elem_is_path(
+    ecs_world_t *world,
+    ecs_entity_t e)
+{
+    ecs_record_t *r = flecs_entities_get(world, e);
+    return r && r->table && flecs_snapshot_skip_table(r->table);
+}
+
+static
+void flecs_delta_write_elem(
+    ecs_delta_writer_t *w,
+    ecs_vec_t *buf,
+    ecs_entity_t e,
+    bool is_path)
+{
+    if (is_path) {
+        char *path = ecs_get_path(w->world, e);
+        flecs_delta_write_str(buf, path);
+        ecs_os_free(path);
+    } else {
+        flecs_delta_write_varint(buf, e);
+    }
+}
+
+/* Get index of id in the id list of the delta */
+static
+int32_t flecs_delta_id_index(
+    ecs_delta_writer_t *w,
+    ecs_id_t id)
+{
+    ecs_map_val_t *ptr = ecs_map_ensure(&w->id_index, id);
+    if (!ptr[0]) {
+        const ecs_type_info_t *ti = ecs_get_type_info(w->world, id);
+        ecs_delta_id_t *elem = ecs_vec_append_t(
+            &w->world->allocator, &w->ids, ecs_delta_id_t);
+        elem->id = id;
+        elem->kind = flecs_delta_value_kind(ti);
+        elem->size = ti ? ti->size : 0;
+        ptr[0] = flecs_ito(uint64_t, ecs_vec_count(&w->ids));
+    }
+
+    return flecs_uto(int32_t, ptr[0] - 1);
+}
+
+static
+bool flecs_delta_value_equal(
+    const ecs_type_info_t *ti,
+    ecs_delta_value_kind_t kind,
+    const void *prev,
+    const void *cur)
+{
+    if (kind == EcsDeltaXor) {
+        return !ecs_os_memcmp(prev, cur, ti->size);
+    } else {
+        const char *prev_str = ((const EcsIdentifier*)prev)->value;
+        const char *cur_str = ((const EcsIdentifier*)cur)->value;
+        return !ecs_os_strcmp(prev_str ? prev_str : "", cur_str ? cur_str : "");
+    }
+}
+
+/* Write value. If prev is NULL the value is written as if it was added. */
+static
+void flecs_delta_write_value(
+    ecs_vec_t *buf,
+    const ecs_type_info_t *ti,
+    ecs_delta_value_kind_t kind,
+    const void *prev,
+    const void *cur)
+{
+    if (kind == EcsDeltaXor) {
+        flecs_delta_write_xor(buf, prev, cur, ti->size);
+    } else {
+        flecs_delta_write_str(buf, ((const EcsIdentifier*)cur)->value);
+    }
+}
+
+/* Write values of column that changed for entities that did not move */
+static
+void flecs_delta_write_column(
+    ecs_delta_writer_t *w,
+    ecs_table_t *table,
+    ecs_snapshot_table_t *st,
+    int32_t column_index)
+{
+    ecs_column_t *column = &table->data.columns[column_index];
+    ecs_snapshot_column_t *prev = &st->columns[column_index];
+    const ecs_type_info_t *ti = column->ti;
+    ecs_delta_value_kind_t kind = flecs_delta_value_kind(ti);
+    if (kind == EcsDeltaNone) {
+        return;
+    }
+
+    ecs_vec_clear(&w->tmp);
+
+    /* Entities are written as difference with the previous entity, which
+     * for entities that were created in order fits in a single byte */
+    ecs_entity_t prev_e = 0;
+    int32_t i, count = st->count, changed = 0;
+    for (i = 0; i < count; i ++) {
+        const void *prev_ptr = ECS_ELEM(prev->data, ti->size, i);
+        const void *cur_ptr = ECS_ELEM(column->data, ti->size, i);
+        if (flecs_delta_value_equal(ti, kind, prev_ptr, cur_ptr)) {
+            continue;
+        }
+
+        ecs_entity_t e = st->entities[i];
+        int64_t diff = (int64_t)(e - prev_e);
+        flecs_delta_write_varint(&w->tmp,
+            ((uint64_t)diff << 1) ^ (uint64_t)(diff >> 63));
+        prev_e = e;
+        flecs_delta_write_value(&w->tmp, ti, kind, prev_ptr, cur_ptr);
+        changed ++;
+    }
+
+    if (changed) {
+        ecs_id_t id = table->type.array[prev->index];
+        int32_t index = flecs_delta_id_index(w, id);
+        flecs_delta_write_varint(&w->columns, flecs_ito(uint64_t, index));
+        flecs_delta_write_varint(&w->columns, flecs_ito(uint64_t, changed));
+        flecs_delta_write_bytes(&w->columns, ecs_vec_first(&w->tmp),
+            ecs_vec_count(&w->tmp));
+        w->column_count ++;
+    }
+}
+
+/* Write table for which the entities are the same as in the snapshot */
+static
+void flecs_delta_write_table_columns(
+    ecs_delta_writer_t *w,
+    ecs_table_t *table,
+    ecs_snapshot_table_t *st)
+{
+    if (!st->column_count) {
+        return;
+    }
+
+    int32_t *dirty_state = flecs_table_get_dirty_state(w->world, table);
+
+    /* If entities were added or removed, values could've been moved
+     * without marking columns dirty. */
+    bool moved = st->dirty != dirty_state[0];
+    int32_t i;
+    for (i = 0; i < st->column_count; i ++) {
+        if (moved || st->columns[i].dirty != dirty_state[i + 1]) {
+            flecs_delta_write_column(w, table, st, i);
+        }
+    }
+}
+
+/* Get column of snapshot table for type index */
+static
+ecs_snapshot_column_t* flecs_delta_snapshot_column(
+    ecs_snapshot_table_t *st,
+    int32_t type_index)
+{
+    int32_t i;
+    for (i = 0; i < st->column_count; i ++) {
+        if (st->columns[i].index == type_index) {
+            return &st->columns[i];
+        }
+    }
+    return NULL;
+}
+
+/* Write entity record. The entity is stored in row of table, or doesn't have
+ * any components if table is NULL. The entity was stored in row prev_row of
+ * prev, or was not stored in the snapshot if prev is NULL. */
+static
+void flecs_delta_write_entity(
+    ecs_delta_writer_t *w,
+    ecs_entity_t e,
+    ecs_table_t *table,
+    int32_t row,
+    ecs_snapshot_table_t *prev,
+    int32_t prev_row)
+{
+    ecs_allocator_t *a = &w->world->allocator;
+    ecs_type_t empty = {0};
+    const ecs_type_t *type = table ? &table->type : &empty;
+    const ecs_type_t *prev_type = prev ? &prev->type : NULL;
+    int32_t prev_count = prev_type ? prev_type->count : 0;
+
+    /* Values are written to tmp, removed ids are written to a local buffer */
+    ecs_vec_t removed;
+    ecs_vec_init_t(a, &removed, int32_t, 0);
+    ecs_vec_clear(&w->tmp);
+    int32_t set_count = 0;
+
+    int32_t i = 0, i_prev = 0;
+    while (i < type->count || i_prev < prev_count) {
+        ecs_id_t id = i < type->count ? type->array[i] : 0;
+        ecs_id_t id_prev = i_prev < prev_count ? prev_type->array[i_prev] : 0;
+
+        if (i == type->count || (i_prev < prev_count && id_prev < id)) {
+            ecs_vec_append_t(a, &removed, int32_t)[0] =
+                flecs_delta_id_index(w, id_prev);
+            i_prev ++;
+            continue;
+        }
+
+        bool added = i_prev == prev_count || id < id_prev;
+        int32_t column_index = table->column_map ? table->column_map[i] : -1;
+        const ecs_type_info_t *ti = NULL;
+        const void *cur_ptr = NULL, *prev_ptr = NULL;
+        if (column_index != -1) {
+            ecs_column_t *column = &table->data.columns[column_index];
+            ti = column->ti;
+            cur_ptr = ECS_ELEM(column->data, ti->size, row);
+        }
+
+        if (!added) {
+            ecs_snapshot_column_t *column =
+                flecs_delta_snapshot_column(prev, i_prev);
+            if (column) {
+                prev_ptr = ECS_ELEM(column->data, column->size, prev_row);
+            }
+            i_prev ++;
+        }
+        i ++;
+
+        /* Sparse components don't have a column, their values aren't stored */
+        ecs_delta_value_kind_t kind = cur_ptr ?
+            flecs_delta_value_kind(ti) : EcsDeltaNone;
+        bool has_value = kind != EcsDeltaNone;
+        if (!added) {
+            if (!has_value || !prev_ptr) {
+                continue;
+            }
+            if (flecs_delta_value_equal(ti, kind, prev_ptr, cur_ptr)) {
+                continue;
+            }
+        }
+
+        int32_t index = flecs_delta_id_index(w, id);
+        flecs_delta_write_varint(&w->tmp, (flecs_ito(uint64_t, index) << 2) |
+            ((uint64_t)has_value << 1) | added);
+        if (has_value) {
+            flecs_delta_write_value(&w->tmp, ti, kind, prev_ptr, cur_ptr);
+        }
+        set_count ++;
+    }
+
+    int32_t removed_count = ecs_vec_count(&removed);
+    if (prev && !removed_count && !set_count) {
+        /* Entity did not change */
+        ecs_vec_fini_t(a, &removed, int32_t);
+        return;
+    }
+
+    flecs_delta_write_varint(&w->entities, e);
+    flecs_delta_write_varint(&w->entities, flecs_ito(uint64_t, removed_count));
+    int32_t *removed_ids = ecs_vec_first(&removed);
+    for (i = 0; i < removed_count; i ++) {
+        flecs_delta_write_varint(&w->entities,
+            flecs_ito(uint64_t, removed_ids[i]));
+    }
+
+    flecs_delta_write_varint(&w->entities, flecs_ito(uint64_t, set_count));
+    flecs_delta_write_bytes(&w->entities, ecs_vec_first(&w->tmp),
+        ecs_vec_count(&w->tmp));
+    w->entity_count ++;
+
+    ecs_vec_fini_t(a, &removed, int32_t);
+}
+
+/* Write entities of table that changed since the snapshot was taken */
+static
+void flecs_delta_write_table_entities(
+    ecs_delta_writer_t *w,
+    ecs_table_t *table,
+    ecs_map_t *prev,
+    ecs_snapshot_table_t *tables)
+{
+    int32_t i, count = ecs_table_count(table);
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e = table->data.entities[i];
+        ecs_map_val_t *ptr = ecs_map_get(prev, e);
+        if (ptr) {
+            uint64_t loc = ptr[0];
+            ecs_map_remove(prev, e);
+            flecs_delta_write_entity(w, e, table, i,
+                &tables[(loc >> 32) - 1], (int32_t)(uint32_t)loc);
+        } else {
+            flecs_delta_write_entity(w, e, table, i, NULL, 0);
+        }
+    }
+}
+
+static
+void flecs_delta_write_ids(
+    ecs_delta_writer_t *w,
+    ecs_vec_t *buf)
+{
+    int32_t i, count = ecs_vec_count(&w->ids);
+    ecs_delta_id_t *ids = ecs_vec_first(&w->ids);
+    flecs_delta_write_varint(buf, flecs_ito(uint64_t, count));
+    for (i = 0; i < count; i ++) {
+        ecs_id_t id = ids[i].id;
+        ecs_entity_t first, second = 0;
+        uint32_t flags = 0;
+        if (ECS_IS_PAIR(id)) {
+            first = ecs_pair_first(w->world, id);
+            second = ecs_pair_second(w->world, id);
+            if (flecs_delta_elem_is_path(w->world, second)) {
+                flags |= EcsDeltaSecondIsPath;
+            }
+        } else {
+            first = id & ECS_COMPONENT_MASK;
+        }
+
+        if (flecs_delta_elem_is_path(w->world, first)) {
+            flags |= EcsDeltaFirstIsPath;
+        }
+
+        flecs_delta_write_varint(buf, (id & ECS_ID_FLAGS_MASK) >> 56);
+        flecs_delta_write_varint(buf, flags);
+        flecs_delta_write_varint(buf, ids[i].kind);
+        flecs_delta_write_varint(buf, flecs_ito(uint64_t, ids[i].size));
+        flecs_delta_write_elem(w, buf, first, flags & EcsDeltaFirstIsPath);
+        if (second) {
+            flecs_delta_write_elem(w, buf, second,
+                flags & EcsDeltaSecondIsPath);
+        }
+    }
+}
+
+/* Write entities that were created or deleted since the snapshot was taken.
+ * Entities that are stored in tables are written by the table diff, this
+ * writes the entities that don't have components. */
+static
+void flecs_delta_write_alive(
+    ecs_delta_writer_t *w,
+    const ecs_snapshot_t *snapshot)
+{
+    ecs_world_t *world = w->world;
+    int32_t i, count = ecs_vec_count(&snapshot->alive);
+    const ecs_entity_t *alive = ecs_vec_first(&snapshot->alive);
+    int32_t world_count = flecs_entities_count(world);
+    const ecs_entity_t *world_alive = flecs_entities_ids(world);
+    if (count == world_count && !ecs_os_memcmp(alive, world_alive,
+        ECS_SIZEOF(ecs_entity_t) * count))
+    {
+        return;
+    }
+
+    /* Entities that were stored in a table with builtin entities are not
+     * known at this point, they're skipped by the world applying the delta. */
+    for (i = 0; i < count; i ++) {
+        if (!ecs_is_alive(world, alive[i])) {
+            flecs_delta_write_varint(&w->deleted, alive[i]);
+            w->deleted_count ++;
+        }
+    }
+
+    ecs_map_t snapshot_alive;
+    ecs_map_init(&snapshot_alive, &world->allocator);
+    for (i = 0; i < count; i ++) {
+        ecs_map_insert(&snapshot_alive, (uint32_t)alive[i], alive[i]);
+    }
+
+    for (i = 0; i < world_count; i ++) {
+        ecs_entity_t e = world_alive[i];
+        ecs_map_val_t *ptr = ecs_map_get(&snapshot_alive, (uint32_t)e);
+        if (ptr && ptr[0] == e) {
+            continue;
+        }
+
+        ecs_record_t *r = flecs_entities_get(world, e);
+        if (!r->table) {
+            flecs_delta_write_entity(w, e, NULL, 0, NULL, 0);
+        }
+    }
+
+    ecs_map_fini(&snapshot_alive);
+}
+
+void* ecs_snapshot_delta(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot,
+    ecs_size_t *size_out)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(snapshot != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(size_out != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_allocator_t *a = &world->allocator;
+    ecs_delta_writer_t w = { .world = world };
+    ecs_map_init(&w.id_index, a);
+    ecs_vec_init_t(a, &w.ids, ecs_delta_id_t, 0);
+    ecs_vec_init_t(NULL, &w.deleted, uint8_t, 0);
+    ecs_vec_init_t(NULL, &w.entities, uint8_t, 0);
+    ecs_vec_init_t(NULL, &w.columns, uint8_t, 0);
+    ecs_vec_init_t(NULL, &w.tmp, uint8_t, 0);
+
+    /* Tables for which the entities did not change only need their columns to
+     * be compared. Entities of other tables are indexed by their location in
+     * the snapshot, so their records can be diffed with the stored values. */
+    ecs_map_t unchanged, prev;
+    ecs_map_init(&unchanged, a);
+    ecs_map_init(&prev, a);
+
+    int32_t i, j, table_count = ecs_vec_count(&snapshot->tables);
+    ecs_snapshot_table_t *tables = ecs_vec_first(&snapshot->tables);
+    for (i = 0; i < table_count; i ++) {
+        ecs_snapshot_table_t *st = &tables[i];
+        ecs_table_t *table = flecs_snapshot_table_get(world, st);
+        if (table && flecs_snapshot_table_entities_equal(table, st)) {
+            ecs_map_insert(&unchanged, table->id, 1);
+            flecs_delta_write_table_columns(&w, table, st);
+            continue;
+        }
+
+        for (j = 0; j < st->count; j ++) {
+            ecs_map_insert(&prev, st->entities[j],
+                (flecs_ito(uint64_t, i + 1) << 32) | flecs_ito(uint32_t, j));
+        }
+    }
+
+    ecs_sparse_t *world_tables = &world->store.tables;
+    int32_t world_table_count = flecs_sparse_count(world_tables);
+    for (i = -1; i < world_table_count; i ++) {
+        ecs_table_t *table = &world->store.root;
+        if (i != -1) {
+            table = flecs_sparse_get_dense_t(world_tables, ecs_table_t, i);
+        }
+
+        if (!ecs_table_count(table) || flecs_snapshot_skip_table(table)) {
+            continue;
+        }
+
+        if (ecs_map_get(&unchanged, table->id)) {
+            continue;
+        }
+
+        flecs_delta_write_table_entities(&w, table, &prev, tables);
+    }
+
+    /* Entities that are no longer stored in a table had all their components
+     * removed, or were deleted. */
+    ecs_map_iter_t it = ecs_map_iter(&prev);
+    while (ecs_map_next(&it)) {
+        ecs_entity_t e = ecs_map_key(&it);
+        ecs_record_t *r = flecs_entities_try(world, e);
+        if (r && !r->table) {
+            uint64_t loc = ecs_map_value(&it);
+            flecs_delta_write_entity(&w, e, NULL, 0,
+                &tables[(loc >> 32) - 1], (int32_t)(uint32_t)loc);
+        }
+    }
+
+    flecs_delta_write_alive(&w, snapshot);
+
+    ecs_vec_t result;
+    ecs_vec_init_t(NULL, &result, uint8_t, 0);
+    flecs_delta_write_bytes(&result, FLECS_DELTA_MAGIC, 4);
+    flecs_delta_write_varint(&result, FLECS_DELTA_VERSION);
+    flecs_delta_write_varint(&result, flecs_ito(uint64_t, w.deleted_count));
+    flecs_delta_write_bytes(&result, ecs_vec_first(&w.deleted),
+        ecs_vec_count(&w.deleted));
+    flecs_delta_write_ids(&w, &result);
+    flecs_delta_write_varint(&result, flecs_ito(uint64_t, w.entity_count));
+    flecs_delta_write_bytes(&result, ecs_vec_first(&w.entities),
+        ecs_vec_count(&w.entities));
+    flecs_delta_write_varint(&result, flecs_ito(uint64_t, w.column_count));
+    flecs_delta_write_bytes(&result, ecs_vec_first(&w.columns),
+        ecs_vec_count(&w.columns));
+
+    ecs_map_fini(&unchanged);
+    ecs_map_fini(&prev);
+    ecs_map_fini(&w.id_index);
+    ecs_vec_fini_t(a, &w.ids, ecs_delta_id_t);
+    ecs_vec_fini_t(NULL, &w.deleted, uint8_t);
+    ecs_vec_fini_t(NULL, &w.entities, uint8_t);
+    ecs_vec_fini_t(NULL, &w.columns, uint8_t);
+    ecs_vec_fini_t(NULL, &w.tmp, uint8_t);
+
+    ecs_snapshot_update(world, snapshot);
+
+    *size_out = ecs_vec_count(&result);
+    return ecs_vec_first(&result);
+error:
+    return NULL;
+}
+
+static
+int flecs_delta_read_varint(
+    ecs_delta_reader_t *r,
+    uint64_t *value_out)
+{
+    uint64_t value = 0;
+    int32_t shift = 0;
+    while (r->ptr < r->end && shift < 64) {
+        uint8_t byte = *(r->ptr ++);
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *value_out = value;
+            return 0;
+        }
+        shift += 7;
+    }
+
+    ecs_err("delta is truncated or malformed");
+    return -1;
+}
+
+static
+int flecs_delta_read_count(
+    ecs_delta_reader_t *r,
+    int32_t *count_out)
+{
+    uint64_t value;
+    if (flecs_delta_read_varint(r, &value)) {
+        return -1;
+    }
+
+    /* Every element takes at least one byte */
+    if (value > (uint64_t)(r->end - r->ptr)) {
+        ecs_err("delta is truncated or malformed");
+        return -1;
+    }
+
+    *count_out = (int32_t)value;
+    return 0;
+}
+
+static
+const char* flecs_delta_read_str(
+    ecs_delta_reader_t *r,
+    bool *err)
+{
+    int32_t len;
+    if (flecs_delta_read_count(r, &len)) {
+        *err = true;
+        return NULL;
+    }
+
+    if (!len) {
+        return NULL;
+    }
+
+    const char *str = (const char*)r->ptr;
+    if (str[len - 1] != '\0') {
+        ecs_err("delta contains string that is not terminated");
+        *err = true;
+        return NULL;
+    }
+
+    r->ptr += len;
+    return str;
+}
+
+/* Apply encoded XOR to value */
+static
+int flecs_delta_read_xor(
+    ecs_delta_reader_t *r,
+    uint8_t *dst,
+    ecs_size_t size)
+{
+    ecs_size_t i = 0;
+    while (i < size) {
+        uint64_t run;
+        if (flecs_delta_read_varint(r, &run)) {
+            return -1;
+        }
+
+        if (run > (uint64_t)(size - i)) {
+            goto malformed;
+        }
+
+        i += (ecs_size_t)run;
+        if (i == size) {
+            break;
+        }
+
+        int32_t len;
+        if (flecs_delta_read_count(r, &len)) {
+            return -1;
+        }
+
+        if (len > (size - i)) {
+            goto malformed;
+        }
+
+        int32_t j;
+        for (j = 0; j < len; j ++) {
+            dst[i + j] ^= r->ptr[j];
+        }
+        r->ptr += len;
+        i += len;
+    }
+
+    return 0;
+malformed:
+    ecs_err("delta contains malformed value");
+    return -1;
+}
+
+/* Make entity alive if it isn't alive yet */
+static
+ecs_entity_t flecs_delta_ensure_entity(
+    ecs_world_t *world,
+    uint64_t e)
+{
+    if (!e || (e & ECS_ID_FLAGS_MASK)) {
+        ecs_err("delta contains invalid entity");
+        return 0;
+    }
+
+    if (ecs_is_alive(world, e)) {
+        return e;
+    }
+
+    ecs_entity_t alive = ecs_get_alive(world, (uint32_t)e);
+    if (alive) {
+        char *str = ecs_id_str(world, alive);
+        ecs_err("cannot make entity alive, id is used by '%s'", str);
+        ecs_os_free(str);
+        return 0;
+    }
+
+    ecs_make_alive(world, e);
+    return e;
+}
+
+static
+ecs_entity_t flecs_delta_read_entity(
+    ecs_world_t *world,
+    ecs_delta_reader_t *r)
+{
+    uint64_t e;
+    if (flecs_delta_read_varint(r, &e)) {
+        return 0;
+    }
+
+    return flecs_delta_ensure_entity(world, e);
+}
+
+static
+ecs_entity_t flecs_delta_read_elem(
+    ecs_world_t *world,
+    ecs_delta_reader_t *r,
+    bool is_path)
+{
+    if (!is_path) {
+        return flecs_delta_read_entity(world, r);
+    }
+
+    bool err = false;
+    const char *path = flecs_delta_read_str(r, &err);
+    if (err || !path) {
+        return 0;
+    }
+
+    ecs_entity_t e = ecs_lookup(world, path);
+    if (!e) {
+        ecs_err("cannot resolve '%s' while applying delta", path);
+    }
+    return e;
+}
+
+static
+int flecs_delta_read_ids(
+    ecs_world_t *world,
+    ecs_delta_reader_t *r,
+    ecs_vec_t *ids)
+{
+    int32_t i, count;
+    if (flecs_delta_read_count(r, &count)) {
+        return -1;
+    }
+
+    if (!count) {
+        return 0;
+    }
+
+    ecs_delta_id_t *elems = ecs_vec_grow_t(
+        &world->allocator, ids, ecs_delta_id_t, count);
+    for (i = 0; i < count; i ++) {
+        uint64_t id_flags, flags, kind, size;
+        if (flecs_delta_read_varint(r, &id_flags) ||
+            flecs_delta_read_varint(r, &flags) ||
+            flecs_delta_read_varint(r, &kind) ||
+            flecs_delta_read_varint(r, &size))
+        {
+            return -1;
+        }
+
+        ecs_id_t id = flecs_delta_read_elem(
+            world, r, flags & EcsDeltaFirstIsPath);
+        if (!id) {
+            return -1;
+        }
+
+        id_flags <<= 56;
+        if (id_flags & ECS_PAIR) {
+            ecs_entity_t second = flecs_delta_read_elem(
+                world, r, flags & EcsDeltaSecondIsPath);
+            if (!second) {
+                return -1;
+            }
+            id = ecs_pair(id, second);
+        }
+        id |= id_flags;
+
+        if (kind != EcsDeltaNone) {
+            const ecs_type_info_t *ti = ecs_get_type_info(world, id);
+            if (!ti || (uint64_t)ti->size != size ||
+                (ecs_delta_value_kind_t)kind != flecs_delta_value_kind(ti))
+            {
+                char *str = ecs_id_str(world, id);
+                ecs_err("type of '%s' does not match type in delta", str);
+                ecs_os_free(str);
+                return -1;
+            }
+        }
+
+        elems[i].id = id;
+        elems[i].kind = (ecs_delta_value_kind_t)kind;
+        elems[i].size = (ecs_size_t)size;
+    }
+
+    return 0;
+}
+
+static
+const ecs_delta_id_t* flecs_delta_read_id(
+    ecs_delta_reader_t *r,
+    const ecs_vec_t *ids,
+    bool *added,
+    bool *has_value)
+{
+    uint64_t value;
+    if (flecs_delta_read_varint(r, &value)) {
+        return NULL;
+    }
+
+    if (added) {
+        *added = value & 1;
+        *has_value = (value >> 1) & 1;
+        value >>= 2;
+    }
+
+    if (value >= (uint64_t)ecs_vec_count(ids)) {
+        ecs_err("delta contains invalid id index");
+        return NULL;
+    }
+
+    return ecs_vec_get_t(ids, ecs_delta_id_t, (int32_t)value);
+}
+
+/* Read value and assign it to component of entity */
+static
+int flecs_delta_read_value(
+    ecs_world_t *world,
+    ecs_delta_reader_t *r,
+    ecs_entity_t e,
+    const ecs_delta_id_t *did,
+    bool added)
+{
+    ecs_id_t id = did->id;
+
+    if (did->kind == EcsDeltaString) {
+        bool err = false;
+        const char *str = flecs_delta_read_str(r, &err);
+        if (err) {
+            return -1;
+        }
+
+        /* Assign string the same way as ecs_set_name(), so that the name
+         * index is updated */
+        EcsIdentifier *ptr = ecs_ensure_id(world, e, id);
+        ecs_os_strset(&ptr->value, str);
+        ecs_modified_id(world, e, id);
+    } else if (did->kind == EcsDeltaXor) {
+        void *ptr;
+        if (added) {
+            ptr = ecs_ensure_id(world, e, id);
+            ecs_os_memset(ptr, 0, did->size);
+        } else {
+            ptr = ecs_get_mut_id(world, e, id);
+            if (!ptr) {
+                char *str = ecs_id_str(world, id);
+                ecs_err("cannot apply delta for '%s', entity does not have "
+                    "component", str);
+                ecs_os_free(str);
+                return -1;
+            }
+        }
+
+        if (flecs_delta_read_xor(r, ptr, did->size)) {
+            return -1;
+        }
+        ecs_modified_id(world, e, id);
+    } else {
+        ecs_err("delta contains value for id without value encoding");
+        return -1;
+    }
+
+    return 0;
+}
+
+static
+int flecs_delta_read_entities(
+    ecs_world_t *world,
+    ecs_delta_reader_t *r,
+    const ecs_vec_t *ids)
+{
+    int32_t i, j, count;
+    if (flecs_delta_read_count(r, &count)) {
+        return -1;
+    }
+
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e = flecs_delta_read_entity(world, r);
+        if (!e) {
+            return -1;
+        }
+
+        int32_t removed_count;
+        if (flecs_delta_read_count(r, &removed_count)) {
+            return -1;
+        }
+
+        for (j = 0; j < removed_count; j ++) {
+            const ecs_delta_id_t *did = flecs_delta_read_id(
+                r, ids, NULL, NULL);
+            if (!did) {
+                return -1;
+            }
+            ecs_remove_id(world, e, did->id);
+        }
+
+        int32_t set_count;
+        if (flecs_delta_read_count(r, &set_count)) {
+            return -1;
+        }
+
+        for (j = 0; j < set_count; j ++) {
+            bool added, has_value;
+            const ecs_delta_id_t *did = flecs_delta_read_id(
+                r, ids, &added, &has_value);
+            if (!did) {
+                return -1;
+            }
+
+            if (!has_value) {
+                ecs_add_id(world, e, did->id);
+            } else if (flecs_delta_read_value(world, r, e, did, added)) {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static
+int flecs_delta_read_columns(
+    ecs_world_t *world,
+    ecs_delta_reader_t *r,
+    const ecs_vec_t *ids)
+{
+    int32_t i, j, count;
+    if (flecs_delta_read_count(r, &count)) {
+        return -1;
+    }
+
+    for (i = 0; i < count; i ++) {
+        const ecs_delta_id_t *did = flecs_delta_read_id(r, ids, NULL, NULL);
+        if (!did || did->kind == EcsDeltaNone) {
+            return -1;
+        }
+
+        int32_t row_count;
+        if (flecs_delta_read_count(r, &row_count)) {
+            return -1;
+        }
+
+        ecs_entity_t e = 0;
+        for (j = 0; j < row_count; j ++) {
+            uint64_t diff;
+            if (flecs_delta_read_varint(r, &diff)) {
+                return -1;
+            }
+
+            e += (diff >> 1) ^ (~(diff & 1) + 1);
+            if (!flecs_delta_ensure_entity(world, e)) {
+                return -1;
+            }
+
+            if (flecs_delta_read_value(world, r, e, did, false)) {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int ecs_snapshot_apply_delta(
+    ecs_world_t *world,
+    const void *data,
+    ecs_size_t size)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(data != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION,
+        "cannot apply delta while world is deferred");
+
+    ecs_delta_reader_t r = {
+        .ptr = data,
+        .end = ECS_OFFSET(data, size)
+    };
+
+    uint64_t version;
+    if (size < 4 || ecs_os_memcmp(data, FLECS_DELTA_MAGIC, 4)) {
+        ecs_err("data is not a delta");
+        goto error;
+    }
+
+    r.ptr += 4;
+    if (flecs_delta_read_varint(&r, &version)) {
+        goto error;
+    }
+
+    if (version != FLECS_DELTA_VERSION) {
+        ecs_err("unsupported delta version %u", (uint32_t)version);
+        goto error;
+    }
+
+    /* Delete entities before ids are resolved, as a deleted entity can have
+     * the same index as a new entity. */
+    int32_t i, deleted_count;
+    if (flecs_delta_read_count(&r, &deleted_count)) {
+        goto error;
+    }
+
+    for (i = 0; i < deleted_count; i ++) {
+        uint64_t e;
+        if (flecs_delta_read_varint(&r, &e)) {
+            goto error;
+        }
+
+        if (!e || (e & ECS_ID_FLAGS_MASK)) {
+            ecs_err("delta contains invalid entity");
+            goto error;
+        }
+
+        /* Entity could've been deleted by cleanup of a previous entity */
+        if (!ecs_is_alive(world, e)) {
+            continue;
+        }
+
+        ecs_record_t *record = flecs_entities_get(world, e);
+        if (record->table && flecs_snapshot_skip_table(record->table)) {
+            continue;
+        }
+
+        ecs_delete(world, e);
+    }
+
+    /* Delta already contains instance children, don't instantiate prefab
+     * hierarchies when adding IsA pairs. */
+    ecs_stage_t *stage = world->stages[0];
+    ecs_entity_t prev_base = stage->base;
+    stage->base = EcsIsA;
+
+    ecs_vec_t ids;
+    ecs_vec_init_t(&world->allocator, &ids, ecs_delta_id_t, 0);
+    int result = 0;
+    if (flecs_delta_read_ids(world, &r, &ids) ||
+        flecs_delta_read_entities(world, &r, &ids) ||
+        flecs_delta_read_columns(world, &r, &ids))
+    {
+        result = -1;
+    }
+
+    stage->base = prev_base;
+    ecs_vec_fini_t(&world->allocator, &ids, ecs_delta_id_t);
+    return result;
+error:
+    return -1;
+}
+
+#endif
@@ -0,0 +1,689 @@
+/**
+ * @file addons/snapshot/snapshot.c
+ * @brief Snapshot addon.
+ */
+
+#include "snapshot.h"
+
+#ifdef FLECS_SNAPSHOT
+
+bool flecs_snapshot_skip_table(
+    const ecs_table_t *table)
+{
+    return table->flags & EcsTableHasBuiltins;
+}
+
+ecs_table_t* flecs_snapshot_table_get(
+    ecs_world_t *world,
+    const ecs_snapshot_table_t *st)
+{
+    if (!st->table_id) {
+        return &world->store.root;
+    }
+
+    ecs_table_t *table = flecs_sparse_try_t(
+        &world->store.tables, ecs_table_t, st->table_id);
+    if (table != st->table) {
+        return NULL;
+    }
+
+    return table;
+}
+
+bool flecs_snapshot_table_entities_equal(
+    const ecs_table_t *table,
+    const ecs_snapshot_table_t *st)
+{
+    int32_t count = ecs_table_count(table);
+    if (count != st->count) {
+        return false;
+    }
+
+    return !ecs_os_memcmp(table->data.entities, st->entities,
+        ECS_SIZEOF(ecs_entity_t) * count);
+}
+
+static
+void flecs_snapshot_copy_ctor(
+    const ecs_type_info_t *ti,
+    void *dst,
+    const void *src,
+    int32_t count)
+{
+    ecs_copy_t copy_ctor = ti->hooks.copy_ctor;
+    if (copy_ctor) {
+        copy_ctor(dst, src, count, ti);
+    } else {
+        ecs_os_memcpy(dst, src, ti->size * count);
+    }
+}
+
+static
+void flecs_snapshot_copy(
+    const ecs_type_info_t *ti,
+    void *dst,
+    const void *src,
+    int32_t count)
+{
+    ecs_copy_t copy = ti->hooks.copy;
+    if (copy) {
+        copy(dst, src, count, ti);
+    } else {
+        ecs_os_memcpy(dst, src, ti->size * count);
+    }
+}
+
+static
+void flecs_snapshot_table_fini_values(
+    ecs_world_t *world,
+    ecs_snapshot_table_t *st)
+{
+    int32_t i;
+    for (i = 0; i < st->column_count; i ++) {
+        ecs_snapshot_column_t *column = &st->columns[i];
+        const ecs_type_info_t *ti = flecs_type_info_get(world, column->type);
+        if (ti && ti->hooks.dtor) {
+            ti->hooks.dtor(column->data, st->count, ti);
+        }
+    }
+    st->count = 0;
+}
+
+static
+void flecs_snapshot_table_fini(
+    ecs_world_t *world,
+    ecs_snapshot_table_t *st)
+{
+    ecs_allocator_t *a = &world->allocator;
+    flecs_snapshot_table_fini_values(world, st);
+
+    int32_t i;
+    for (i = 0; i < st->column_count; i ++) {
+        ecs_snapshot_column_t *column = &st->columns[i];
+        flecs_free(a, column->size * st->size, column->data);
+    }
+
+    flecs_free_n(a, ecs_snapshot_column_t, st->column_count, st->columns);
+    flecs_free_n(a, ecs_entity_t, st->size, st->entities);
+    flecs_free_n(a, ecs_id_t, st->type.count, st->type.array);
+}
+
+static
+void flecs_snapshot_table_init(
+    ecs_world_t *world,
+    ecs_snapshot_table_t *st,
+    ecs_table_t *table)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_os_zeromem(st);
+    st->table = table;
+    st->table_id = table->id;
+    st->type.count = table->type.count;
+    st->type.array = flecs_dup_n(
+        a, ecs_id_t, table->type.count, table->type.array);
+    st->column_count = table->column_count;
+    st->columns = flecs_calloc_n(
+        a, ecs_snapshot_column_t, table->column_count);
+
+    int32_t i;
+    for (i = 0; i < table->column_count; i ++) {
+        const ecs_type_info_t *ti = table->data.columns[i].ti;
+        st->columns[i].type = ti->component;
+        st->columns[i].size = ti->size;
+        st->columns[i].index = table->column_map[table->type.count + i];
+    }
+}
+
+/* Copy table to snapshot table. Columns are only copied if they were written
+ * to since the last copy, or if the entities in the table changed. */
+static
+void flecs_snapshot_table_copy(
+    ecs_world_t *world,
+    ecs_snapshot_table_t *st,
+    ecs_table_t *table)
+{
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, count = ecs_table_count(table);
+    int32_t *dirty_state = NULL;
+    if (table->column_count) {
+        dirty_state = flecs_table_get_dirty_state(world, table);
+    }
+
+    if (flecs_snapshot_table_entities_equal(table, st)) {
+        /* If entities were added or removed, values could've been moved
+         * without marking columns dirty. */
+        bool moved = dirty_state && st->dirty != dirty_state[0];
+        for (i = 0; i < st->column_count; i ++) {
+            ecs_snapshot_column_t *column = &st->columns[i];
+            if (!moved && column->dirty == dirty_state[i + 1]) {
+                continue;
+            }
+
+            ecs_column_t *src = &table->data.columns[i];
+            flecs_snapshot_copy(src->ti, column->data, src->data, count);
+            column->dirty = dirty_state[i + 1];
+        }
+        if (dirty_state) {
+            st->dirty = dirty_state[0];
+        }
+        return;
+    }
+
+    flecs_snapshot_table_fini_values(world, st);
+
+    if (count > st->size) {
+        for (i = 0; i < st->column_count; i ++) {
+            ecs_snapshot_column_t *column = &st->columns[i];
+            flecs_free(a, column->size * st->size, column->data);
+            column->data = flecs_alloc(a, column->size * count);
+        }
+        flecs_free_n(a, ecs_entity_t, st->size, st->entities);
+        st->entities = flecs_alloc_n(a, ecs_entity_t, count);
+        st->size = count;
+    }
+
+    ecs_os_memcpy_n(st->entities, table->data.entities, ecs_entity_t, count);
+
+    for (i = 0; i < st->column_count; i ++) {
+        ecs_snapshot_column_t *column = &st->columns[i];
+        ecs_column_t *src = &table->data.columns[i];
+        flecs_snapshot_copy_ctor(src->ti, column->data, src->data, count);
+        column->dirty = dirty_state[i + 1];
+    }
+
+    if (dirty_state) {
+        st->dirty = dirty_state[0];
+    }
+    st->count = count;
+}
+
+/* Add table to snapshot, or update existing snapshot table */
+static
+void flecs_snapshot_add_table(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot,
+    ecs_map_t *prev,
+    ecs_vec_t *prev_tables,
+    ecs_table_t *table)
+{
+    if (!ecs_table_count(table) || flecs_snapshot_skip_table(table)) {
+        return;
+    }
+
+    ecs_snapshot_table_t *st = ecs_vec_append_t(
+        &world->allocator, &snapshot->tables, ecs_snapshot_table_t);
+
+    ecs_map_val_t *index = ecs_map_get(prev, table->id);
+    if (index) {
+        /* Table was stored in previous version of snapshot, reuse buffers */
+        ecs_snapshot_table_t *prev_st = ecs_vec_get_t(
+            prev_tables, ecs_snapshot_table_t, (int32_t)index[0]);
+        *st = *prev_st;
+        prev_st->table = NULL;
+    } else {
+        flecs_snapshot_table_init(world, st, table);
+    }
+
+    flecs_snapshot_table_copy(world, st, table);
+}
+
+ecs_snapshot_t* ecs_snapshot_take(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+
+    ecs_snapshot_t *result = flecs_calloc_t(
+        &world->allocator, ecs_snapshot_t);
+    ecs_snapshot_update(world, result);
+    return result;
+}
+
+void ecs_snapshot_update(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(snapshot != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_allocator_t *a = &world->allocator;
+
+    /* Store alive entities, so entities created after the snapshot can be
+     * deleted when the snapshot is restored. */
+    int32_t count = flecs_entities_count(world);
+    ecs_vec_set_count_t(a, &snapshot->alive, ecs_entity_t, count);
+    ecs_os_memcpy_n(ecs_vec_first(&snapshot->alive), flecs_entities_ids(world),
+        ecs_entity_t, count);
+
+    /* Index tables of previous version of snapshot by id */
+    ecs_vec_t prev_tables = snapshot->tables;
+    ecs_vec_init_t(a, &snapshot->tables, ecs_snapshot_table_t,
+        ecs_vec_count(&prev_tables));
+
+    ecs_map_t prev;
+    ecs_map_init(&prev, a);
+
+    int32_t i, prev_count = ecs_vec_count(&prev_tables);
+    ecs_snapshot_table_t *prev_st = ecs_vec_first(&prev_tables);
+    for (i = 0; i < prev_count; i ++) {
+        if (flecs_snapshot_table_get(world, &prev_st[i])) {
+            ecs_map_insert(&prev, prev_st[i].table_id, flecs_ito(uint64_t, i));
+        }
+    }
+
+    flecs_snapshot_add_table(
+        world, snapshot, &prev, &prev_tables, &world->store.root);
+
+    ecs_sparse_t *tables = &world->store.tables;
+    int32_t table_count = flecs_sparse_count(tables);
+    for (i = 0; i < table_count; i ++) {
+        ecs_table_t *table = flecs_sparse_get_dense_t(tables, ecs_table_t, i);
+        flecs_snapshot_add_table(world, snapshot, &prev, &prev_tables, table);
+    }
+
+    /* Free tables that are no longer stored in the snapshot */
+    prev_st = ecs_vec_first(&prev_tables);
+    for (i = 0; i < prev_count; i ++) {
+        if (prev_st[i].table) {
+            flecs_snapshot_table_fini(world, &prev_st[i]);
+        }
+    }
+
+    ecs_map_fini(&prev);
+    ecs_vec_fini_t(a, &prev_tables, ecs_snapshot_table_t);
+error:
+    return;
+}
+
+/* Test whether the world has the same entities in the same tables as the
+ * snapshot. If so, only component values need to be restored. */
+static
+bool flecs_snapshot_is_unchanged(
+    ecs_world_t *world,
+    const ecs_snapshot_t *snapshot)
+{
+    int32_t count = flecs_entities_count(world);
+    if (count != ecs_vec_count(&snapshot->alive)) {
+        return false;
+    }
+
+    if (ecs_os_memcmp(flecs_entities_ids(world),
+        ecs_vec_first(&snapshot->alive), ECS_SIZEOF(ecs_entity_t) * count))
+    {
+        return false;
+    }
+
+    int32_t i, table_count = ecs_vec_count(&snapshot->tables);
+    ecs_snapshot_table_t *tables = ecs_vec_first(&snapshot->tables);
+    for (i = 0; i < table_count; i ++) {
+        ecs_table_t *table = flecs_snapshot_table_get(world, &tables[i]);
+        if (!table || !flecs_snapshot_table_entities_equal(table, &tables[i])) {
+            return false;
+        }
+    }
+
+    /* Entities that were not stored in a table of the snapshot could have
+     * moved to a table that was empty when the snapshot was taken. */
+    int32_t nonempty_count = 0;
+    if (ecs_table_count(&world->store.root)) {
+        nonempty_count ++;
+    }
+
+    ecs_sparse_t *world_tables = &world->store.tables;
+    int32_t world_table_count = flecs_sparse_count(world_tables);
+    for (i = 0; i < world_table_count; i ++) {
+        ecs_table_t *table = flecs_sparse_get_dense_t(
+            world_tables, ecs_table_t, i);
+        if (ecs_table_count(table) && !flecs_snapshot_skip_table(table)) {
+            nonempty_count ++;
+        }
+    }
+
+    return nonempty_count == table_count;
+}
+
+/* Delete entities that were created after the snapshot was taken, and recreate
+ * entities that were deleted. */
+static
+void flecs_snapshot_restore_alive(
+    ecs_world_t *world,
+    const ecs_snapshot_t *snapshot)
+{
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, count = ecs_vec_count(&snapshot->alive);
+    const ecs_entity_t *alive = ecs_vec_first(&snapshot->alive);
+
+    ecs_map_t snapshot_alive;
+    ecs_map_init(&snapshot_alive, a);
+    for (i = 0; i < count; i ++) {
+        ecs_map_insert(&snapshot_alive, (uint32_t)alive[i], alive[i]);
+    }
+
+    ecs_vec_t to_delete;
+    ecs_vec_init_t(a, &to_delete, ecs_entity_t, 0);
+
+    int32_t world_count = flecs_entities_count(world);
+    const ecs_entity_t *world_alive = flecs_entities_ids(world);
+    for (i = 0; i < world_count; i ++) {
+        ecs_entity_t e = world_alive[i];
+        ecs_map_val_t *ptr = ecs_map_get(&snapshot_alive, (uint32_t)e);
+        if (ptr && ptr[0] == e) {
+            continue;
+        }
+
+        ecs_record_t *r = flecs_entities_get(world, e);
+        if (r->table && flecs_snapshot_skip_table(r->table)) {
+            continue;
+        }
+
+        ecs_vec_append_t(a, &to_delete, ecs_entity_t)[0] = e;
+    }
+
+    int32_t delete_count = ecs_vec_count(&to_delete);
+    ecs_entity_t *delete_ids = ecs_vec_first(&to_delete);
+    for (i = 0; i < delete_count; i ++) {
+        /* Entity could've been deleted by cleanup of a previous entity */
+        if (ecs_is_alive(world, delete_ids[i])) {
+            ecs_delete(world, delete_ids[i]);
+        }
+    }
+
+    for (i = 0; i < count; i ++) {
+        if (!ecs_get_alive(world, (uint32_t)alive[i])) {
+            ecs_make_alive(world, alive[i]);
+        }
+    }
+
+    ecs_vec_fini_t(a, &to_delete, ecs_entity_t);
+    ecs_map_fini(&snapshot_alive);
+}
+
+/* Compute ids to add and remove to move entity between tables */
+static
+void flecs_snapshot_type_diff(
+    ecs_allocator_t *a,
+    const ecs_type_t *src,
+    const ecs_type_t *dst,
+    ecs_vec_t *added,
+    ecs_vec_t *removed)
+{
+    ecs_vec_clear(added);
+    ecs_vec_clear(removed);
+
+    int32_t i_src = 0, src_count = src ? src->count : 0;
+    int32_t i_dst = 0, dst_count = dst->count;
+    while (i_src < src_count || i_dst < dst_count) {
+        ecs_id_t id_src = i_src < src_count ? src->array[i_src] : 0;
+        ecs_id_t id_dst = i_dst < dst_count ? dst->array[i_dst] : 0;
+        if (i_dst == dst_count || (i_src < src_count && id_src < id_dst)) {
+            ecs_vec_append_t(a, removed, ecs_id_t)[0] = id_src;
+            i_src ++;
+        } else if (i_src == src_count || id_dst < id_src) {
+            ecs_vec_append_t(a, added, ecs_id_t)[0] = id_dst;
+            i_dst ++;
+        } else {
+            i_src ++;
+            i_dst ++;
+        }
+    }
+}
+
+/* Move entities back to the tables they were stored in when the snapshot was
+ * taken, and clear entities that were not stored in any table. */
+static
+void flecs_snapshot_restore_tables(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot,
+    ecs_vec_t *moved)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t added, removed, to_clear;
+    ecs_vec_init_t(a, &added, ecs_id_t, 0);
+    ecs_vec_init_t(a, &removed, ecs_id_t, 0);
+    ecs_vec_init_t(a, &to_clear, ecs_entity_t, 0);
+
+    ecs_map_t stored; /* entity -> table */
+    ecs_map_init(&stored, a);
+
+    int32_t i, j, table_count = ecs_vec_count(&snapshot->tables);
+    ecs_snapshot_table_t *tables = ecs_vec_first(&snapshot->tables);
+    for (i = 0; i < table_count; i ++) {
+        ecs_snapshot_table_t *st = &tables[i];
+        ecs_table_t *table = flecs_snapshot_table_get(world, st);
+        if (!table) {
+            for (j = 0; j < st->type.count; j ++) {
+                if (!ecs_id_is_valid(world, st->type.array[j])) {
+                    break;
+                }
+            }
+            if (j != st->type.count) {
+                /* Table contains entity that could not be restored */
+                continue;
+            }
+
+            /* Dirty state of new table is unrelated to the stored state, make
+             * sure that all columns are restored. */
+            table = flecs_table_find_or_create(world, &st->type);
+            st->table = table;
+            st->table_id = table->id;
+            st->dirty = -1;
+        }
+
+        for (j = 0; j < st->count; j ++) {
+            ecs_entity_t e = st->entities[j];
+            ecs_record_t *r = flecs_entities_try(world, e);
+            if (!r) {
+                continue;
+            }
+
+            ecs_map_insert_ptr(&stored, e, table);
+            if (r->table == table) {
+                continue;
+            }
+
+            flecs_snapshot_type_diff(a, r->table ? &r->table->type : NULL,
+                &table->type, &added, &removed);
+            ecs_type_t added_type = {
+                .array = ecs_vec_first(&added),
+                .count = ecs_vec_count(&added) };
+            ecs_type_t removed_type = {
+                .array = ecs_vec_first(&removed),
+                .count = ecs_vec_count(&removed) };
+            ecs_commit(world, e, NULL, table, &added_type, &removed_type);
+            ecs_vec_append_t(a, moved, ecs_entity_t)[0] = e;
+        }
+    }
+
+    /* Find entities that were not stored in a table of the snapshot */
+    ecs_sparse_t *world_tables = &world->store.tables;
+    int32_t world_table_count = flecs_sparse_count(world_tables);
+    for (i = -1; i < world_table_count; i ++) {
+        ecs_table_t *table = &world->store.root;
+        if (i != -1) {
+            table = flecs_sparse_get_dense_t(world_tables, ecs_table_t, i);
+        }
+
+        if (flecs_snapshot_skip_table(table)) {
+            continue;
+        }
+
+        int32_t count = ecs_table_count(table);
+        const ecs_entity_t *entities = table->data.entities;
+        for (j = 0; j < count; j ++) {
+            if (ecs_map_get_deref(&stored, ecs_table_t, entities[j]) != table) {
+                ecs_vec_append_t(a, &to_clear, ecs_entity_t)[0] = entities[j];
+            }
+        }
+    }
+
+    int32_t clear_count = ecs_vec_count(&to_clear);
+    ecs_entity_t *clear_ids = ecs_vec_first(&to_clear);
+    for (i = 0; i < clear_count; i ++) {
+        ecs_clear(world, clear_ids[i]);
+    }
+
+    ecs_map_fini(&stored);
+    ecs_vec_fini_t(a, &to_clear, ecs_entity_t);
+    ecs_vec_fini_t(a, &removed, ecs_id_t);
+    ecs_vec_fini_t(a, &added, ecs_id_t);
+}
+
+/* Restore component values of snapshot table */
+static
+void flecs_snapshot_restore_values(
+    ecs_world_t *world,
+    ecs_snapshot_table_t *st)
+{
+    ecs_table_t *table = flecs_snapshot_table_get(world, st);
+    if (!table || !st->column_count) {
+        return;
+    }
+
+    int32_t *dirty_state = flecs_table_get_dirty_state(world, table);
+    int32_t i, j;
+
+    if (flecs_snapshot_table_entities_equal(table, st)) {
+        /* Entities are stored in the same rows, copy columns that changed */
+        bool moved = st->dirty != dirty_state[0];
+        for (i = 0; i < st->column_count; i ++) {
+            ecs_snapshot_column_t *column = &st->columns[i];
+            if (!moved && column->dirty == dirty_state[i + 1]) {
+                continue;
+            }
+
+            ecs_column_t *dst = &table->data.columns[i];
+            flecs_snapshot_copy(dst->ti, dst->data, column->data, st->count);
+            column->dirty = ++ dirty_state[i + 1];
+        }
+        st->dirty = dirty_state[0];
+        return;
+    }
+
+    /* Entities moved between rows, copy values one by one */
+    for (j = 0; j < st->count; j ++) {
+        ecs_record_t *r = flecs_entities_try(world, st->entities[j]);
+        if (!r || r->table != table) {
+            continue;
+        }
+
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        for (i = 0; i < st->column_count; i ++) {
+            ecs_snapshot_column_t *column = &st->columns[i];
+            ecs_column_t *dst = &table->data.columns[i];
+            flecs_snapshot_copy(dst->ti,
+                ECS_ELEM(dst->data, column->size, row),
+                ECS_ELEM(column->data, column->size, j), 1);
+        }
+    }
+
+    for (i = 0; i < st->column_count; i ++) {
+        st->columns[i].dirty = ++ dirty_state[i + 1];
+    }
+    st->dirty = dirty_state[0];
+}
+
+/* Invoke OnSet for the components of entities that were moved to the table
+ * they were stored in, so that hooks like the name index see the values. */
+static
+void flecs_snapshot_restore_on_set(
+    ecs_world_t *world,
+    const ecs_vec_t *moved)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t ids;
+    ecs_vec_init_t(a, &ids, ecs_id_t, 0);
+
+    int32_t i, j, count = ecs_vec_count(moved);
+    const ecs_entity_t *entities = ecs_vec_first(moved);
+    for (i = 0; i < count; i ++) {
+        ecs_record_t *r = flecs_entities_try(world, entities[i]);
+        if (!r || !r->table || !r->table->column_count) {
+            continue;
+        }
+
+        ecs_table_t *table = r->table;
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        ecs_vec_clear(&ids);
+        for (j = 0; j < table->column_count; j ++) {
+            int32_t type_index = table->column_map[table->type.count + j];
+            ecs_vec_append_t(a, &ids, ecs_id_t)[0] =
+                table->type.array[type_index];
+
+            /* The name index stored with the snapshot value can belong to a
+             * parent that was deleted, force the entity to be reindexed. */
+            ecs_column_t *column = &table->data.columns[j];
+            if (column->ti->component == ecs_id(EcsIdentifier)) {
+                EcsIdentifier *ptr = ECS_ELEM_T(
+                    column->data, EcsIdentifier, row);
+                ptr->index = NULL;
+                ptr->index_hash = 0;
+            }
+        }
+
+        ecs_type_t type = {
+            .array = ecs_vec_first(&ids),
+            .count = ecs_vec_count(&ids) };
+        flecs_notify_on_set(world, table, row, 1, &type, true);
+    }
+
+    ecs_vec_fini_t(a, &ids, ecs_id_t);
+}
+
+void ecs_snapshot_restore(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(snapshot != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION,
+        "cannot restore snapshot while world is deferred");
+
+    ecs_vec_t moved;
+    ecs_vec_init_t(&world->allocator, &moved, ecs_entity_t, 0);
+
+    if (!flecs_snapshot_is_unchanged(world, snapshot)) {
+        /* Snapshot already contains instance children, don't instantiate
+         * prefab hierarchies when moving entities to tables with IsA pairs. */
+        ecs_stage_t *stage = world->stages[0];
+        ecs_entity_t prev_base = stage->base;
+        stage->base = EcsIsA;
+
+        flecs_snapshot_restore_alive(world, snapshot);
+        flecs_snapshot_restore_tables(world, snapshot, &moved);
+
+        stage->base = prev_base;
+    }
+
+    int32_t i, count = ecs_vec_count(&snapshot->tables);
+    ecs_snapshot_table_t *tables = ecs_vec_first(&snapshot->tables);
+    for (i = 0; i < count; i ++) {
+        flecs_snapshot_restore_values(world, &tables[i]);
+    }
+
+    flecs_snapshot_restore_on_set(world, &moved);
+    ecs_vec_fini_t(&world->allocator, &moved, ecs_entity_t);
+error:
+    return;
+}
+
+void ecs_snapshot_free(
+    ecs_world_t *world,
+    ecs_snapshot_t *snapshot)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    if (!snapshot) {
+        return;
+    }
+
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, count = ecs_vec_count(&snapshot->tables);
+    ecs_snapshot_table_t *tables = ecs_vec_first(&snapshot->tables);
+    for (i = 0; i < count; i ++) {
+        flecs_snapshot_table_fini(world, &tables[i]);
+    }
+
+    ecs_vec_fini_t(a, &snapshot->tables, ecs_snapshot_table_t);
+    ecs_vec_fini_t(a, &snapshot->alive, ecs_entity_t);
+    flecs_free_t(a, ecs_snapshot_t, snapshot);
+}
+
+#endif
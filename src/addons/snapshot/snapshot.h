@@ -0,0 +1,57 @@
+/**
+ * @file addons/snapshot/snapshot.h
+ * @brief Snapshot addon, private types and functions.
+ */
+
+#ifndef FLECS_SNAPSHOT_PRIVATE_H
+#define FLECS_SNAPSHOT_PRIVATE_H
+
+#include "../../private_api.h"
+
+#ifdef FLECS_SNAPSHOT
+
+/* Copy of a table column */
+typedef struct ecs_snapshot_column_t {
+    void *data;
+    ecs_entity_t type;           /* Component type, used to find type info */
+    ecs_size_t size;             /* Size of component */
+    int32_t index;               /* Index of column id in table type */
+    int32_t dirty;               /* Dirty state of column when it was copied */
+} ecs_snapshot_column_t;
+
+/* Copy of a table */
+typedef struct ecs_snapshot_table_t {
+    ecs_table_t *table;
+    uint64_t table_id;
+    ecs_type_t type;             /* Used to recreate table if it was deleted */
+    ecs_entity_t *entities;
+    ecs_snapshot_column_t *columns;
+    int32_t column_count;
+    int32_t count;
+    int32_t size;
+    int32_t dirty;               /* Dirty state of table when it was copied */
+} ecs_snapshot_table_t;
+
+struct ecs_snapshot_t {
+    ecs_vec_t tables;            /* vector<ecs_snapshot_table_t> */
+    ecs_vec_t alive;             /* vector<ecs_entity_t> */
+};
+
+/* Tables with builtin entities like components, systems and modules are not
+ * stored in snapshots. */
+bool flecs_snapshot_skip_table(
+    const ecs_table_t *table);
+
+/* Get table for snapshot table. Returns NULL if the table was deleted. */
+ecs_table_t* flecs_snapshot_table_get(
+    ecs_world_t *world,
+    const ecs_snapshot_table_t *st);
+
+/* Test if table has the same entities in the same order as snapshot table */
+bool flecs_snapshot_table_entities_equal(
+    const ecs_table_t *table,
+    const ecs_snapshot_table_t *st);
+
+#endif
+
+#endif
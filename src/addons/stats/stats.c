@@ -287,6 +287,8 @@ void ecs_world_stats_get(
     if (ecs_is_alive(world, EcsSystem)) {
         ECS_GAUGE_RECORD(&s->queries.system_count, t, ecs_count_id(world, EcsSystem));
     }
+    ECS_GAUGE_RECORD(&s->queries.async_event_count, t, 
+        flecs_observers_async_count(world));
     ECS_COUNTER_RECORD(&s->tables.create_count, t, world->info.table_create_total);
     ECS_COUNTER_RECORD(&s->tables.delete_count, t, world->info.table_delete_total);
     ECS_GAUGE_RECORD(&s->tables.count, t, world->info.table_count);
@@ -537,6 +539,13 @@ bool ecs_pipeline_stats_get(
         return false;
     }
 
+    s->system_count = sys_count;
+    s->active_system_count = active_sys_count;
+    s->rebuild_count = pq->rebuild_count;
+    s->incremental_rebuild_count = pq->rebuild_incremental_count;
+    s->rebuild_system_count = pq->rebuild_system_count;
+    s->rebuild_time_spent = pq->rebuild_time_spent;
+
     if (op) {
         ecs_entity_t *systems = NULL;
         if (pip_count) {
@@ -633,6 +642,13 @@ void ecs_pipeline_stats_reduce(
         dst_el->immediate = src_el->immediate;
     }
 
+    dst->system_count = src->system_count;
+    dst->active_system_count = src->active_system_count;
+    dst->rebuild_count = src->rebuild_count;
+    dst->incremental_rebuild_count = src->incremental_rebuild_count;
+    dst->rebuild_system_count = src->rebuild_system_count;
+    dst->rebuild_time_spent = src->rebuild_time_spent;
+
     dst->t = t_next(dst->t);
 }
 
@@ -692,6 +708,13 @@ void ecs_pipeline_stats_copy_last(
         dst_el->multi_threaded = src_el->multi_threaded;
         dst_el->immediate = src_el->immediate;
     }
+
+    dst->system_count = src->system_count;
+    dst->active_system_count = src->active_system_count;
+    dst->rebuild_count = src->rebuild_count;
+    dst->incremental_rebuild_count = src->incremental_rebuild_count;
+    dst->rebuild_system_count = src->rebuild_system_count;
+    dst->rebuild_time_spent = src->rebuild_time_spent;
 }
 
 #endif
@@ -734,6 +757,7 @@ void ecs_world_stats_log(
     flecs_gauge_print("query count", t, &s->queries.query_count);
     flecs_gauge_print("observer count", t, &s->queries.observer_count);
     flecs_gauge_print("system count", t, &s->queries.system_count);
+    flecs_gauge_print("async event count", t, &s->queries.async_event_count);
     ecs_trace("");
     flecs_gauge_print("table count", t, &s->tables.count);
     flecs_gauge_print("empty table count", t, &s->tables.empty_count);
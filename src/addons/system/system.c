@@ -9,6 +9,7 @@
 
 #include "../../private_api.h"
 #include "system.h"
+#include "../timeline/timeline.h"
 
 ecs_mixins_t ecs_system_t_mixins = {
     .type_name = "ecs_system_t",
@@ -21,6 +22,55 @@ ecs_mixins_t ecs_system_t_mixins = {
 
 /* -- Public API -- */
 
+/* Count entities matched by a time sliced system at the start of a cycle. The
+ * count from the start of the cycle is reused for the remaining slices, so that
+ * all slices of a cycle have the same size. */
+static
+int32_t flecs_system_time_slice_total(
+    ecs_world_t *thread_ctx,
+    ecs_system_t *system_data)
+{
+    if (system_data->time_slice_offset) {
+        return system_data->time_slice_total;
+    }
+
+    int32_t result = 0;
+    ecs_iter_t it = ecs_query_iter(thread_ctx, system_data->query);
+    it.flags |= EcsIterNoData;
+    while (ecs_query_next(&it)) {
+        result += it.count;
+        ecs_iter_skip(&it);
+    }
+
+    return result;
+}
+
+/* Move cursor of time sliced system to the next slice. When a system runs on
+ * multiple threads, the last thread to finish the slice moves the cursor, so
+ * that no thread can observe the cursor changing while running the slice. */
+static
+void flecs_system_time_slice_next(
+    ecs_system_t *system_data,
+    int32_t total,
+    int32_t size,
+    int32_t stage_count)
+{
+    if (stage_count > 1) {
+        if (ecs_os_ainc(&system_data->time_slice_done) != stage_count) {
+            return;
+        }
+        system_data->time_slice_done = 0;
+    }
+
+    int32_t offset = system_data->time_slice_offset + size;
+    if (offset >= total) {
+        offset = 0;
+    }
+
+    system_data->time_slice_offset = offset;
+    system_data->time_slice_total = total;
+}
+
 ecs_entity_t flecs_run_intern(
     ecs_world_t *world,
     ecs_stage_t *stage,
@@ -80,8 +130,10 @@ ecs_entity_t flecs_run_intern(
         stage = world->stages[0];
     }
 
+    flecs_timeline_begin(stage);
+
     /* Prepare the query iterator */
-    ecs_iter_t wit, qit = ecs_query_iter(thread_ctx, system_data->query);
+    ecs_iter_t wit, pit, qit = ecs_query_iter(thread_ctx, system_data->query);
     ecs_iter_t *it = &qit;
 
     qit.system = system;
@@ -94,8 +146,28 @@ ecs_entity_t flecs_run_intern(
 
     flecs_defer_begin(world, stage);
 
-    if (stage_count > 1 && system_data->multi_threaded) {
-        wit = ecs_worker_iter(it, stage_index, stage_count);
+    int32_t slice_total = 0, slice_size = 0;
+    bool time_sliced = system_data->time_slices > 1 && 
+        (system_data->query->flags & EcsQueryMatchThis);
+    if (time_sliced) {
+        slice_total = flecs_system_time_slice_total(thread_ctx, system_data);
+        slice_size = (slice_total + system_data->time_slices - 1) / 
+            system_data->time_slices;
+        if (!slice_size) {
+            slice_size = 1;
+        }
+
+        pit = ecs_page_iter(it, system_data->time_slice_offset, slice_size);
+        it = &pit;
+    }
+
+    bool multi_threaded = stage_count > 1 && system_data->multi_threaded;
+    if (multi_threaded) {
+        if (system_data->table_affinity) {
+            wit = ecs_worker_table_iter(it, stage_index, stage_count);
+        } else {
+            wit = ecs_worker_iter(it, stage_index, stage_count);
+        }
         it = &wit;
     }
 
@@ -134,12 +206,20 @@ ecs_entity_t flecs_run_intern(
 
     flecs_stage_set_system(stage, old_system);
 
+    if (time_sliced) {
+        flecs_system_time_slice_next(system_data, slice_total, slice_size, 
+            multi_threaded ? stage_count : 1);
+    }
+
     if (measure_time) {
         system_data->time_spent += (ecs_ftime_t)ecs_time_measure(&time_start);
     }
 
     flecs_defer_end(world, stage);
 
+    flecs_timeline_end(stage, EcsTimelineSystem, system, 
+        stage_index, stage_count);
+
     ecs_os_perf_trace_pop(system_data->name);
 
     return it->interrupted_by;
@@ -228,7 +308,11 @@ int flecs_system_init_timer(
 
         if (desc->rate) {
             ecs_entity_t tick_source = desc->tick_source;
-            ecs_set_rate(world, entity, desc->rate, tick_source);
+            if (desc->stagger) {
+                ecs_set_rate_staggered(world, entity, desc->rate, tick_source);
+            } else {
+                ecs_set_rate(world, entity, desc->rate, tick_source);
+            }
         } else if (desc->tick_source) {
             ecs_set_tick_source(world, entity, desc->tick_source);
         }
@@ -250,6 +334,8 @@ ecs_entity_t ecs_system_init(
     ecs_check(desc != NULL, ECS_INVALID_PARAMETER, NULL);
     ecs_check(desc->_canary == 0, ECS_INVALID_PARAMETER,
         "ecs_system_desc_t was not initialized to zero");
+    ecs_check(desc->time_slices >= 0, ECS_INVALID_PARAMETER, 
+        "time_slices cannot be negative");
     ecs_assert(!(world->flags & EcsWorldReadonly), 
         ECS_INVALID_WHILE_READONLY, NULL);
 
@@ -297,7 +383,9 @@ ecs_entity_t ecs_system_init(
         system->tick_source = desc->tick_source;
 
         system->multi_threaded = desc->multi_threaded;
+        system->table_affinity = desc->table_affinity;
         system->immediate = desc->immediate;
+        system->time_slices = desc->time_slices;
 
         system->name = ecs_get_path(world, entity);
 
@@ -381,10 +469,19 @@ ecs_entity_t ecs_system_init(
             system->multi_threaded = desc->multi_threaded;
         }
 
+        if (desc->table_affinity) {
+            system->table_affinity = desc->table_affinity;
+        }
+
         if (desc->immediate) {
             system->immediate = desc->immediate;
         }
 
+        if (desc->time_slices) {
+            system->time_slices = desc->time_slices;
+            system->time_slice_offset = 0;
+        }
+
         if (flecs_system_init_timer(world, entity, desc)) {
             return 0;
         }
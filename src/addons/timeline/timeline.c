@@ -0,0 +1,346 @@
+/**
+ * @file addons/timeline/timeline.c
+ * @brief Timeline addon.
+ */
+
+#include "timeline.h"
+
+#ifdef FLECS_TIMELINE
+
+static const char *flecs_timeline_kind_str[] = {
+    [EcsTimelineFrame] = "frame",
+    [EcsTimelineSystem] = "system",
+    [EcsTimelineObserver] = "observer",
+    [EcsTimelineMerge] = "merge",
+    [EcsTimelineSync] = "sync"
+};
+
+static
+ecs_timeline_buffer_t* flecs_timeline_buffer_ensure(
+    ecs_stage_t *stage)
+{
+    ecs_timeline_buffer_t *buf = stage->timeline;
+    if (!buf) {
+        int32_t capacity = stage->world->timeline->capacity;
+        buf = stage->timeline = ecs_os_calloc_t(ecs_timeline_buffer_t);
+        buf->events = ecs_os_malloc_n(ecs_timeline_event_t, capacity);
+        buf->capacity = capacity;
+    }
+    return buf;
+}
+
+static
+void flecs_timeline_buffer_clear(
+    ecs_stage_t *stage)
+{
+    ecs_timeline_buffer_t *buf = stage->timeline;
+    if (buf) {
+        buf->count = 0;
+        buf->head = 0;
+        buf->sp = 0;
+    }
+}
+
+void flecs_timeline_push(
+    ecs_stage_t *stage)
+{
+    ecs_timeline_buffer_t *buf = flecs_timeline_buffer_ensure(stage);
+    if (buf->sp < FLECS_TIMELINE_MAX_DEPTH) {
+        buf->stack[buf->sp] = ecs_os_now();
+    }
+
+    /* Keep counting when nesting is too deep, so pop stays balanced */
+    buf->sp ++;
+}
+
+void flecs_timeline_pop(
+    ecs_stage_t *stage,
+    ecs_timeline_kind_t kind,
+    ecs_entity_t entity,
+    int32_t slice,
+    int32_t slice_count)
+{
+    uint64_t now = ecs_os_now();
+    ecs_timeline_buffer_t *buf = stage->timeline;
+
+    /* Span was opened before recording was enabled */
+    if (!buf || !buf->sp) {
+        return;
+    }
+
+    int32_t depth = -- buf->sp;
+    if (depth >= FLECS_TIMELINE_MAX_DEPTH) {
+        return;
+    }
+
+    uint64_t start = buf->stack[depth];
+    uint64_t world_start = stage->world->timeline->start;
+    if (start < world_start) {
+        /* Span was opened before the timeline was cleared */
+        return;
+    }
+
+    ecs_timeline_event_t *ev = &buf->events[buf->head];
+    ev->start = start - world_start;
+    ev->duration = now - start;
+    ev->entity = entity;
+    ev->kind = flecs_itoi16(kind);
+    ev->depth = flecs_itoi16(depth);
+    ev->slice = flecs_itoi16(slice);
+    ev->slice_count = flecs_itoi16(slice_count);
+
+    if (++ buf->head == buf->capacity) {
+        buf->head = 0;
+    }
+    if (buf->count < buf->capacity) {
+        buf->count ++;
+    }
+}
+
+void flecs_timeline_buffer_free(
+    ecs_stage_t *stage)
+{
+    ecs_timeline_buffer_t *buf = stage->timeline;
+    if (buf) {
+        ecs_os_free(buf->events);
+        ecs_os_free(buf);
+        stage->timeline = NULL;
+    }
+}
+
+void flecs_timeline_fini(
+    ecs_world_t *world)
+{
+    int32_t i;
+    for (i = 0; i < world->stage_count; i ++) {
+        flecs_timeline_buffer_free(world->stages[i]);
+    }
+
+    ecs_os_free(world->timeline);
+    world->timeline = NULL;
+}
+
+void ecs_timeline_enable(
+    ecs_world_t *world,
+    int32_t capacity)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(capacity >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION,
+        "cannot change timeline recording while world is in readonly mode");
+    ecs_check(ecs_os_has_time(), ECS_MISSING_OS_API, "now");
+
+    flecs_timeline_fini(world);
+
+    if (capacity) {
+        world->timeline = ecs_os_calloc_t(ecs_timeline_t);
+        world->timeline->capacity = capacity;
+        world->timeline->start = ecs_os_now();
+    }
+error:
+    return;
+}
+
+bool ecs_timeline_is_enabled(
+    const ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    return world->timeline != NULL;
+}
+
+void ecs_timeline_clear(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION,
+        "cannot clear timeline while world is in readonly mode");
+
+    if (!world->timeline) {
+        return;
+    }
+
+    int32_t i;
+    for (i = 0; i < world->stage_count; i ++) {
+        flecs_timeline_buffer_clear(world->stages[i]);
+    }
+
+    world->timeline->start = ecs_os_now();
+error:
+    return;
+}
+
+static
+void flecs_timeline_append_us(
+    ecs_strbuf_t *buf,
+    uint64_t ns)
+{
+    /* Timestamps are in microseconds with nanosecond precision */
+    ecs_strbuf_appendint(buf, flecs_uto(int64_t, ns / 1000));
+    ecs_strbuf_append(buf, ".%03u", (uint32_t)(ns % 1000));
+}
+
+static
+void flecs_timeline_append_name(
+    const ecs_world_t *world,
+    ecs_strbuf_t *buf,
+    const ecs_timeline_event_t *ev)
+{
+    ecs_strbuf_appendch(buf, '"');
+    if (ev->entity && ecs_is_alive(world, ev->entity)) {
+        char *path = ecs_get_path(world, ev->entity);
+        char *escaped = flecs_astresc('"', path);
+        ecs_strbuf_appendstr(buf, escaped);
+        ecs_os_free(escaped);
+        ecs_os_free(path);
+    } else if (ev->entity) {
+        ecs_strbuf_append(buf, "#%u", (uint32_t)ev->entity);
+    } else {
+        ecs_strbuf_appendstr(buf, flecs_timeline_kind_str[ev->kind]);
+    }
+    ecs_strbuf_appendch(buf, '"');
+}
+
+static
+void flecs_timeline_append_event(
+    const ecs_world_t *world,
+    ecs_strbuf_t *buf,
+    int32_t tid,
+    const ecs_timeline_event_t *ev)
+{
+    ecs_strbuf_list_next(buf);
+    ecs_strbuf_appendlit(buf, "{\"name\":");
+    flecs_timeline_append_name(world, buf, ev);
+    ecs_strbuf_appendlit(buf, ",\"cat\":\"");
+    ecs_strbuf_appendstr(buf, flecs_timeline_kind_str[ev->kind]);
+    ecs_strbuf_appendlit(buf, "\",\"ph\":\"X\",\"pid\":0,\"tid\":");
+    ecs_strbuf_appendint(buf, tid);
+    ecs_strbuf_appendlit(buf, ",\"ts\":");
+    flecs_timeline_append_us(buf, ev->start);
+    ecs_strbuf_appendlit(buf, ",\"dur\":");
+    flecs_timeline_append_us(buf, ev->duration);
+
+    if (ev->entity || ev->slice_count > 1) {
+        ecs_strbuf_appendlit(buf, ",\"args\":{");
+        if (ev->entity) {
+            ecs_strbuf_appendlit(buf, "\"entity\":");
+            ecs_strbuf_appendint(buf, (int64_t)ev->entity);
+        }
+        if (ev->slice_count > 1) {
+            if (ev->entity) {
+                ecs_strbuf_appendch(buf, ',');
+            }
+            ecs_strbuf_appendlit(buf, "\"slice\":");
+            ecs_strbuf_appendint(buf, ev->slice);
+            ecs_strbuf_appendlit(buf, ",\"slice_count\":");
+            ecs_strbuf_appendint(buf, ev->slice_count);
+        }
+        ecs_strbuf_appendch(buf, '}');
+    }
+
+    ecs_strbuf_appendch(buf, '}');
+}
+
+static
+void flecs_timeline_append_thread_name(
+    ecs_strbuf_t *buf,
+    int32_t tid)
+{
+    ecs_strbuf_list_next(buf);
+    ecs_strbuf_appendlit(buf,
+        "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":");
+    ecs_strbuf_appendint(buf, tid);
+    if (tid) {
+        ecs_strbuf_append(buf, ",\"args\":{\"name\":\"worker %d\"}}", tid);
+    } else {
+        ecs_strbuf_appendlit(buf, ",\"args\":{\"name\":\"main\"}}");
+    }
+}
+
+int ecs_timeline_to_json_buf(
+    const ecs_world_t *world,
+    ecs_strbuf_t *buf)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(buf != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    if (!world->timeline) {
+        return -1;
+    }
+
+    ecs_strbuf_appendlit(buf, "{\"traceEvents\":");
+    ecs_strbuf_list_push(buf, "[", ",");
+
+    int32_t s, stage_count = world->stage_count;
+    for (s = 0; s < stage_count; s ++) {
+        flecs_timeline_append_thread_name(buf, s);
+    }
+
+    for (s = 0; s < stage_count; s ++) {
+        const ecs_timeline_buffer_t *tb = world->stages[s]->timeline;
+        if (!tb) {
+            continue;
+        }
+
+        /* Oldest event is at head if the buffer wrapped, at 0 otherwise */
+        int32_t i, first = tb->count == tb->capacity ? tb->head : 0;
+        for (i = 0; i < tb->count; i ++) {
+            int32_t index = (first + i) % tb->capacity;
+            flecs_timeline_append_event(world, buf, s, &tb->events[index]);
+        }
+    }
+
+    ecs_strbuf_list_pop(buf, "]");
+    ecs_strbuf_appendlit(buf, ",\"displayTimeUnit\":\"ns\"}");
+
+    return 0;
+error:
+    return -1;
+}
+
+char* ecs_timeline_to_json(
+    const ecs_world_t *world)
+{
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    if (ecs_timeline_to_json_buf(world, &buf)) {
+        ecs_strbuf_reset(&buf);
+        return NULL;
+    }
+    return ecs_strbuf_get(&buf);
+}
+
+int ecs_timeline_to_file(
+    const ecs_world_t *world,
+    const char *filename)
+{
+    ecs_check(filename != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    char *json = ecs_timeline_to_json(world);
+    if (!json) {
+        ecs_err("cannot write timeline: recording is not enabled");
+        goto error;
+    }
+
+    FILE *file;
+    ecs_os_fopen(&file, filename, "w");
+    if (!file) {
+        ecs_err("cannot open file '%s' for writing", filename);
+        ecs_os_free(json);
+        goto error;
+    }
+
+    size_t len = flecs_itosize(ecs_os_strlen(json));
+    size_t written = fwrite(json, 1, len, file);
+    fclose(file);
+    ecs_os_free(json);
+
+    if (written != len) {
+        ecs_err("failed to write timeline to '%s'", filename);
+        goto error;
+    }
+
+    return 0;
+error:
+    return -1;
+}
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * @file addons/timeline/timeline.h
+ * @brief Internal functions for recording timeline events.
+ */
+
+#ifndef FLECS_TIMELINE_PRIVATE_H
+#define FLECS_TIMELINE_PRIVATE_H
+
+#include "../../private_api.h"
+
+#ifdef FLECS_TIMELINE
+
+/* Maximum nesting depth of spans on a single stage */
+#define FLECS_TIMELINE_MAX_DEPTH (32)
+
+typedef enum ecs_timeline_kind_t {
+    EcsTimelineFrame,
+    EcsTimelineSystem,
+    EcsTimelineObserver,
+    EcsTimelineMerge,
+    EcsTimelineSync
+} ecs_timeline_kind_t;
+
+/* A completed span. Spans are stored as complete events with a duration, so
+ * that overwriting the oldest events in the ring buffer can never produce an
+ * end event without a matching begin. */
+typedef struct ecs_timeline_event_t {
+    uint64_t start;                  /* Nanoseconds since recording started */
+    uint64_t duration;               /* Duration in nanoseconds */
+    ecs_entity_t entity;             /* System or observer (0 if none) */
+    int16_t kind;                    /* ecs_timeline_kind_t */
+    int16_t depth;                   /* Nesting depth on the stage */
+    int16_t slice;                   /* Worker slice index */
+    int16_t slice_count;             /* Number of worker slices */
+} ecs_timeline_event_t;
+
+/* Per-stage event buffer. Only accessed by the thread that owns the stage. */
+struct ecs_timeline_buffer_t {
+    ecs_timeline_event_t *events;
+    int32_t capacity;
+    int32_t count;                   /* Number of valid events (<= capacity) */
+    int32_t head;                    /* Index of next event to write */
+    int32_t sp;                      /* Number of open spans */
+    uint64_t stack[FLECS_TIMELINE_MAX_DEPTH]; /* Start times of open spans */
+};
+
+/* Timeline settings shared by all stages */
+struct ecs_timeline_t {
+    int32_t capacity;                /* Events per stage */
+    uint64_t start;                  /* Time at which recording started */
+};
+
+/* Open a span on a stage */
+void flecs_timeline_push(
+    ecs_stage_t *stage);
+
+/* Close the last opened span on a stage and store it in the buffer */
+void flecs_timeline_pop(
+    ecs_stage_t *stage,
+    ecs_timeline_kind_t kind,
+    ecs_entity_t entity,
+    int32_t slice,
+    int32_t slice_count);
+
+/* Free timeline buffer of stage */
+void flecs_timeline_buffer_free(
+    ecs_stage_t *stage);
+
+/* Stop recording and free all timeline resources */
+void flecs_timeline_fini(
+    ecs_world_t *world);
+
+#define flecs_timeline_begin(stage)\
+    do {\
+        if ((stage)->world->timeline) {\
+            flecs_timeline_push(stage);\
+        }\
+    } while (0)
+
+#define flecs_timeline_end(stage, kind, entity, slice, slice_count)\
+    do {\
+        if ((stage)->world->timeline) {\
+            flecs_timeline_pop(stage, kind, entity, slice, slice_count);\
+        }\
+    } while (0)
+
+#else
+
+#define flecs_timeline_begin(stage)
+#define flecs_timeline_end(stage, kind, entity, slice, slice_count)
+#define flecs_timeline_buffer_free(stage)
+#define flecs_timeline_fini(world)
+
+#endif
+
+#endif
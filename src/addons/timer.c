@@ -225,21 +225,22 @@ error:
     return;   
 }
 
-ecs_entity_t ecs_set_rate(
+static
+ecs_entity_t flecs_set_rate(
     ecs_world_t *world,
     ecs_entity_t filter,
     int32_t rate,
-    ecs_entity_t source)
+    ecs_entity_t source,
+    int32_t phase)
 {
-    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
-
     if (!filter) {
         filter = ecs_entity(world, {0});
     }
 
     ecs_set(world, filter, EcsRateFilter, {
         .rate = rate,
-        .src = source
+        .src = source,
+        .tick_count = phase
     });
 
     ecs_system_t *system_data = flecs_poly_get(world, filter, ecs_system_t);
@@ -247,8 +248,72 @@ ecs_entity_t ecs_set_rate(
         system_data->tick_source = filter;
     }  
 
+    return filter;
+}
+
+/* Find phase that is used by the fewest rate filters with the same rate and
+ * source. A filter ticks when its tick count is a multiple of its rate, so
+ * filters that advance together tick on the same frame when their tick count
+ * modulo the rate is equal. */
+static
+int32_t flecs_rate_stagger_phase(
+    ecs_world_t *world,
+    ecs_entity_t filter,
+    int32_t rate,
+    ecs_entity_t source)
+{
+    int32_t *counts = ecs_os_calloc_n(int32_t, rate);
+
+    ecs_iter_t it = ecs_each(world, EcsRateFilter);
+    while (ecs_each_next(&it)) {
+        EcsRateFilter *filters = ecs_field(&it, EcsRateFilter, 0);
+        int32_t i;
+        for (i = 0; i < it.count; i ++) {
+            if (it.entities[i] == filter) {
+                continue;
+            }
+            if (filters[i].rate != rate || filters[i].src != source) {
+                continue;
+            }
+            counts[filters[i].tick_count % rate] ++;
+        }
+    }
+
+    int32_t i, result = 0;
+    for (i = 1; i < rate; i ++) {
+        if (counts[i] < counts[result]) {
+            result = i;
+        }
+    }
+
+    ecs_os_free(counts);
+    return result;
+}
+
+ecs_entity_t ecs_set_rate(
+    ecs_world_t *world,
+    ecs_entity_t filter,
+    int32_t rate,
+    ecs_entity_t source)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    return flecs_set_rate(world, filter, rate, source, 0);
+error:
+    return filter;
+}
+
+ecs_entity_t ecs_set_rate_staggered(
+    ecs_world_t *world,
+    ecs_entity_t filter,
+    int32_t rate,
+    ecs_entity_t source)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(rate > 0, ECS_INVALID_PARAMETER, NULL);
+    int32_t phase = flecs_rate_stagger_phase(world, filter, rate, source);
+    return flecs_set_rate(world, filter, rate, source, phase);
 error:
-    return filter;     
+    return 0;
 }
 
 void ecs_set_tick_source(
@@ -116,6 +116,10 @@ void ecs_on_set(EcsIdentifier)(ecs_iter_t *it) {
                 flecs_name_index_update_name(index, e, hash, name);
             }
         }
+
+        if (kind == EcsName) {
+            flecs_path_cache_invalidate(world, it->entities[i]);
+        }
     }
 }
 
@@ -712,6 +716,7 @@ void flecs_bootstrap(
     ecs_make_alive(world, EcsTarget);
     ecs_make_alive(world, EcsSparse);
     ecs_make_alive(world, EcsUnion);
+    ecs_make_alive(world, EcsOrderedChildren);
 
     /* Register type information for builtin components */
     flecs_type_info_init(world, EcsComponent, { 
@@ -836,6 +841,7 @@ void flecs_bootstrap(
     flecs_bootstrap_trait(world, EcsOnInstantiate);
     flecs_bootstrap_trait(world, EcsSparse);
     flecs_bootstrap_trait(world, EcsUnion);
+    flecs_bootstrap_trait(world, EcsOrderedChildren);
 
     flecs_bootstrap_tag(world, EcsRemove);
     flecs_bootstrap_tag(world, EcsDelete);
@@ -231,16 +231,40 @@ void flecs_strbuf_ftoa(
     ecs_strbuf_appendstrn(out, buf, (int32_t)(ptr - buf));
 }
 
+/* Pass buffer content to flush action */
+static
+void flecs_strbuf_flush(
+    ecs_strbuf_t *b)
+{
+    if (b->length && !b->flush_error) {
+        if (b->flush_action(b->content, b->length, b->flush_ctx)) {
+            /* Discard remaining output, as the sink is broken */
+            b->flush_error = true;
+        }
+    }
+    b->length = 0;
+}
+
 /* Add an extra element to the buffer */
 static
 void flecs_strbuf_grow(
     ecs_strbuf_t *b)
 {
+    if (b->flush_action && b->length && b->size >= ECS_STRBUF_FLUSH_SIZE) {
+        /* Buffer is full, flush instead of growing. If buffer is empty an
+         * append is larger than the buffer, in which case it still grows. */
+        flecs_strbuf_flush(b);
+        return;
+    }
+
     if (!b->content) {
         b->content = b->small_string;
         b->size = ECS_STRBUF_SMALL_STRING_SIZE;
     } else if (b->content == b->small_string) {
         b->size *= 2;
+        if (b->flush_action && b->size < ECS_STRBUF_FLUSH_SIZE) {
+            b->size = ECS_STRBUF_FLUSH_SIZE;
+        }
         b->content = ecs_os_malloc_n(char, b->size);
         ecs_os_memcpy(b->content, b->small_string, b->length);
     } else {
@@ -429,6 +453,8 @@ char* ecs_strbuf_get(
     ecs_strbuf_t *b) 
 {
     ecs_assert(b != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_assert(b->flush_action == NULL, ECS_INVALID_OPERATION,
+        "use ecs_strbuf_flush for buffer with flush action");
     char *result = b->content;
     if (!result) {
         return NULL;
@@ -460,6 +486,19 @@ char* ecs_strbuf_get_small(
     return result;
 }
 
+int ecs_strbuf_flush(
+    ecs_strbuf_t *b)
+{
+    ecs_assert(b != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_assert(b->flush_action != NULL, ECS_INVALID_OPERATION, 
+        "buffer has no flush action");
+    flecs_strbuf_flush(b);
+
+    int result = b->flush_error ? -1 : 0;
+    ecs_strbuf_reset(b);
+    return result;
+}
+
 void ecs_strbuf_reset(
     ecs_strbuf_t *b) 
 {
@@ -467,7 +506,13 @@ void ecs_strbuf_reset(
     if (b->content && b->content != b->small_string) {
         ecs_os_free(b->content);
     }
+
+    /* Flush action is a property of the buffer, not of its content */
+    ecs_strbuf_flush_action_t flush_action = b->flush_action;
+    void *flush_ctx = b->flush_ctx;
     *b = ECS_STRBUF_INIT;
+    b->flush_action = flush_action;
+    b->flush_ctx = flush_ctx;
 }
 
 void ecs_strbuf_list_push(
@@ -1,5 +1,11 @@
 #include "../private_api.h"
 
+/* Elements are stored in a dense array per value, which makes it possible to
+ * iterate all elements for a value without chasing pointers. Each element 
+ * stores its value and its index in the dense array, so that setting a value
+ * is O(1): the element is swapped with the last element of its old array, and
+ * appended to the array of the new value. */
+
 static
 ecs_switch_page_t* flecs_switch_page_ensure(
     ecs_switch_t* sw,
@@ -11,15 +17,15 @@ ecs_switch_page_t* flecs_switch_page_ensure(
 
     ecs_switch_page_t *page = ecs_vec_get_t(
         &sw->pages, ecs_switch_page_t, page_index);
-    if (!ecs_vec_count(&page->nodes)) {
-        ecs_vec_init_t(sw->hdrs.allocator, &page->nodes, ecs_switch_node_t,
-            FLECS_SPARSE_PAGE_SIZE);
+    if (!ecs_vec_count(&page->values)) {
         ecs_vec_init_t(sw->hdrs.allocator, &page->values, uint64_t,
             FLECS_SPARSE_PAGE_SIZE);
-        ecs_vec_set_min_count_zeromem_t(sw->hdrs.allocator, &page->nodes, 
-            ecs_switch_node_t, FLECS_SPARSE_PAGE_SIZE);
+        ecs_vec_init_t(sw->hdrs.allocator, &page->indices, int32_t,
+            FLECS_SPARSE_PAGE_SIZE);
         ecs_vec_set_min_count_zeromem_t(sw->hdrs.allocator, &page->values, 
             uint64_t, FLECS_SPARSE_PAGE_SIZE);
+        ecs_vec_set_min_count_zeromem_t(sw->hdrs.allocator, &page->indices, 
+            int32_t, FLECS_SPARSE_PAGE_SIZE);
     }
 
     return page;
@@ -37,7 +43,7 @@ ecs_switch_page_t* flecs_switch_page_get(
 
     ecs_switch_page_t *page = ecs_vec_get_t(
         &sw->pages, ecs_switch_page_t, page_index);
-    if (!ecs_vec_count(&page->nodes)) {
+    if (!ecs_vec_count(&page->values)) {
         return NULL;
     }
 
@@ -49,24 +55,21 @@ void flecs_switch_page_fini(
     ecs_switch_t* sw,
     ecs_switch_page_t *page)
 {
-    if (ecs_vec_count(&page->nodes)) {
-        ecs_vec_fini_t(sw->hdrs.allocator, &page->nodes, ecs_switch_node_t);
+    if (ecs_vec_count(&page->values)) {
         ecs_vec_fini_t(sw->hdrs.allocator, &page->values, uint64_t);
+        ecs_vec_fini_t(sw->hdrs.allocator, &page->indices, int32_t);
     }
 }
 
 static
-ecs_switch_node_t* flecs_switch_get_node(
+int32_t* flecs_switch_get_index(
     ecs_switch_t* sw,
     uint32_t element)
 {
-    if (!element) {
-        return NULL;
-    }
-
-    ecs_switch_page_t *page = flecs_switch_page_ensure(sw, element);
+    ecs_switch_page_t *page = flecs_switch_page_get(sw, element);
+    ecs_assert(page != NULL, ECS_INTERNAL_ERROR, NULL);
     int32_t page_offset = FLECS_SPARSE_OFFSET(element);
-    return ecs_vec_get_t(&page->nodes, ecs_switch_node_t, page_offset);
+    return ecs_vec_get_t(&page->indices, int32_t, page_offset);
 }
 
 void flecs_switch_init(
@@ -86,6 +89,14 @@ void flecs_switch_fini(
         flecs_switch_page_fini(sw, &pages[i]);
     }
     ecs_vec_fini_t(sw->hdrs.allocator, &sw->pages, ecs_switch_page_t);
+
+    ecs_map_iter_t it = ecs_map_iter(&sw->hdrs);
+    while (ecs_map_next(&it)) {
+        ecs_vec_t *elements = ecs_map_ptr(&it);
+        ecs_vec_fini_t(sw->hdrs.allocator, elements, uint32_t);
+        flecs_free_t(sw->hdrs.allocator, ecs_vec_t, elements);
+    }
+
     ecs_map_fini(&sw->hdrs);
 }
 
@@ -102,45 +113,38 @@ bool flecs_switch_set(
         return false;
     }
 
-    ecs_switch_node_t *node = ecs_vec_get_t(
-        &page->nodes, ecs_switch_node_t, page_offset);
+    int32_t *index = ecs_vec_get_t(&page->indices, int32_t, page_offset);
 
     uint64_t prev_value = elem[0];
     if (prev_value) {
-        ecs_switch_node_t *prev = flecs_switch_get_node(sw, node->prev);
-        if (prev) {
-            prev->next = node->next;
-        }
-
-        ecs_switch_node_t *next = flecs_switch_get_node(sw, node->next);
-        if (next) {
-            next->prev = node->prev;
-        }
-
-        if (!prev) {
-            uint64_t *hdr = ecs_map_get(&sw->hdrs, prev_value);
-            ecs_assert(hdr[0] == (uint64_t)element, ECS_INTERNAL_ERROR, NULL);
-            hdr[0] = (uint64_t)node->next;
+        /* Remove element from elements of previous value */
+        ecs_vec_t *elements = ecs_map_get_deref(&sw->hdrs, ecs_vec_t, prev_value);
+        ecs_assert(elements != NULL, ECS_INTERNAL_ERROR, NULL);
+
+        uint32_t *array = ecs_vec_first_t(elements, uint32_t);
+        int32_t last = ecs_vec_count(elements) - 1;
+        ecs_assert(array[index[0]] == element, ECS_INTERNAL_ERROR, NULL);
+        if (index[0] != last) {
+            uint32_t moved = array[last];
+            array[index[0]] = moved;
+            flecs_switch_get_index(sw, moved)[0] = index[0];
         }
+        ecs_vec_remove_last(elements);
     }
 
     elem[0] = value;
 
     if (value) {
-        uint64_t *hdr = ecs_map_ensure(&sw->hdrs, value);
-
-        if (!hdr[0]) {
-            hdr[0] = (uint64_t)element;
-        } else {
-            ecs_switch_node_t *head = flecs_switch_get_node(sw, (uint32_t)hdr[0]);
-            ecs_assert(head->prev == 0, ECS_INTERNAL_ERROR, NULL);
-            head->prev = element;
-
-            node->next = (uint32_t)hdr[0];
-            hdr[0] = (uint64_t)element;
+        /* Append element to elements of new value */
+        ecs_vec_t **elements = ecs_map_ensure_ref(&sw->hdrs, ecs_vec_t, value);
+        if (!elements[0]) {
+            elements[0] = flecs_alloc_t(sw->hdrs.allocator, ecs_vec_t);
+            ecs_vec_init_t(sw->hdrs.allocator, elements[0], uint32_t, 0);
         }
 
-        node->prev = 0;
+        index[0] = ecs_vec_count(elements[0]);
+        ecs_vec_append_t(sw->hdrs.allocator, elements[0], uint32_t)[0] = 
+            element;
     }
 
     return true;
@@ -167,19 +171,32 @@ uint64_t flecs_switch_get(
     return elem[0];
 }
 
+const ecs_vec_t* flecs_switch_elements(
+    const ecs_switch_t *sw,
+    uint64_t value)
+{
+    return ecs_map_get_deref(&sw->hdrs, ecs_vec_t, value);
+}
+
+/* Elements are returned from last to first, so that the most recently set 
+ * element is returned first. */
 uint32_t flecs_switch_first(
     const ecs_switch_t *sw,
     uint64_t value)
 {
-    uint64_t *hdr = ecs_map_get(&sw->hdrs, value);
-    if (!hdr) {
+    const ecs_vec_t *elements = flecs_switch_elements(sw, value);
+    if (!elements) {
         return 0;
     }
 
-    return (uint32_t)hdr[0];
+    int32_t count = ecs_vec_count(elements);
+    if (!count) {
+        return 0;
+    }
+
+    return ecs_vec_get_t(elements, uint32_t, count - 1)[0];
 }
 
-FLECS_DBG_API
 uint32_t flecs_switch_next(
     const ecs_switch_t *sw,
     uint32_t previous)
@@ -190,9 +207,19 @@ uint32_t flecs_switch_next(
     }
 
     int32_t offset = FLECS_SPARSE_OFFSET(previous);
-    ecs_switch_node_t *elem = ecs_vec_get_t(
-        &page->nodes, ecs_switch_node_t, offset);
-    return elem->next;
+    uint64_t value = ecs_vec_get_t(&page->values, uint64_t, offset)[0];
+    if (!value) {
+        return 0;
+    }
+
+    int32_t index = ecs_vec_get_t(&page->indices, int32_t, offset)[0];
+    if (!index) {
+        return 0;
+    }
+
+    const ecs_vec_t *elements = flecs_switch_elements(sw, value);
+    ecs_assert(elements != NULL, ECS_INTERNAL_ERROR, NULL);
+    return ecs_vec_get_t(elements, uint32_t, index - 1)[0];
 }
 
 ecs_map_iter_t flecs_switch_targets(
@@ -37,6 +37,13 @@ ecs_iter_t ecs_each_id(
 
     each_iter->sources = 0;
     each_iter->trs = NULL;
+
+    if (idr->flags & EcsIdOrderedChildren) {
+        /* Return children in order as a single result */
+        each_iter->ordered = &idr->ordered_children;
+        return it;
+    }
+
     flecs_table_cache_iter((ecs_table_cache_t*)idr, &each_iter->it);
 
     return it;
@@ -48,6 +55,21 @@ bool ecs_each_next(
     ecs_iter_t *it)
 {
     ecs_each_iter_t *each_iter = &it->priv_.iter.each;
+    const ecs_vec_t *ordered = each_iter->ordered;
+    if (ordered) {
+        each_iter->ordered = NULL;
+        it->flags |= EcsIterIsValid;
+        it->table = NULL;
+        it->count = ecs_vec_count(ordered);
+        it->entities = ecs_vec_first_t(ordered, ecs_entity_t);
+        it->ids = &each_iter->ids;
+        it->trs = &each_iter->trs;
+        it->sources = &each_iter->sources;
+        it->sizes = &each_iter->sizes;
+        it->set_fields = 1;
+        return it->count != 0;
+    }
+
     const ecs_table_record_t *next = flecs_table_cache_next(
         &each_iter->it, ecs_table_record_t);
     it->flags |= EcsIterIsValid;
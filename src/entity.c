@@ -17,18 +17,6 @@
 #include "addons/script/script.h"
 #endif
 
-static
-const ecs_entity_t* flecs_bulk_new(
-    ecs_world_t *world,
-    ecs_table_t *table,
-    const ecs_entity_t *entities,
-    ecs_type_t *component_ids,
-    int32_t count,
-    void **c_info,
-    bool move,
-    int32_t *row_out,
-    ecs_table_diff_t *diff);
-
 typedef struct {
     const ecs_type_info_t *ti;
     void *ptr;
@@ -403,9 +391,33 @@ void flecs_instantiate_children(
 
     /* Instantiate the prefab child table for each new instance */
     const ecs_entity_t *instances = ecs_table_entities(table);
+    const ecs_entity_t *children = ecs_table_entities(child_table);
     int32_t child_count = ecs_table_count(child_table);
     ecs_entity_t *child_ids = flecs_walloc_n(world, ecs_entity_t, child_count);
 
+    /* Work that only depends on the prefab children is done once for all
+     * instances. Store for each child the offset from the root prefab used to
+     * reserve the instance child id (0 if the offset can't be used), and
+     * whether the child has children of its own. */
+    ecs_entity_t root_prefab = ctx ? ctx->root_prefab : base;
+    ecs_entity_t *child_offsets = flecs_walloc_n(
+        world, ecs_entity_t, child_count);
+    bool *child_has_children = flecs_walloc_n(world, bool, child_count);
+    for (j = 0; j < child_count; j ++) {
+        ecs_entity_t child = children[j];
+        if ((uint32_t)child < (uint32_t)root_prefab) {
+            /* Child id is smaller than root prefab id, can't use offset */
+            child_offsets[j] = 0;
+        } else {
+            /* Get prefab offset, ignore lifecycle generation count */
+            child_offsets[j] = (uint32_t)child - (uint32_t)root_prefab;
+            ecs_assert(child_offsets[j] != 0, ECS_INTERNAL_ERROR, NULL);
+        }
+
+        child_has_children[j] = 
+            flecs_id_record_get(world, ecs_childof(child)) != NULL;
+    }
+
     for (i = row; i < count + row; i ++) {
         ecs_entity_t instance = instances[i];
         ecs_table_t *i_table = NULL;
@@ -423,8 +435,6 @@ void flecs_instantiate_children(
         /* The instance is trying to instantiate from a base that is also
          * its parent. This would cause the hierarchy to instantiate itself
          * which would cause infinite recursion. */
-        const ecs_entity_t *children = ecs_table_entities(child_table);
-
 #ifdef FLECS_DEBUG
         for (j = 0; j < child_count; j ++) {
             ecs_entity_t child = children[j];        
@@ -446,17 +456,12 @@ void flecs_instantiate_children(
         }
 
         for (j = 0; j < child_count; j ++) {
-            if ((uint32_t)children[j] < (uint32_t)ctx_cur.root_prefab) {
-                /* Child id is smaller than root prefab id, can't use offset */
+            ecs_entity_t prefab_offset = child_offsets[j];
+            if (!prefab_offset) {
                 child_ids[j] = ecs_new(world);
                 continue;
             }
 
-            /* Get prefab offset, ignore lifecycle generation count */
-            ecs_entity_t prefab_offset =
-                (uint32_t)children[j] - (uint32_t)ctx_cur.root_prefab;
-            ecs_assert(prefab_offset != 0, ECS_INTERNAL_ERROR, NULL);
-
             /* First check if any entity with the desired id exists */
             ecs_entity_t instance_child = (uint32_t)ctx_cur.root_instance + prefab_offset;
             ecs_entity_t alive_id = flecs_entities_get_alive(world, instance_child);
@@ -491,11 +496,17 @@ void flecs_instantiate_children(
 
         /* If prefab child table has children itself, recursively instantiate */
         for (j = 0; j < child_count; j ++) {
+            if (!child_has_children[j]) {
+                continue;
+            }
+
             ecs_entity_t child = children[j];
             flecs_instantiate(world, child, i_table, child_row + j, 1, &ctx_cur);
         }
     }
 
+    flecs_wfree_n(world, bool, child_count, child_has_children);
+    flecs_wfree_n(world, ecs_entity_t, child_count, child_offsets);
     flecs_wfree_n(world, ecs_entity_t, child_count, child_ids);
 error:
     return;    
@@ -652,6 +663,146 @@ void flecs_union_on_remove(
     }
 }
 
+static
+ecs_id_record_t* flecs_ordered_children_get(
+    ecs_world_t *world,
+    const ecs_type_t *ids)
+{
+    int32_t i, count = ids->count;
+    const ecs_id_t *array = ids->array;
+    for (i = 0; i < count; i ++) {
+        ecs_id_t id = array[i];
+        if (ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == EcsChildOf) {
+            ecs_id_record_t *idr = flecs_id_record_get(world, id);
+            if (idr && (idr->flags & EcsIdOrderedChildren)) {
+                return idr;
+            }
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+static
+void flecs_ordered_children_on_add(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t row,
+    int32_t count,
+    const ecs_type_t *added)
+{
+    ecs_id_record_t *idr = flecs_ordered_children_get(world, added);
+    if (!idr) {
+        /* Parent didn't change */
+        return;
+    }
+
+    ecs_entity_t *dst = ecs_vec_grow_t(&world->allocator, 
+        &idr->ordered_children, ecs_entity_t, count);
+    ecs_os_memcpy_n(dst, &ecs_table_entities(table)[row], 
+        ecs_entity_t, count);
+}
+
+static
+void flecs_ordered_children_on_remove(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t row,
+    int32_t count,
+    const ecs_type_t *removed)
+{
+    ecs_id_record_t *idr = flecs_ordered_children_get(world, removed);
+    if (!idr) {
+        /* Parent didn't change */
+        return;
+    }
+
+    ecs_vec_t *vec = &idr->ordered_children;
+    ecs_entity_t *children = ecs_vec_first_t(vec, ecs_entity_t);
+    int32_t i, j, child_count = ecs_vec_count(vec);
+    ecs_assert(child_count >= count, ECS_INTERNAL_ERROR, NULL);
+
+    if (child_count == count) {
+        /* All children are removed */
+        ecs_vec_clear(vec);
+        return;
+    }
+
+    if (count == 1) {
+        /* Recently added children are more likely to be removed, so search
+         * from the back of the list. */
+        ecs_entity_t e = ecs_table_entities(table)[row];
+        for (i = child_count - 1; i >= 0; i --) {
+            if (children[i] == e) {
+                break;
+            }
+        }
+
+        ecs_assert(i != -1, ECS_INTERNAL_ERROR, NULL);
+        int32_t move_count = child_count - i - 1;
+        ecs_os_memmove_n(&children[i], &children[i + 1], ecs_entity_t, 
+            move_count);
+        ecs_vec_remove_last(vec);
+        return;
+    }
+
+    /* Removed children are still stored in the table, so the entity index can
+     * be used to find them in a single pass over the list. */
+    for (i = 0, j = 0; i < child_count; i ++) {
+        ecs_entity_t e = children[i];
+        ecs_record_t *r = flecs_entities_get_any(world, e);
+        if (r->table == table) {
+            int32_t r_row = ECS_RECORD_TO_ROW(r->row);
+            if (r_row >= row && r_row < (row + count)) {
+                continue;
+            }
+        }
+        children[j ++] = e;
+    }
+
+    ecs_assert(j == (child_count - count), ECS_INTERNAL_ERROR, NULL);
+    ecs_vec_set_count_t(&world->allocator, vec, ecs_entity_t, j);
+}
+
+static
+void flecs_ordered_children_trait(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t row,
+    int32_t count,
+    const ecs_type_t *ids,
+    bool add)
+{
+    int32_t i, id_count = ids->count;
+    for (i = 0; i < id_count; i ++) {
+        if (ids->array[i] == EcsOrderedChildren) {
+            break;
+        }
+    }
+
+    if (i == id_count) {
+        /* Trait didn't change */
+        return;
+    }
+
+    const ecs_entity_t *entities = &ecs_table_entities(table)[row];
+    for (i = 0; i < count; i ++) {
+        ecs_id_record_t *idr = flecs_id_record_get(
+            world, ecs_childof(entities[i]));
+        if (!idr) {
+            /* List is created when the first child is added */
+            continue;
+        }
+
+        if (add) {
+            flecs_id_record_init_ordered_children(world, idr);
+        } else {
+            flecs_id_record_fini_ordered_children(world, idr);
+        }
+    }
+}
+
 static
 void flecs_notify_on_add(
     ecs_world_t *world,
@@ -669,6 +820,14 @@ void flecs_notify_on_add(
     const ecs_type_t *added = &diff->added;
 
     if (added->count) {
+        if (table->flags & EcsTableHasOrderedParent) {
+            flecs_ordered_children_on_add(world, table, row, count, added);
+        }
+
+        if (table->flags & EcsTableHasOrderedChildren) {
+            flecs_ordered_children_trait(world, table, row, count, added, true);
+        }
+
         ecs_flags32_t diff_flags = 
             diff->added_flags|(table->flags & EcsTableHasTraversable);
         if (!diff_flags) {
@@ -711,6 +870,15 @@ void flecs_notify_on_remove(
     ecs_assert(count != 0, ECS_INTERNAL_ERROR, NULL);
 
     if (removed->count) {
+        if (table->flags & EcsTableHasOrderedParent) {
+            flecs_ordered_children_on_remove(world, table, row, count, removed);
+        }
+
+        if (table->flags & EcsTableHasOrderedChildren) {
+            flecs_ordered_children_trait(
+                world, table, row, count, removed, false);
+        }
+
         ecs_flags32_t diff_flags = 
             diff->removed_flags|(table->flags & EcsTableHasTraversable);
         if (!diff_flags) {
@@ -774,6 +942,9 @@ void flecs_update_name_index(
         ecs_entity_t e = entities[i];
         EcsIdentifier *name = &names[i];
 
+        /* Entity has a new parent, which changes its path */
+        flecs_path_cache_invalidate(world, e);
+
         uint64_t index_hash = name->index_hash;
         if (index_hash) {
             flecs_name_index_remove(src_index, e, index_hash);
@@ -995,7 +1166,6 @@ error:
     return;
 }
 
-static
 const ecs_entity_t* flecs_bulk_new(
     ecs_world_t *world,
     ecs_table_t *table,
@@ -1278,13 +1448,15 @@ void flecs_invoke_hook(
     world->stages[0]->defer = defer;
 }
 
-void flecs_notify_on_set(
+static
+void flecs_notify_on_set_w_flags(
     ecs_world_t *world,
     ecs_table_t *table,
     int32_t row,
     int32_t count,
     ecs_type_t *ids,
-    bool owned)
+    bool owned,
+    ecs_flags32_t event_flags)
 {
     ecs_assert(ids != NULL, ECS_INTERNAL_ERROR, NULL);
     const ecs_entity_t *entities = &ecs_table_entities(table)[row];
@@ -1333,11 +1505,23 @@ void flecs_notify_on_set(
             .table = table,
             .offset = row,
             .count = count,
-            .observable = world
+            .observable = world,
+            .flags = event_flags
         });
     }
 }
 
+void flecs_notify_on_set(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t row,
+    int32_t count,
+    ecs_type_t *ids,
+    bool owned)
+{
+    flecs_notify_on_set_w_flags(world, table, row, count, ids, owned, 0);
+}
+
 void flecs_record_add_flag(
     ecs_record_t *record,
     uint32_t flag)
@@ -2725,6 +2909,106 @@ bool flecs_on_delete_clear_ids(
     return true;
 }
 
+/* Range of component elements destructed by a single task */
+typedef struct ecs_dtor_job_t {
+    ecs_deleted_column_t *columns;
+    int32_t column_count;
+    int64_t begin;                   /* First element (across all columns) */
+    int64_t end;                     /* Last element + 1 */
+} ecs_dtor_job_t;
+
+static
+void flecs_dtor_job_run(
+    ecs_dtor_job_t *job)
+{
+    int64_t offset = 0;
+    int32_t c;
+    for (c = 0; c < job->column_count; c ++) {
+        ecs_deleted_column_t *dc = &job->columns[c];
+        int64_t col_begin = offset;
+        int64_t col_end = offset + ecs_vec_count(&dc->data);
+        offset = col_end;
+
+        if (col_end <= job->begin) {
+            continue;
+        }
+        if (col_begin >= job->end) {
+            break;
+        }
+
+        int32_t from = (int32_t)(ECS_MAX(job->begin, col_begin) - col_begin);
+        int32_t to = (int32_t)(ECS_MIN(job->end, col_end) - col_begin);
+        const ecs_type_info_t *ti = dc->ti;
+        ti->hooks.dtor(ECS_ELEM(dc->data.array, ti->size, from), to - from, 
+            ECS_CONST_CAST(ecs_type_info_t*, ti));
+    }
+}
+
+static
+void* flecs_dtor_job_task(
+    void *arg)
+{
+    flecs_dtor_job_run(arg);
+    return NULL;
+}
+
+/* Run destructors for the columns of deleted tables. The elements of all
+ * columns are divided in equal ranges between the delete threads, so that a
+ * single large table is destructed in parallel as well. */
+static
+void flecs_on_delete_run_dtors(
+    ecs_world_t *world)
+{
+    ecs_vec_t *deleted = &world->store.deleted_columns;
+    int32_t i, count = ecs_vec_count(deleted);
+    if (!count) {
+        return;
+    }
+
+    ecs_deleted_column_t *columns = ecs_vec_first(deleted);
+    int64_t total = 0;
+    for (i = 0; i < count; i ++) {
+        total += ecs_vec_count(&columns[i].data);
+    }
+
+    int32_t job_count = world->delete_threads;
+    if (!ecs_os_has_task_support() || total < FLECS_PARALLEL_DTOR_MIN) {
+        job_count = 1;
+    }
+
+    ecs_dtor_job_t *jobs = flecs_walloc_n(world, ecs_dtor_job_t, job_count);
+    ecs_os_thread_t *tasks = flecs_walloc_n(world, ecs_os_thread_t, job_count);
+    for (i = 0; i < job_count; i ++) {
+        jobs[i].columns = columns;
+        jobs[i].column_count = count;
+        jobs[i].begin = total * i / job_count;
+        jobs[i].end = total * (i + 1) / job_count;
+    }
+
+    ecs_dbg_3("#[red]delete#[reset] run destructors for %d components "
+        "on %d threads", (int32_t)total, job_count);
+
+    for (i = 1; i < job_count; i ++) {
+        tasks[i] = ecs_os_task_new(flecs_dtor_job_task, &jobs[i]);
+    }
+
+    flecs_dtor_job_run(&jobs[0]);
+
+    for (i = 1; i < job_count; i ++) {
+        ecs_os_task_join(tasks[i]);
+    }
+
+    flecs_wfree_n(world, ecs_os_thread_t, job_count, tasks);
+    flecs_wfree_n(world, ecs_dtor_job_t, job_count, jobs);
+
+    /* Storage is freed on the main thread, as allocators aren't thread safe */
+    for (i = 0; i < count; i ++) {
+        ecs_vec_fini(&world->allocator, &columns[i].data, columns[i].ti->size);
+    }
+
+    ecs_vec_clear(deleted);
+}
+
 static
 void flecs_on_delete(
     ecs_world_t *world,
@@ -2748,8 +3032,12 @@ void flecs_on_delete(
         ecs_dbg_2("#[red]delete#[reset]");
         ecs_log_push_2();
 
-        /* Empty tables with all the to be deleted ids */
+        /* Empty tables with all the to be deleted ids. If delete threads are
+         * configured, destructors run after all tables are emptied. */
+        world->store.defer_dtors = world->delete_threads != 0;
         flecs_on_delete_clear_tables(world);
+        world->store.defer_dtors = false;
+        flecs_on_delete_run_dtors(world);
 
         /* All marked tables are empty, ensure they're in the right list */
         ecs_run_aperiodic(world, EcsAperiodicEmptyTables);
@@ -2792,6 +3080,19 @@ void ecs_delete_with(
     flecs_journal_end();
 }
 
+void ecs_set_delete_threads(
+    ecs_world_t *world,
+    int32_t threads)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(threads >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!threads || ecs_os_has_task_support(), ECS_MISSING_OS_API, 
+        "task_new, task_join");
+    world->delete_threads = threads;
+error:
+    return;
+}
+
 void ecs_remove_all(
     ecs_world_t *world,
     ecs_id_t id)
@@ -3302,6 +3603,45 @@ error:
     return;
 }
 
+/* Resolve component pointer for ref after the fast path failed, and cache it
+ * for the current table version and row of the entity. */
+static
+void* flecs_ref_sync(
+    const ecs_world_t *world,
+    ecs_ref_t *ref,
+    ecs_table_t *table,
+    int32_t row)
+{
+    ref->ptr = NULL;
+
+    ecs_table_record_t *tr = ref->tr;
+    if (flecs_ref_needs_sync(ref, tr, table)) {
+        tr = ref->tr = flecs_table_record_get(world, table, ref->id);
+        if (!tr) {
+            return NULL;
+        }
+
+        ref->table_id = table->id;
+        ecs_assert(tr->hdr.table == table, ECS_INTERNAL_ERROR, NULL);
+    }
+
+    int32_t column = tr->column;
+    if (column == -1) {
+        /* Sparse storage is not owned by the table, so pointers to sparse 
+         * components are not cached. */
+        ecs_id_record_t *idr = (ecs_id_record_t*)tr->hdr.cache;
+        if (idr->flags & EcsIdIsSparse) {
+            return flecs_sparse_get_any(idr->sparse, 0, ref->entity);
+        }
+        return NULL;
+    }
+
+    ref->ptr = flecs_table_get_component(table, column, row).ptr;
+    ref->table_version = table->version;
+    ref->row = row;
+    return ref->ptr;
+}
+
 void* ecs_ref_get_id(
     const ecs_world_t *world,
     ecs_ref_t *ref,
@@ -3323,27 +3663,116 @@ void* ecs_ref_get_id(
     int32_t row = ECS_RECORD_TO_ROW(r->row);
     ecs_check(row < ecs_table_count(table), ECS_INTERNAL_ERROR, NULL);
 
-    ecs_table_record_t *tr = ref->tr;
-    if (flecs_ref_needs_sync(ref, tr, table)) {
-        tr = ref->tr = flecs_table_record_get(world, table, id);
-        if (!tr) {
-            return NULL;
+    /* Table versions are unique across tables, so if the version matches the
+     * entity is still in the same table, and the table storage has not been
+     * reallocated since the pointer was cached. */
+    if (ref->ptr && ref->table_version == table->version && ref->row == row) {
+        return ref->ptr;
+    }
+
+    return flecs_ref_sync(world, ref, table, row);
+error:
+    return NULL;
+}
+
+/* Element used to sort stale refs by table, component and row */
+typedef struct flecs_ref_sort_elem_t {
+    uint64_t table_id;
+    ecs_id_t id;
+    int32_t row;
+    int32_t index;
+} flecs_ref_sort_elem_t;
+
+static
+int flecs_ref_sort_cmp(
+    const void *ptr_a,
+    const void *ptr_b)
+{
+    const flecs_ref_sort_elem_t *a = ptr_a;
+    const flecs_ref_sort_elem_t *b = ptr_b;
+    if (a->table_id != b->table_id) {
+        return (a->table_id > b->table_id) - (a->table_id < b->table_id);
+    }
+    if (a->id != b->id) {
+        return (a->id > b->id) - (a->id < b->id);
+    }
+    return (a->row > b->row) - (a->row < b->row);
+}
+
+void ecs_ref_get_array(
+    const ecs_world_t *world,
+    ecs_ref_t *refs,
+    int32_t count,
+    void **ptrs)
+{
+    flecs_ref_sort_elem_t *stale = NULL;
+
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || refs != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || ptrs != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    world = ecs_get_world(world);
+
+    /* Return cached pointers for refs that are up to date, collect the rest */
+    int32_t i, stale_count = 0;
+    for (i = 0; i < count; i ++) {
+        ecs_ref_t *ref = &refs[i];
+        ecs_check(ref->record != NULL, ECS_INVALID_PARAMETER, 
+            "ref not initialized");
+
+        ecs_table_t *table = ref->record->table;
+        if (!table) {
+            ptrs[i] = NULL;
+            continue;
         }
 
-        ref->table_id = table->id;
-        ecs_assert(tr->hdr.table == r->table, ECS_INTERNAL_ERROR, NULL);
+        int32_t row = ECS_RECORD_TO_ROW(ref->record->row);
+        if (ref->ptr && ref->table_version == table->version && 
+            ref->row == row) 
+        {
+            ptrs[i] = ref->ptr;
+            continue;
+        }
+
+        if (!stale) {
+            stale = ecs_os_malloc_n(flecs_ref_sort_elem_t, count - i);
+        }
+
+        stale[stale_count ++] = (flecs_ref_sort_elem_t){
+            .table_id = table->id,
+            .id = ref->id,
+            .row = row,
+            .index = i
+        };
     }
 
-    int32_t column = tr->column;
-    if (column == -1) {
-        ecs_id_record_t *idr = (ecs_id_record_t*)tr->hdr.cache;
-        if (idr->flags & EcsIdIsSparse) {
-            return flecs_sparse_get_any(idr->sparse, 0, ref->entity);
+    if (!stale_count) {
+        return;
+    }
+
+    /* Resolve stale refs in storage order. Refs to the same component in the
+     * same table share a single table record lookup. */
+    qsort(stale, flecs_itosize(stale_count), sizeof(flecs_ref_sort_elem_t),
+        flecs_ref_sort_cmp);
+
+    ecs_table_record_t *tr = NULL;
+    for (i = 0; i < stale_count; i ++) {
+        flecs_ref_sort_elem_t *elem = &stale[i];
+        ecs_ref_t *ref = &refs[elem->index];
+        ecs_table_t *table = ref->record->table;
+
+        if (tr && tr->hdr.table == table && i && stale[i - 1].id == elem->id) {
+            ref->tr = tr;
+            ref->table_id = table->id;
         }
+
+        ptrs[elem->index] = flecs_ref_sync(world, ref, table, elem->row);
+        tr = ref->tr;
     }
-    return flecs_table_get_component(table, column, row).ptr;
+
 error:
-    return NULL;
+    ecs_os_free(stale);
 }
 
 void* ecs_emplace_id(
@@ -3819,6 +4248,53 @@ ecs_entity_t ecs_get_parent(
     return ecs_get_target(world, entity, EcsChildOf, 0);
 }
 
+void ecs_set_child_order(
+    ecs_world_t *world,
+    ecs_entity_t parent,
+    const ecs_entity_t *children,
+    int32_t child_count)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(ecs_is_alive(world, parent), ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!child_count || children != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION,
+        "cannot change child order while world is in readonly mode");
+    ecs_check(ecs_owns_id(world, parent, EcsOrderedChildren), 
+        ECS_INVALID_OPERATION, 
+            "parent must have OrderedChildren trait to set child order");
+
+    ecs_id_record_t *idr = flecs_id_record_get(world, ecs_childof(parent));
+    if (!idr) {
+        ecs_check(!child_count, ECS_INVALID_PARAMETER, 
+            "entity in child order is not a child of parent");
+        return;
+    }
+
+    ecs_assert(idr->flags & EcsIdOrderedChildren, ECS_INTERNAL_ERROR, NULL);
+    ecs_vec_t *vec = &idr->ordered_children;
+    ecs_check(ecs_vec_count(vec) == child_count, ECS_INVALID_PARAMETER,
+        "child order must contain all children of parent");
+
+    int32_t i;
+    for (i = 0; i < child_count; i ++) {
+        ecs_check(ecs_has_pair(world, children[i], EcsChildOf, parent), 
+            ECS_INVALID_PARAMETER, 
+                "entity in child order is not a child of parent");
+#ifdef FLECS_DEBUG
+        int32_t j;
+        for (j = 0; j < i; j ++) {
+            ecs_check(children[i] != children[j], ECS_INVALID_PARAMETER,
+                "child order contains duplicate entities");
+        }
+#endif
+    }
+
+    ecs_os_memcpy_n(ecs_vec_first_t(vec, ecs_entity_t), children, 
+        ecs_entity_t, child_count);
+error:
+    return;
+}
+
 ecs_entity_t ecs_get_target_for_id(
     const ecs_world_t *world,
     ecs_entity_t entity,
@@ -5026,6 +5502,283 @@ void flecs_cmd_batch_for_entity(
     flecs_table_diff_builder_clear(diff);
 }
 
+/* Maximum number of components for which OnSet events are combined while
+ * merging commands. */
+#define FLECS_CMD_ON_SET_RANGE_MAX (8)
+
+/* Contiguous range of rows in a table for which an OnSet event is pending */
+typedef struct ecs_cmd_on_set_range_t {
+    ecs_table_t *table;
+    ecs_id_t id;
+    int32_t row;
+    int32_t count;
+    bool owned;                     /* Whether on_set hooks must be invoked */
+    ecs_flags32_t event_flags;
+} ecs_cmd_on_set_range_t;
+
+/* OnSet events that are combined while merging commands. Modified commands for
+ * consecutive entities in the same table are combined into a single event per
+ * component, so that observers are invoked once per range instead of once per
+ * entity. Any command that is not a modified command flushes the pending
+ * events first, so that events are never delivered after events of commands
+ * that were enqueued later. */
+typedef struct ecs_cmd_on_set_batch_t {
+    ecs_cmd_on_set_range_t ranges[FLECS_CMD_ON_SET_RANGE_MAX];
+    int32_t count;
+} ecs_cmd_on_set_batch_t;
+
+/* Emit OnSet event for a range. Commands enqueued by observers are merged when
+ * the event has been delivered, the same as for a single modified command. */
+static
+void flecs_cmd_on_set_emit(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    const ecs_cmd_on_set_range_t *range,
+    ecs_table_t *table,
+    int32_t row,
+    int32_t count)
+{
+    ecs_type_t ids = { .array = ECS_CONST_CAST(ecs_id_t*, &range->id), 
+        .count = 1 };
+    flecs_defer_begin(world, stage);
+    flecs_notify_on_set_w_flags(world, table, row, count, &ids, 
+        range->owned, range->event_flags);
+    flecs_table_mark_dirty(world, table, range->id);
+    flecs_defer_end(world, stage);
+}
+
+/* Test if entities of a range are still stored in the rows of the range */
+static
+bool flecs_cmd_on_set_range_valid(
+    ecs_world_t *world,
+    const ecs_cmd_on_set_range_t *range,
+    const ecs_entity_t *entities)
+{
+    int32_t i;
+    for (i = 0; i < range->count; i ++) {
+        ecs_record_t *r = flecs_entities_try(world, entities[i]);
+        if (!r || r->table != range->table || 
+            ECS_RECORD_TO_ROW(r->row) != (range->row + i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Emit OnSet event for entities of a range that were moved by commands of a
+ * previous event. Entities are emitted one by one for their current row. */
+static
+void flecs_cmd_on_set_emit_moved(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    const ecs_cmd_on_set_range_t *range,
+    const ecs_entity_t *entities)
+{
+    int32_t i;
+    for (i = 0; i < range->count; i ++) {
+        ecs_record_t *r = flecs_entities_try(world, entities[i]);
+        if (!r || !r->table) {
+            continue;
+        }
+
+        if (!flecs_table_record_get(world, r->table, range->id)) {
+            continue;
+        }
+
+        flecs_cmd_on_set_emit(world, stage, range, r->table, 
+            ECS_RECORD_TO_ROW(r->row), 1);
+    }
+}
+
+static
+void flecs_cmd_on_set_flush(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    ecs_cmd_on_set_batch_t *batch)
+{
+    int32_t i, count = batch->count;
+    if (!count) {
+        return;
+    }
+
+    /* Reset before emitting, as observers can flush commands */
+    batch->count = 0;
+
+    /* Commands enqueued by observers are merged after each event, which can
+     * move entities of ranges that haven't been emitted yet. Store the entities
+     * of the remaining ranges so that moved entities can be detected. */
+    ecs_entity_t *entities = NULL;
+    int32_t entity_count = 0;
+    if (count > 1) {
+        for (i = 1; i < count; i ++) {
+            entity_count += batch->ranges[i].count;
+        }
+
+        entities = flecs_walloc_n(world, ecs_entity_t, entity_count);
+        ecs_entity_t *ptr = entities;
+        for (i = 1; i < count; i ++) {
+            ecs_cmd_on_set_range_t *range = &batch->ranges[i];
+            ecs_os_memcpy_n(ptr, &ecs_table_entities(range->table)[range->row],
+                ecs_entity_t, range->count);
+            ptr += range->count;
+        }
+    }
+
+    ecs_entity_t *range_entities = entities;
+    for (i = 0; i < count; i ++) {
+        ecs_cmd_on_set_range_t *range = &batch->ranges[i];
+        if (i) {
+            const ecs_entity_t *range_ids = range_entities;
+            range_entities += range->count;
+            if (!flecs_cmd_on_set_range_valid(world, range, range_ids)) {
+                flecs_cmd_on_set_emit_moved(world, stage, range, range_ids);
+                continue;
+            }
+        }
+
+        flecs_cmd_on_set_emit(world, stage, range, range->table, range->row, 
+            range->count);
+    }
+
+    if (entities) {
+        flecs_wfree_n(world, ecs_entity_t, entity_count, entities);
+    }
+}
+
+static
+void flecs_cmd_on_set_add(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    ecs_cmd_on_set_batch_t *batch,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    bool owned,
+    ecs_flags32_t event_flags)
+{
+    ecs_record_t *r = flecs_entities_get(world, entity);
+    ecs_table_t *table = r->table;
+    if (!table || !flecs_table_record_get(world, table, id)) {
+        return;
+    }
+
+    int32_t i, row = ECS_RECORD_TO_ROW(r->row);
+    for (i = 0; i < batch->count; i ++) {
+        ecs_cmd_on_set_range_t *range = &batch->ranges[i];
+        if (range->id != id) {
+            continue;
+        }
+
+        if (range->table == table && range->owned == owned && 
+            range->event_flags == event_flags &&
+            (range->row + range->count) == row) 
+        {
+            range->count ++;
+            return;
+        }
+
+        /* Range for same component can't be extended, flush existing events
+         * so that events for the component are delivered in order. */
+        flecs_cmd_on_set_flush(world, stage, batch);
+        break;
+    }
+
+    if (batch->count == FLECS_CMD_ON_SET_RANGE_MAX) {
+        flecs_cmd_on_set_flush(world, stage, batch);
+    }
+
+    batch->ranges[batch->count ++] = (ecs_cmd_on_set_range_t){
+        .table = table,
+        .id = id,
+        .row = row,
+        .count = 1,
+        .owned = owned,
+        .event_flags = event_flags
+    };
+}
+
+/* Test if a later command for the same entity emits an OnSet event for the
+ * same id. Observers that coalesce events skip the event of this command. */
+static
+bool flecs_cmd_is_superseded(
+    ecs_cmd_t *cmds,
+    ecs_cmd_t *cmd)
+{
+    int32_t next = cmd->next_for_entity;
+    while (next) {
+        if (next < 0) {
+            next *= -1;
+        }
+
+        ecs_cmd_t *later = &cmds[next];
+        ecs_cmd_kind_t kind = later->kind;
+        if (kind == EcsCmdDelete) {
+            return false;
+        }
+
+        if (later->id == cmd->id) {
+            if (kind == EcsCmdModified || kind == EcsCmdModifiedNoHook ||
+                kind == EcsCmdAddModified)
+            {
+                return true;
+            }
+        }
+
+        next = later->next_for_entity;
+    }
+
+    return false;
+}
+
+/* Test if batching the commands for an entity cannot move entities or invoke
+ * hooks/observers, in which case pending OnSet events remain valid. */
+static
+bool flecs_cmd_batch_is_modified_only(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_cmd_t *cmds,
+    int32_t start)
+{
+    ecs_table_t *table = flecs_entities_get(world, entity)->table;
+    int32_t cur = start, next_for_entity;
+    do {
+        ecs_cmd_t *cmd = &cmds[cur];
+        next_for_entity = cmd->next_for_entity;
+        if (next_for_entity < 0) {
+            next_for_entity *= -1;
+        }
+
+        ecs_id_t id = cmd->id;
+        if (ECS_IS_PAIR(id)) {
+            /* Invalid pairs can cause the entity to be deleted */
+            if (!flecs_entities_is_valid(world, ECS_PAIR_FIRST(id)) ||
+                !flecs_entities_is_valid(world, ECS_PAIR_SECOND(id)))
+            {
+                return false;
+            }
+        }
+
+        if (cmd->kind == EcsCmdModified) {
+            /* Batching invokes the on_set hook of an existing component */
+            ecs_id_record_t *idr = flecs_id_record_get(world, id);
+            if (idr && idr->type_info && idr->type_info->hooks.on_set) {
+                return false;
+            }
+        } else if (cmd->kind == EcsCmdAdd || cmd->kind == EcsCmdAddModified) {
+            /* Adding a component the entity already has doesn't move it */
+            if (!table || !flecs_table_record_get(world, table, id)) {
+                return false;
+            }
+        } else if (cmd->kind != EcsCmdModifiedNoHook && 
+            cmd->kind != EcsCmdSkip) 
+        {
+            return false;
+        }
+    } while ((cur = next_for_entity));
+
+    return true;
+}
+
 /* Leave safe section. Run all deferred commands. */
 bool flecs_defer_end(
     ecs_world_t *world,
@@ -5070,6 +5823,9 @@ bool flecs_defer_end(
             flecs_table_diff_builder_init(world, &diff);
             flecs_commands_push(stage);
 
+            ecs_cmd_on_set_batch_t on_set_batch;
+            on_set_batch.count = 0;
+
             for (i = 0; i < count; i ++) {
                 ecs_cmd_t *cmd = &cmds[i];
                 ecs_entity_t e = cmd->entity;
@@ -5079,6 +5835,14 @@ bool flecs_defer_end(
                 if (merge_to_world && (cmd->next_for_entity < 0)) {
                     /* Batch commands for entity to limit archetype moves */
                     if (is_alive) {
+                        /* Only check the batch if there are pending events */
+                        if (on_set_batch.count && 
+                            !flecs_cmd_batch_is_modified_only(
+                                world, e, cmds, i)) 
+                        {
+                            flecs_cmd_on_set_flush(
+                                world, dst_stage, &on_set_batch);
+                        }
                         flecs_cmd_batch_for_entity(world, &diff, e, cmds, i);
                     } else {
                         world->info.cmd.discard_count ++;
@@ -5102,6 +5866,19 @@ bool flecs_defer_end(
 
                 ecs_id_t id = cmd->id;
 
+                if (merge_to_world && kind == EcsCmdAddModified) {
+                    /* If the entity already has the component, the set only 
+                     * has to emit an OnSet event. */
+                    ecs_table_t *table = flecs_entities_get(world, e)->table;
+                    if (table && flecs_table_record_get(world, table, id)) {
+                        kind = EcsCmdModified;
+                    }
+                }
+
+                if (kind != EcsCmdModified && kind != EcsCmdModifiedNoHook) {
+                    flecs_cmd_on_set_flush(world, dst_stage, &on_set_batch);
+                }
+
                 switch(kind) {
                 case EcsCmdAdd:
                     ecs_assert(id != 0, ECS_INTERNAL_ERROR, NULL);
@@ -5151,12 +5928,26 @@ bool flecs_defer_end(
                     world->info.cmd.ensure_count ++;
                     break;
                 case EcsCmdModified:
-                    flecs_modified_id_if(world, e, id, true);
-                    world->info.cmd.modified_count ++;
-                    break;
                 case EcsCmdModifiedNoHook:
-                    flecs_modified_id_if(world, e, id, false);
-                    world->info.cmd.modified_count ++;
+                    if (merge_to_world) {
+                        ecs_flags32_t event_flags = 0;
+                        if (world->coalesce_observer_count && 
+                            flecs_cmd_is_superseded(cmds, cmd)) 
+                        {
+                            event_flags = EcsEventSuperseded;
+                        }
+
+                        flecs_cmd_on_set_add(world, dst_stage, &on_set_batch, 
+                            e, id, kind == EcsCmdModified, event_flags);
+                    } else {
+                        flecs_modified_id_if(world, e, id, 
+                            kind == EcsCmdModified);
+                    }
+                    if (cmd->kind == EcsCmdAddModified) {
+                        world->info.cmd.set_count ++;
+                    } else {
+                        world->info.cmd.modified_count ++;
+                    }
                     break;
                 case EcsCmdAddModified:
                     flecs_add_id(world, e, id);
@@ -5226,6 +6017,8 @@ bool flecs_defer_end(
                 }
             }
 
+            flecs_cmd_on_set_flush(world, dst_stage, &on_set_batch);
+
             flecs_stack_reset(&commands->stack);
             ecs_vec_clear(queue);
             flecs_commands_pop(stage);
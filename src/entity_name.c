@@ -70,6 +70,169 @@ bool flecs_path_append(
     return cur != 0;
 }
 
+/* Cached path of an entity. Entities that are an ancestor of a cached entity
+ * are stored in the cache without a path, so that renaming, reparenting or
+ * deleting them clears the cache. */
+typedef struct ecs_path_cache_elem_t {
+    char *path[2];                   /* Path with NULL and "" prefix */
+    ecs_size_t length[2];
+} ecs_path_cache_elem_t;
+
+struct ecs_path_cache_t {
+    ecs_map_t entities;              /* map<entity, ecs_path_cache_elem_t*> */
+    ecs_hashmap_t paths;             /* name index<path, entity> for lookups */
+    ecs_vec_t strings;               /* vector<char*>, keys of paths */
+};
+
+static
+void flecs_path_cache_free_strings(
+    ecs_path_cache_t *cache)
+{
+    ecs_map_iter_t it = ecs_map_iter(&cache->entities);
+    while (ecs_map_next(&it)) {
+        ecs_path_cache_elem_t *elem = ecs_map_ptr(&it);
+        if (elem) {
+            ecs_os_free(elem->path[0]);
+            ecs_os_free(elem->path[1]);
+            ecs_os_free(elem);
+        }
+    }
+
+    int32_t i, count = ecs_vec_count(&cache->strings);
+    char **strings = ecs_vec_first_t(&cache->strings, char*);
+    for (i = 0; i < count; i ++) {
+        ecs_os_free(strings[i]);
+    }
+}
+
+static
+void flecs_path_cache_clear(
+    ecs_world_t *world,
+    ecs_path_cache_t *cache)
+{
+    flecs_path_cache_free_strings(cache);
+    ecs_map_clear(&cache->entities);
+    ecs_vec_clear(&cache->strings);
+    flecs_name_index_fini(&cache->paths);
+    flecs_name_index_init(&cache->paths, &world->allocator);
+}
+
+/* Add entity and its ancestors to the cache. Returns false if one of the
+ * entities is not named, as the path would not be invalidated when an unnamed
+ * entity is reparented. */
+static
+bool flecs_path_cache_track(
+    const ecs_world_t *world,
+    ecs_path_cache_t *cache,
+    ecs_entity_t entity)
+{
+    ecs_entity_t cur = entity;
+    do {
+        ecs_record_t *r = flecs_entities_get(world, cur);
+        if (!r || !r->table || !(r->table->flags & EcsTableHasName)) {
+            return false;
+        }
+        cur = ecs_get_target(world, cur, EcsChildOf, 0);
+    } while (cur);
+
+    for (cur = entity; cur; cur = ecs_get_target(world, cur, EcsChildOf, 0)) {
+        ecs_map_ensure(&cache->entities, cur);
+    }
+
+    return true;
+}
+
+static
+bool flecs_path_cache_append(
+    const ecs_world_t *world,
+    ecs_entity_t entity,
+    const char *prefix,
+    ecs_strbuf_t *buf)
+{
+    ecs_path_cache_t *cache = world->path_cache;
+    int32_t variant = prefix != NULL;
+
+    ecs_path_cache_elem_t *elem = ecs_map_get_deref(
+        &cache->entities, ecs_path_cache_elem_t, entity);
+    if (elem && elem->path[variant]) {
+        ecs_strbuf_appendstrn(buf, elem->path[variant], elem->length[variant]);
+        return true;
+    }
+
+    /* Only modify the cache when no other threads can access it */
+    if (world->flags & EcsWorldMultiThreaded) {
+        return false;
+    }
+
+    if (!ecs_is_alive(world, entity)) {
+        return false;
+    }
+
+    if (!flecs_path_cache_track(world, cache, entity)) {
+        return false;
+    }
+
+    ecs_strbuf_t path = ECS_STRBUF_INIT;
+    flecs_path_append(world, 0, entity, ".", prefix, &path);
+    ecs_size_t length = ecs_strbuf_written(&path);
+    char *str = ecs_strbuf_get(&path);
+
+    elem = ecs_map_ensure_alloc_t(
+        &cache->entities, ecs_path_cache_elem_t, entity);
+    elem->path[variant] = str;
+    elem->length[variant] = length;
+
+    ecs_strbuf_appendstrn(buf, str, length);
+    return true;
+}
+
+static
+void flecs_path_cache_insert_lookup(
+    const ecs_world_t *world,
+    const char *path,
+    ecs_entity_t entity)
+{
+    ecs_path_cache_t *cache = world->path_cache;
+    if (world->flags & EcsWorldMultiThreaded) {
+        return;
+    }
+
+    if (!flecs_path_cache_track(world, cache, entity)) {
+        return;
+    }
+
+    ecs_world_t *w = ECS_CONST_CAST(ecs_world_t*, world);
+    char *key = ecs_os_strdup(path);
+    ecs_vec_append_t(&w->allocator, &cache->strings, char*)[0] = key;
+    flecs_name_index_ensure(&cache->paths, entity, key, 0, 0);
+}
+
+void flecs_path_cache_invalidate(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_path_cache_t *cache = world->path_cache;
+    if (cache && ecs_map_get(&cache->entities, entity)) {
+        flecs_path_cache_clear(world, cache);
+    }
+}
+
+void flecs_path_cache_fini(
+    ecs_world_t *world)
+{
+    ecs_path_cache_t *cache = world->path_cache;
+    if (!cache) {
+        return;
+    }
+
+    flecs_path_cache_free_strings(cache);
+    ecs_map_fini(&cache->entities);
+    ecs_vec_fini_t(&world->allocator, &cache->strings, char*);
+    flecs_name_index_fini(&cache->paths);
+    ecs_os_free(cache);
+    world->path_cache = NULL;
+}
+
 bool flecs_name_is_id(
     const char *name)
 {
@@ -310,6 +473,14 @@ void ecs_get_path_w_sep_buf(
         sep = ".";
     }
 
+    if (world->path_cache && !parent && child && sep[0] == '.' && !sep[1] &&
+        (!prefix || !prefix[0]))
+    {
+        if (flecs_path_cache_append(world, child, prefix, buf)) {
+            return;
+        }
+    }
+
     if (!child || parent != child) {
         flecs_path_append(world, parent, child, sep, prefix, buf);
     } else {
@@ -320,6 +491,24 @@ error:
     return;
 }
 
+bool ecs_enable_path_cache(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    bool prev = world->path_cache != NULL;
+    if (enable && !prev) {
+        ecs_path_cache_t *cache = ecs_os_calloc_t(ecs_path_cache_t);
+        ecs_map_init(&cache->entities, &world->allocator);
+        flecs_name_index_init(&cache->paths, &world->allocator);
+        ecs_vec_init_t(&world->allocator, &cache->strings, char*, 0);
+        world->path_cache = cache;
+    } else if (!enable && prev) {
+        flecs_path_cache_fini(world);
+    }
+    return prev;
+}
+
 char* ecs_get_path_w_sep(
     const ecs_world_t *world,
     ecs_entity_t parent,
@@ -452,6 +641,17 @@ ecs_entity_t ecs_lookup_path_w_sep(
         return ecs_lookup_child(world, parent, path);
     }
 
+    /* Only lookups from the root are cached, as the result of other lookups
+     * depends on the scope and lookup path. */
+    bool cache_lookup = world->path_cache && !parent && 
+        sep[0] == '.' && !sep[1];
+    if (cache_lookup) {
+        e = flecs_name_index_find(&world->path_cache->paths, path, 0, 0);
+        if (e) {
+            return e;
+        }
+    }
+
 retry:
     cur = parent;
     ptr = path;
@@ -464,6 +664,10 @@ retry:
     }
 
 tail:
+    if (cur && cache_lookup && !parent && !lookup_path_search) {
+        flecs_path_cache_insert_lookup(world, path, cur);
+    }
+
     if (!cur && recursive) {
         if (!lookup_path_search) {
             if (parent) {
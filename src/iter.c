@@ -842,6 +842,49 @@ error:
     return (ecs_iter_t){ 0 };
 }
 
+ecs_iter_t ecs_worker_table_iter(
+    const ecs_iter_t *it,
+    int32_t index,
+    int32_t count)
+{
+    ecs_iter_t result = ecs_worker_iter(it, index, count);
+    result.priv_.iter.worker.tables = true;
+    return result;
+}
+
+static
+bool flecs_worker_table_next(
+    ecs_iter_t *it)
+{
+    ecs_iter_t *chain_it = it->chain_it;
+    ecs_worker_iter_t *iter = &it->priv_.iter.worker;
+
+    do {
+        if (!ecs_iter_next(chain_it)) {
+            return false;
+        }
+
+        /* Copy everything up to the private iterator data */
+        ecs_os_memcpy(it, chain_it, offsetof(ecs_iter_t, priv_));
+
+        if (it->table == NULL) {
+            if (iter->index == 0) {
+                return true;
+            } else {
+                ecs_iter_fini(chain_it);
+                return false;
+            }
+        }
+
+        /* Scramble table id so that tables that are created in a regular 
+         * pattern (like every other table) still spread across workers. */
+        uint32_t hash = (uint32_t)it->table->id * 2654435761u;
+        if ((int32_t)(hash % (uint32_t)iter->count) == iter->index) {
+            return true;
+        }
+    } while (true);
+}
+
 bool ecs_worker_next(
     ecs_iter_t *it)
 {
@@ -849,8 +892,12 @@ bool ecs_worker_next(
     ecs_check(it->chain_it != NULL, ECS_INVALID_PARAMETER, NULL);
     ecs_check(it->next == ecs_worker_next, ECS_INVALID_PARAMETER, NULL);
 
-    ecs_iter_t *chain_it = it->chain_it;
     ecs_worker_iter_t *iter = &it->priv_.iter.worker;
+    if (iter->tables) {
+        return flecs_worker_table_next(it);
+    }
+
+    ecs_iter_t *chain_it = it->chain_it;
     int32_t res_count = iter->count, res_index = iter->index;
     int32_t per_worker, first;
 
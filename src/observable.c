@@ -228,6 +228,155 @@ int32_t flecs_event_observers_get(
     return count;
 }
 
+int32_t flecs_observer_cache_event_index(
+    const ecs_observable_t *o,
+    const ecs_event_record_t *er)
+{
+    if      (er == &o->on_add)      return 0;
+    else if (er == &o->on_remove)   return 1;
+    else if (er == &o->on_set)      return 2;
+    else if (er == &o->on_wildcard) return 3;
+    return -1;
+}
+
+/* Find type index of id in table without looking up the id record */
+static
+int32_t flecs_observer_cache_type_index(
+    const ecs_table_t *table,
+    ecs_id_t id)
+{
+    int32_t count = table->type.count;
+    if (!count) {
+        return -1;
+    }
+
+    if (id < FLECS_HI_COMPONENT_ID) {
+        int16_t res = table->component_map[id];
+        if (res > 0) {
+            return table->column_map[count + (res - 1)];
+        }
+        return -res - 1;
+    }
+
+    /* Type is sorted */
+    const ecs_id_t *array = table->type.array;
+    int32_t lo = 0, hi = count - 1;
+    while (lo <= hi) {
+        int32_t mid = lo + ((hi - lo) >> 1);
+        ecs_id_t cur = array[mid];
+        if (cur == id) {
+            return mid;
+        } else if (cur < id) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+static
+void flecs_observer_cache_append(
+    ecs_world_t *world,
+    ecs_vec_t *dst,
+    ecs_map_t *observers)
+{
+    if (!ecs_map_is_init(observers)) {
+        return;
+    }
+
+    ecs_map_iter_t oit = ecs_map_iter(observers);
+    while (ecs_map_next(&oit)) {
+        ecs_vec_append_t(&world->allocator, dst, ecs_observer_t*)[0] = 
+            ecs_map_ptr(&oit);
+    }
+}
+
+/* Get flattened observers for an id in a table. The cache element is rebuilt
+ * when observers were (un)registered since it was last used. Returns NULL if
+ * the element is out of date but can't be rebuilt because it's being invoked,
+ * in which case the caller should find observers without the cache. */
+static
+ecs_table_observers_t* flecs_observer_cache_get(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    const ecs_event_record_t *er,
+    int32_t event_index,
+    int32_t type_index,
+    ecs_id_t id)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_table_observer_cache_t *cache = table->_->observers;
+    if (!cache) {
+        cache = table->_->observers = 
+            flecs_calloc_t(a, ecs_table_observer_cache_t);
+    }
+
+    ecs_table_observers_t *elems = cache->events[event_index];
+    if (!elems) {
+        int32_t i, count = table->type.count;
+        elems = cache->events[event_index] = 
+            flecs_calloc_n(a, ecs_table_observers_t, count);
+        for (i = 0; i < count; i ++) {
+            /* Make sure element is built on first use */
+            elems[i].version = world->observer_version[event_index] - 1;
+        }
+    }
+
+    ecs_table_observers_t *elem = &elems[type_index];
+    if (elem->version == world->observer_version[event_index]) {
+        return elem;
+    }
+
+    if (elem->lock) {
+        return NULL;
+    }
+
+    ecs_event_id_record_t **iders = elem->iders;
+    int32_t i, count = flecs_event_observers_get(er, id, iders);
+    elem->ider_count = flecs_ito(int16_t, count);
+
+    ecs_vec_t *observers = &elem->observers;
+    ecs_vec_init_if_t(observers, ecs_observer_t*);
+    ecs_vec_clear(observers);
+    for (i = 0; i < count; i ++) {
+        flecs_observer_cache_append(world, observers, &iders[i]->self);
+        flecs_observer_cache_append(world, observers, &iders[i]->self_up);
+    }
+
+    elem->version = world->observer_version[event_index];
+    return elem;
+}
+
+void flecs_table_observer_cache_fini(
+    ecs_world_t *world,
+    ecs_table_t *table)
+{
+    ecs_table_observer_cache_t *cache = table->_->observers;
+    if (!cache) {
+        return;
+    }
+
+    ecs_allocator_t *a = &world->allocator;
+    int32_t e, i, count = table->type.count;
+    for (e = 0; e < FLECS_OBSERVER_CACHE_EVENT_COUNT; e ++) {
+        ecs_table_observers_t *elems = cache->events[e];
+        if (!elems) {
+            continue;
+        }
+
+        for (i = 0; i < count; i ++) {
+            ecs_vec_fini_t(a, &elems[i].observers, ecs_observer_t*);
+        }
+
+        flecs_free_n(a, ecs_table_observers_t, count, elems);
+    }
+
+    flecs_free_t(a, ecs_table_observer_cache_t, cache);
+    table->_->observers = NULL;
+}
+
 bool flecs_observers_exist(
     ecs_observable_t *observable,
     ecs_id_t id,
@@ -378,12 +527,17 @@ void flecs_emit_propagate_invalidate_tables(
     ecs_id_record_t *cur = tgt_idr;
     while ((cur = cur->trav.next)) {
         ecs_reachable_cache_t *rc = &cur->reachable;
-        if (rc->current != rc->generation) {
-            /* Subtree is already marked invalid */
+        bool rc_valid = rc->current == rc->generation;
+        if (!rc_valid && !cur->depth) {
+            /* Subtree is already marked invalid. A cached depth can only be
+             * valid if the depth of all ancestors is valid. */
             continue;
         }
 
-        rc->generation ++;
+        if (rc_valid) {
+            rc->generation ++;
+        }
+        cur->depth = 0;
 
         ecs_table_cache_iter_t idt;
         if (!flecs_table_cache_all_iter(&cur->cache, &idt)) {
@@ -1206,11 +1360,19 @@ void flecs_emit(
 
     ecs_event_id_record_t *iders[5] = {0};
 
+    /* Tables cache the observers for builtin events of the world observable */
+    bool can_cache = observable == &world->observable;
+    int32_t cache_index = -1;
+
     if (count && can_forward && has_observed) {
         flecs_emit_propagate_invalidate(world, table, offset, count);
     }
 
 repeat_event:
+    if (can_cache) {
+        cache_index = flecs_observer_cache_event_index(observable, er);
+    }
+
     /* This is the core event logic, which is executed for each event. By 
      * default this is just the event kind from the ecs_event_desc_t struct, but
      * can also include the Wildcard and UnSet events. The latter is emitted as
@@ -1307,7 +1469,26 @@ repeat_event:
             }
         }
 
-        if (er) {
+        ecs_table_observers_t *cached = NULL;
+        ecs_table_record_t *tr = NULL;
+        if (er && cache_index != -1) {
+            /* Use flattened observers from the table cache, which avoids
+             * looking up the observer sets and table record for the id. */
+            int32_t type_index = flecs_observer_cache_type_index(table, id);
+            if (type_index != -1) {
+                cached = flecs_observer_cache_get(
+                    world, table, er, cache_index, type_index, id);
+                if (cached) {
+                    tr = &table->_->records[type_index];
+                    idr = (ecs_id_record_t*)tr->hdr.cache;
+                    ider_count = cached->ider_count;
+                    ecs_os_memcpy_n(iders, cached->iders, 
+                        ecs_event_id_record_t*, ider_count);
+                }
+            }
+        }
+
+        if (er && !cached) {
             /* Get observer sets for id. There can be multiple sets of matching
              * observers, in case an observer matches for wildcard ids. For
              * example, both observers for (ChildOf, p) and (ChildOf, *) would
@@ -1323,7 +1504,9 @@ repeat_event:
         }
 
         ecs_assert(idr != NULL, ECS_INTERNAL_ERROR, NULL);
-        ecs_table_record_t *tr = flecs_id_record_get_table(idr, table);
+        if (!tr) {
+            tr = flecs_id_record_get_table(idr, table);
+        }
         if (tr == NULL) {
             /* When a single batch contains multiple add's for an exclusive
              * relationship, it's possible that an id was in the added list
@@ -1398,12 +1581,23 @@ repeat_event:
         }
 
         /* Actually invoke observers for this event/id */
-        for (ider_i = 0; ider_i < ider_count; ider_i ++) {
-            ecs_event_id_record_t *ider = iders[ider_i];
-            flecs_observers_invoke(world, &ider->self, &it, table, 0);
-            ecs_assert(it.event_cur == evtx, ECS_INTERNAL_ERROR, NULL);
-            flecs_observers_invoke(world, &ider->self_up, &it, table, 0);
+        if (cached) {
+            /* Lock element so nested events don't rebuild it while the
+             * observer array is being iterated */
+            cached->lock ++;
+            flecs_observers_invoke_array(world, 
+                ecs_vec_first_t(&cached->observers, ecs_observer_t*),
+                ecs_vec_count(&cached->observers), &it, table, 0);
             ecs_assert(it.event_cur == evtx, ECS_INTERNAL_ERROR, NULL);
+            cached->lock --;
+        } else {
+            for (ider_i = 0; ider_i < ider_count; ider_i ++) {
+                ecs_event_id_record_t *ider = iders[ider_i];
+                flecs_observers_invoke(world, &ider->self, &it, table, 0);
+                ecs_assert(it.event_cur == evtx, ECS_INTERNAL_ERROR, NULL);
+                flecs_observers_invoke(world, &ider->self_up, &it, table, 0);
+                ecs_assert(it.event_cur == evtx, ECS_INTERNAL_ERROR, NULL);
+            }
         }
 
         if (!ider_count || !count || !has_observed) {
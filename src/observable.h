@@ -6,6 +6,13 @@
 #ifndef FLECS_OBSERVABLE_H
 #define FLECS_OBSERVABLE_H
 
+/** Event queued for an async observer */
+typedef struct ecs_observer_async_event_t {
+    ecs_entity_t event;
+    ecs_id_t event_id;
+    ecs_entity_t entity;
+} ecs_observer_async_event_t;
+
 /** All observers for a specific (component) id */
 typedef struct ecs_event_id_record_t {
     /* Triggers for Self */
@@ -25,6 +32,23 @@ typedef struct ecs_event_id_record_t {
     int32_t observer_count;
 } ecs_event_id_record_t;
 
+/** Flattened observers for an (event, id) in a table. Stores the observers
+ * that emit would otherwise find with several map lookups, in the order in
+ * which they are invoked. */
+typedef struct ecs_table_observers_t {
+    int32_t version;            /**< Observer version the element was built for */
+    int16_t lock;               /**< Prevents rebuilding while invoking */
+    int16_t ider_count;         /**< Number of matching event id records */
+    ecs_event_id_record_t *iders[5]; /**< Matching event id records */
+    ecs_vec_t observers;        /**< vector<ecs_observer_t*> (self, self|up) */
+} ecs_table_observers_t;
+
+/** Observer cache of a table. Contains an array with an element per type
+ * index for each cached event, which is allocated on the first emit. */
+typedef struct ecs_table_observer_cache_t {
+    ecs_table_observers_t *events[FLECS_OBSERVER_CACHE_EVENT_COUNT];
+} ecs_table_observer_cache_t;
+
 typedef struct ecs_observer_impl_t {
     ecs_observer_t pub;
 
@@ -41,6 +65,8 @@ typedef struct ecs_observer_impl_t {
     ecs_query_t *not_query;     /**< Query used to populate observer data when a
                                      term with a not operator triggers. */
 
+    ecs_vec_t async_events;     /**< Events queued for async observer */
+
     /* Mixins */
     flecs_poly_dtor_t dtor;
 } ecs_observer_impl_t;
@@ -103,6 +129,25 @@ void flecs_observers_invoke(
     ecs_table_t *table,
     ecs_entity_t trav);
 
+/* Same as flecs_observers_invoke(), but for an array of observers */
+void flecs_observers_invoke_array(
+    ecs_world_t *world,
+    ecs_observer_t **observers,
+    int32_t count,
+    ecs_iter_t *it,
+    ecs_table_t *table,
+    ecs_entity_t trav);
+
+/* Index of event record in table observer cache, -1 if event isn't cached */
+int32_t flecs_observer_cache_event_index(
+    const ecs_observable_t *o,
+    const ecs_event_record_t *er);
+
+/* Free observer cache of table */
+void flecs_table_observer_cache_fini(
+    ecs_world_t *world,
+    ecs_table_t *table);
+
 void flecs_emit_propagate_invalidate(
     ecs_world_t *world,
     ecs_table_t *table,
@@ -115,4 +160,15 @@ void flecs_observer_set_disable_bit(
     ecs_flags32_t bit,
     bool cond);
 
+/* Run queued events of async observers. Events are divided between stages, so
+ * that each worker runs its own slice. */
+void flecs_observers_run_async(
+    ecs_world_t *stage,
+    int32_t stage_index,
+    int32_t stage_count);
+
+/* Return total number of events queued for async observers */
+int32_t flecs_observers_async_count(
+    const ecs_world_t *world);
+
 #endif
@@ -9,6 +9,7 @@
  */
 
 #include "private_api.h"
+#include "addons/timeline/timeline.h"
 #include <stddef.h>
 
 static
@@ -73,6 +74,15 @@ void flecs_inc_observer_count(
     ecs_assert(idt != NULL, ECS_INTERNAL_ERROR, NULL);
     
     int32_t result = idt->observer_count += value;
+
+    /* Invalidate table caches for event. Observers for events that aren't
+     * cached don't change the cache. */
+    int32_t cache_index = flecs_observer_cache_event_index(
+        &world->observable, evt);
+    if (cache_index != -1) {
+        world->observer_version[cache_index] ++;
+    }
+
     if (result == 1) {
         /* Notify framework that there are observers for the event/id. This 
          * allows parts of the code to skip event evaluation early */
@@ -268,6 +278,12 @@ bool flecs_ignore_observer(
         return true;
     }
 
+    if ((impl->flags & EcsObserverCoalesce) && 
+        (it->flags & EcsIterSuperseded)) 
+    {
+        return true;
+    }
+
     ecs_flags32_t table_flags = table->flags, query_flags = o->query->flags;
 
     bool result = (table_flags & EcsTableIsPrefab) &&
@@ -296,6 +312,8 @@ void flecs_observer_invoke(
 
     ecs_log_push_3();
 
+    flecs_timeline_begin(world->stages[0]);
+
     ecs_entity_t old_system = flecs_stage_set_system(
         world->stages[0], o->entity);
     world->info.observers_ran_frame ++;
@@ -353,9 +371,36 @@ void flecs_observer_invoke(
 
     flecs_stage_set_system(world->stages[0], old_system);
 
+    flecs_timeline_end(world->stages[0], EcsTimelineObserver, o->entity, 0, 1);
+
     ecs_log_pop_3();
 }
 
+static
+void flecs_observer_async_enqueue(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_entity_t event,
+    ecs_id_t event_id,
+    const ecs_entity_t *entities,
+    int32_t count)
+{
+    if (!count) {
+        return;
+    }
+
+    ecs_observer_impl_t *impl = flecs_observer_impl(o);
+    ecs_observer_async_event_t *elems = ecs_vec_grow_t(&world->allocator, 
+        &impl->async_events, ecs_observer_async_event_t, count);
+
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        elems[i].event = event;
+        elems[i].event_id = event_id;
+        elems[i].entity = entities[i];
+    }
+}
+
 static
 void flecs_default_uni_observer_run_callback(ecs_iter_t *it) {
     ecs_observer_t *o = it->ctx;
@@ -408,7 +453,10 @@ void flecs_uni_observer_invoke(
     int32_t event_cur = it->event_cur;
     it->event = flecs_get_observer_event(term, event);
 
-    if (o->run) {
+    if (impl->flags & EcsObserverAsync) {
+        flecs_observer_async_enqueue(world, o, it->event, it->event_id, 
+            it->entities, it->count);
+    } else if (o->run) {
         it->next = flecs_default_next_callback;
         it->callback = flecs_default_uni_observer_run_callback;
         it->ctx = o;
@@ -445,6 +493,28 @@ void flecs_observers_invoke(
     }
 }
 
+void flecs_observers_invoke_array(
+    ecs_world_t *world,
+    ecs_observer_t **observers,
+    int32_t count,
+    ecs_iter_t *it,
+    ecs_table_t *table,
+    ecs_entity_t trav)
+{
+    if (count) {
+        ecs_table_lock(it->world, table);
+
+        int32_t i;
+        for (i = 0; i < count; i ++) {
+            ecs_assert(it->table == table, ECS_INTERNAL_ERROR, NULL);
+            flecs_uni_observer_invoke(
+                world, observers[i], it, table, trav);
+        }
+
+        ecs_table_unlock(it->world, table);
+    }
+}
+
 static
 void flecs_multi_observer_invoke(
     ecs_iter_t *it) 
@@ -514,6 +584,13 @@ void flecs_multi_observer_invoke(
             }
         }
 
+        if (impl->flags & EcsObserverAsync) {
+            flecs_observer_async_enqueue(world, o, it->event, it->event_id, 
+                user_it.entities, user_it.count);
+            ecs_iter_fini(&user_it);
+            return;
+        }
+
         /* Patch data from original iterator. If the observer query has 
          * wildcards which triggered the original event, the component id that
          * got matched by ecs_query_has_range may not be the same as the one
@@ -729,6 +806,7 @@ int flecs_multi_observer_init(
     child_desc.run_ctx = NULL;
     child_desc.run_ctx_free = NULL;
     child_desc.yield_existing = false;
+    child_desc.async = false;
     ecs_os_zeromem(&child_desc.entity);
     ecs_os_zeromem(&child_desc.query.terms);
     ecs_os_zeromem(&child_desc.query);
@@ -947,6 +1025,31 @@ ecs_observer_t* flecs_observer_init(
     impl->term_index = desc->term_index_;
     impl->flags = desc->flags_;
 
+    if (desc->async) {
+        ecs_check(desc->callback != NULL && desc->run == NULL, 
+            ECS_INVALID_PARAMETER,
+                "async observers must have a callback and no run function");
+        ecs_check(query->flags & EcsQueryMatchThis, ECS_INVALID_PARAMETER,
+            "async observers must match $this");
+
+        /* Queued events are replayed by evaluating the observer query for the
+         * entity, which only works for events after which the entity still 
+         * matches the query. */
+        int32_t i;
+        for (i = 0; i < FLECS_EVENT_DESC_MAX && desc->events[i]; i ++) {
+            ecs_entity_t event = desc->events[i];
+            ecs_check(event == EcsOnAdd || event == EcsOnSet, 
+                ECS_INVALID_PARAMETER,
+                    "async observers only support OnAdd and OnSet events");
+        }
+        impl->flags |= EcsObserverAsync;
+    }
+
+    if (desc->coalesce) {
+        impl->flags |= EcsObserverCoalesce;
+        world->coalesce_observer_count ++;
+    }
+
     /* Check if observer is monitor. Monitors are created as multi observers
      * since they require pre/post checking of the filter to test if the
      * entity is entering/leaving the monitor. */
@@ -1000,6 +1103,11 @@ ecs_observer_t* flecs_observer_init(
         }
     }
 
+    if (impl->flags & EcsObserverAsync) {
+        ecs_vec_append_t(&world->allocator, &world->store.async_observers,
+            ecs_observer_t*)[0] = o;
+    }
+
     if (desc->yield_existing) {
         flecs_observer_yield_existing(world, o);
     }
@@ -1118,6 +1226,118 @@ const ecs_observer_t* ecs_observer_get(
     return flecs_poly_get(world, observer, ecs_observer_t);
 }
 
+int32_t ecs_observer_queue_count(
+    const ecs_world_t *world,
+    ecs_entity_t observer)
+{
+    const ecs_observer_t *o = ecs_observer_get(world, observer);
+    ecs_check(o != NULL, ECS_INVALID_PARAMETER, NULL);
+    return ecs_vec_count(&flecs_observer_impl(o)->async_events);
+error:
+    return 0;
+}
+
+int32_t flecs_observers_async_count(
+    const ecs_world_t *world)
+{
+    const ecs_vec_t *observers = &world->store.async_observers;
+    ecs_observer_t **elems = ecs_vec_first(observers);
+    int32_t i, count = ecs_vec_count(observers), result = 0;
+    for (i = 0; i < count; i ++) {
+        result += ecs_vec_count(&flecs_observer_impl(elems[i])->async_events);
+    }
+    return result;
+}
+
+static
+void flecs_observer_async_invoke(
+    ecs_world_t *world,
+    ecs_world_t *stage,
+    ecs_observer_t *o,
+    const ecs_observer_async_event_t *ev)
+{
+    ecs_record_t *r = flecs_entities_try(world, ev->entity);
+    if (!r || !r->table) {
+        return;
+    }
+
+    /* Evaluate the observer query for the entity, as the entity may have moved
+     * to a different table since the event was queued. */
+    ecs_iter_t it = ecs_query_iter(stage, o->query);
+    ecs_iter_set_var(&it, 0, ev->entity);
+    while (ecs_query_next(&it)) {
+        it.system = o->entity;
+        it.event = ev->event;
+        it.event_id = ev->event_id;
+        it.ctx = o->ctx;
+        it.callback_ctx = o->callback_ctx;
+        it.callback = o->callback;
+        o->callback(&it);
+    }
+}
+
+void flecs_observers_run_async(
+    ecs_world_t *stage,
+    int32_t stage_index,
+    int32_t stage_count)
+{
+    ecs_world_t *world = stage;
+    ecs_stage_t *s = flecs_stage_from_world(&world);
+    int32_t total = flecs_observers_async_count(world);
+    if (!total) {
+        return;
+    }
+
+    /* Each stage runs a contiguous slice of all queued events */
+    int32_t start = flecs_ito(int32_t, 
+        (int64_t)total * stage_index / stage_count);
+    int32_t end = flecs_ito(int32_t, 
+        (int64_t)total * (stage_index + 1) / stage_count);
+
+    ecs_vec_t *observers = &world->store.async_observers;
+    ecs_observer_t **elems = ecs_vec_first(observers);
+    int32_t i, count = ecs_vec_count(observers), offset = 0;
+    for (i = 0; i < count && offset < end; i ++) {
+        ecs_observer_t *o = elems[i];
+        ecs_vec_t *events = &flecs_observer_impl(o)->async_events;
+        int32_t ev_count = ecs_vec_count(events);
+        int32_t first = start - offset, last = end - offset;
+        offset += ev_count;
+
+        if (first < 0) {
+            first = 0;
+        }
+        if (last > ev_count) {
+            last = ev_count;
+        }
+        if (first >= last) {
+            continue;
+        }
+
+        flecs_timeline_begin(s);
+        ecs_entity_t old_system = flecs_stage_set_system(s, o->entity);
+
+        ecs_observer_async_event_t *ev = ecs_vec_first(events);
+        int32_t e;
+        for (e = first; e < last; e ++) {
+            flecs_observer_async_invoke(world, stage, o, &ev[e]);
+        }
+
+        flecs_stage_set_system(s, old_system);
+        flecs_timeline_end(s, EcsTimelineObserver, o->entity, 
+            stage_index, stage_count);
+    }
+
+    /* The last stage to finish clears the queues. Events aren't added while 
+     * the stages are running, as the world is in readonly mode. */
+    if (ecs_os_ainc(&world->store.async_done) == stage_count) {
+        for (i = 0; i < count; i ++) {
+            ecs_vec_clear(&flecs_observer_impl(elems[i])->async_events);
+        }
+        world->store.async_done = 0;
+    }
+}
+
 void flecs_observer_fini(
     ecs_observer_t *o)
 {
@@ -1145,6 +1365,26 @@ void flecs_observer_fini(
 
     ecs_vec_fini_t(&world->allocator, &impl->children, ecs_observer_t*);
 
+    if (impl->flags & EcsObserverCoalesce) {
+        world->coalesce_observer_count --;
+    }
+
+    if (impl->flags & EcsObserverAsync) {
+        /* Discard events that haven't run yet */
+        ecs_vec_t *observers = &world->store.async_observers;
+        ecs_observer_t **elems = ecs_vec_first(observers);
+        int32_t i, count = ecs_vec_count(observers);
+        for (i = 0; i < count; i ++) {
+            if (elems[i] == o) {
+                ecs_vec_remove_t(observers, ecs_observer_t*, i);
+                break;
+            }
+        }
+
+        ecs_vec_fini_t(&world->allocator, &impl->async_events, 
+            ecs_observer_async_event_t);
+    }
+
     /* Cleanup queries */
     ecs_query_fini(o->query);
     if (impl->not_query) {
@@ -512,6 +512,12 @@ bool ecs_os_has_task_support(void) {
         (ecs_os_api.task_join_ != NULL);
 }
 
+bool ecs_os_has_thread_affinity(void) {
+    return 
+        (ecs_os_api.thread_set_affinity_ != NULL) &&
+        (ecs_os_api.numa_node_cpus_ != NULL);
+}
+
 bool ecs_os_has_time(void) {
     return 
         (ecs_os_api.get_time_ != NULL) &&
@@ -530,6 +536,12 @@ bool ecs_os_has_dl(void) {
         (ecs_os_api.dlclose_ != NULL);  
 }
 
+bool ecs_os_has_file_map(void) {
+    return 
+        (ecs_os_api.file_map_ != NULL) &&
+        (ecs_os_api.file_unmap_ != NULL);
+}
+
 bool ecs_os_has_modules(void) {
     return 
         (ecs_os_api.module_to_dl_ != NULL) &&
@@ -64,6 +64,19 @@ void flecs_record_add_flag(
     ecs_record_t *record,
     uint32_t flag);
 
+/* Create entities in table. If entities is NULL, new ids are created. Provided
+ * entities must be alive, and may not yet be stored in a table. */
+const ecs_entity_t* flecs_bulk_new(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    const ecs_entity_t *entities,
+    ecs_type_t *component_ids,
+    int32_t count,
+    void **component_data,
+    bool move,
+    int32_t *row_out,
+    ecs_table_diff_t *diff);
+
 ecs_entity_t flecs_get_oneof(
     const ecs_world_t *world,
     ecs_entity_t e);
@@ -239,6 +252,15 @@ bool flecs_name_is_id(
 ecs_entity_t flecs_name_to_id(
     const char *name);
 
+/* Clear path cache if entity is part of a cached path */
+void flecs_path_cache_invalidate(
+    ecs_world_t *world,
+    ecs_entity_t entity);
+
+/* Free path cache */
+void flecs_path_cache_fini(
+    ecs_world_t *world);
+
 /* Convert floating point to string */
 char * ecs_ftoa(
     double f, 
@@ -176,6 +176,29 @@ typedef struct ecs_commands_t {
     ecs_sparse_t entries;       /* <entity, op_entry_t> - command batching */
 } ecs_commands_t;
 
+/* Command enqueued from a thread that does not own a stage. Commands are
+ * allocated with ecs_os_malloc, and the component value or event parameter is
+ * stored directly after the command. */
+typedef struct ecs_async_cmd_t {
+    struct ecs_async_cmd_t *next;    /* Next command in queue */
+    ecs_cmd_kind_t kind;             /* Command kind */
+    ecs_entity_t entity;             /* Entity id */
+    ecs_id_t id;                     /* (Component) id */
+    ecs_size_t size;                 /* Size of value */
+    void *value;                     /* Component value or event descriptor */
+} ecs_async_cmd_t;
+
+/* Lock-free multi producer, single consumer command queue. Producers push
+ * commands on the head with a compare and swap. The consumer takes ownership
+ * of all commands at once, which means popping is not subject to ABA. */
+typedef struct ecs_async_queue_t {
+    ecs_async_cmd_t *head;           /* Most recently enqueued command */
+} ecs_async_queue_t;
+
+/* Timeline recording state (see addons/timeline) */
+typedef struct ecs_timeline_t ecs_timeline_t;
+typedef struct ecs_timeline_buffer_t ecs_timeline_buffer_t;
+
 /** Callback used to capture commands of a frame */
 typedef void (*ecs_on_commands_action_t)(
     const ecs_stage_t *stage,
@@ -211,6 +234,12 @@ struct ecs_stage_t {
     ecs_world_t *world;              /* Reference to world */
     ecs_os_thread_t thread;          /* Thread handle (0 if no threading is used) */
 
+    /* Thread affinity */
+    int32_t *cpus;                   /* CPUs the stage thread is pinned to */
+    int32_t cpu_count;               /* Number of CPUs (0 if not pinned) */
+    int32_t numa_node;               /* NUMA node of stage (-1 if not set) */
+    bool cpus_changed;               /* Apply affinity before next run */
+
     /* One-shot actions to be executed after the merge */
     ecs_vec_t post_frame_actions;
 
@@ -223,6 +252,9 @@ struct ecs_stage_t {
     /* Running system */
     ecs_entity_t system;
 
+    /* Timeline events recorded by this stage */
+    ecs_timeline_buffer_t *timeline;
+
     /* Thread specific allocators */
     ecs_stage_allocators_t allocators;
     ecs_allocator_t allocator;
@@ -257,6 +289,14 @@ typedef struct ecs_marked_id_t {
     bool delete_id;
 } ecs_marked_id_t;
 
+/* Column of a deleted table with components that still need to be destructed.
+ * Destructors of deleted tables run in parallel after all tables are emptied
+ * when delete threads are configured. */
+typedef struct ecs_deleted_column_t {
+    ecs_vec_t data;                  /* Component storage owned by the column */
+    const ecs_type_info_t *ti;
+} ecs_deleted_column_t;
+
 typedef struct ecs_store_t {
     /* Entity lookup */
     ecs_entity_index_t entity_index;
@@ -273,11 +313,22 @@ typedef struct ecs_store_t {
     /* Observers */
     ecs_sparse_t observers;          /* sparse<table_id, ecs_table_t> */
 
+    /* Observers with queued events that run after the merge */
+    ecs_vec_t async_observers;       /* vector<ecs_observer_t*> */
+    int32_t async_done;              /* Stages that ran their async events */
+
     /* Records cache */
     ecs_vec_t records;
 
+    /* Last assigned table storage version */
+    uint32_t table_version;
+
     /* Stack of ids being deleted. */
     ecs_vec_t marked_ids;            /* vector<ecs_marked_ids_t> */
+
+    /* Columns of deleted tables with pending destructors */
+    ecs_vec_t deleted_columns;       /* vector<ecs_deleted_column_t> */
+    bool defer_dtors;                /* Collect destructors of deleted tables */
     
     /* Entity ids associated with depth (for flat hierarchies) */
     ecs_vec_t depth_ids;
@@ -292,6 +343,13 @@ typedef struct ecs_action_elem_t {
 
 typedef struct ecs_pipeline_state_t ecs_pipeline_state_t;
 
+/* Number of event records with a per-table observer cache (OnAdd, OnRemove,
+ * OnSet and Wildcard). Events for other event kinds are never cached. */
+#define FLECS_OBSERVER_CACHE_EVENT_COUNT (4)
+
+/* Cached entity paths (see entity_name.c) */
+typedef struct ecs_path_cache_t ecs_path_cache_t;
+
 /** The world stores and manages all ECS data. An application can have more than
  * one world, but data is not shared between worlds. */
 struct ecs_world_t {
@@ -318,6 +376,16 @@ struct ecs_world_t {
     /* Unique id per generated event used to prevent duplicate notifications */
     int32_t event_id;
 
+    /* Incremented when observers for a cached event are (un)registered.
+     * Invalidates the observer caches of tables for that event. */
+    int32_t observer_version[FLECS_OBSERVER_CACHE_EVENT_COUNT];
+
+    /* Number of task threads that run destructors of deleted tables */
+    int32_t delete_threads;
+
+    /* Number of observers that skip superseded OnSet events */
+    int32_t coalesce_observer_count;
+
     /* Is entity range checking enabled? */
     bool range_check_enabled;
 
@@ -333,10 +401,12 @@ struct ecs_world_t {
 
     /* -- Systems -- */
     ecs_entity_t pipeline;           /* Current pipeline */
+    ecs_entity_t async_system;       /* System that runs async observers */
 
     /* -- Identifiers -- */
     ecs_hashmap_t aliases;
     ecs_hashmap_t symbols;
+    ecs_path_cache_t *path_cache;    /* Cached paths, NULL if disabled */
 
     /* -- Staging -- */
     ecs_stage_t **stages;            /* Stages */
@@ -351,6 +421,9 @@ struct ecs_world_t {
     void *on_commands_ctx;
     void *on_commands_ctx_active;
 
+    /* Commands enqueued from threads without a stage */
+    ecs_async_queue_t async_queue;
+
     /* -- Multithreading -- */
     ecs_os_cond_t worker_cond;       /* Signal that worker threads can start */
     ecs_os_cond_t sync_cond;         /* Signal that worker thread job is done */
@@ -367,6 +440,7 @@ struct ecs_world_t {
 
     /* -- Metrics -- */
     ecs_world_info_t info;
+    ecs_timeline_t *timeline;        /* Timeline recording (NULL if disabled) */
 
     /* -- World flags -- */
     ecs_flags32_t flags;
@@ -170,6 +170,48 @@ bool flecs_query_union_with(
     }
 }
 
+/* Get next range of entities for the current target. Entities of the target 
+ * are stored in a dense array. If the source is $this, consecutive entities
+ * that are stored in adjacent rows of the same table are returned as a single
+ * range. Other variables are iterated one entity at a time. */
+static
+bool flecs_query_union_next_range(
+    const ecs_query_op_t *op,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_query_union_ctx_t *op_ctx,
+    ecs_table_range_t *range_out)
+{
+    int32_t elem = op_ctx->elem;
+    if (!elem) {
+        return false;
+    }
+
+    const uint32_t *elements = ecs_vec_first_t(op_ctx->elements, uint32_t);
+    ecs_table_range_t range = flecs_range_from_entity(elements[-- elem], ctx);
+
+    bool is_this = op->src.var == 0;
+    while (is_this && elem) {
+        ecs_record_t *r = flecs_entities_get(ctx->world, elements[elem - 1]);
+        if (!r || r->table != range.table) {
+            break;
+        }
+
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        if (row == (range.offset - 1)) {
+            range.offset --;
+        } else if (row != (range.offset + range.count)) {
+            break;
+        }
+
+        range.count ++;
+        elem --;
+    }
+
+    op_ctx->elem = elem;
+    *range_out = range;
+    return true;
+}
+
 static
 bool flecs_query_union_select_tgt(
     const ecs_query_op_t *op,
@@ -188,16 +230,19 @@ bool flecs_query_union_select_tgt(
             return false;
         }
 
-        op_ctx->cur = flecs_switch_first(op_ctx->idr->sparse, tgt);
-    } else {
-        op_ctx->cur = flecs_switch_next(op_ctx->idr->sparse, (uint32_t)op_ctx->cur);
+        op_ctx->elements = flecs_switch_elements(op_ctx->idr->sparse, tgt);
+        if (!op_ctx->elements) {
+            return false;
+        }
+
+        op_ctx->elem = ecs_vec_count(op_ctx->elements);
     }
 
-    if (!op_ctx->cur) {
+    ecs_table_range_t range;
+    if (!flecs_query_union_next_range(op, ctx, op_ctx, &range)) {
         return false;
     }
 
-    ecs_table_range_t range = flecs_range_from_entity(op_ctx->cur, ctx);
     flecs_query_var_set_range(op, op->src.var, 
         range.table, range.offset, range.count, ctx);
     flecs_query_set_vars(op, it->ids[field_index], ctx);
@@ -228,6 +273,8 @@ bool flecs_query_union_select_wildcard(
         op_ctx->tgt = 0;
     }
 
+    ecs_table_range_t range;
+
 next_tgt:
     if (!op_ctx->tgt) {
         if (!ecs_map_next(&op_ctx->tgt_iter)) {
@@ -235,22 +282,16 @@ next_tgt:
         }
 
         op_ctx->tgt = ecs_map_key(&op_ctx->tgt_iter);
-        op_ctx->cur = 0;
+        op_ctx->elements = ecs_map_ptr(&op_ctx->tgt_iter);
+        op_ctx->elem = ecs_vec_count(op_ctx->elements);
         it->ids[field_index] = ecs_pair(rel, op_ctx->tgt);
     }
 
-    if (!op_ctx->cur) {
-        op_ctx->cur = flecs_switch_first(op_ctx->idr->sparse, op_ctx->tgt);
-    } else {
-        op_ctx->cur = flecs_switch_next(op_ctx->idr->sparse, (uint32_t)op_ctx->cur);
-    }
-
-    if (!op_ctx->cur) {
+    if (!flecs_query_union_next_range(op, ctx, op_ctx, &range)) {
         op_ctx->tgt = 0;
         goto next_tgt;
     }
 
-    ecs_table_range_t range = flecs_range_from_entity(op_ctx->cur, ctx);
     flecs_query_var_set_range(op, op->src.var, 
         range.table, range.offset, range.count, ctx);
     flecs_query_set_vars(op, it->ids[field_index], ctx);
@@ -139,7 +139,8 @@ typedef struct {
     ecs_id_record_t *idr;
     ecs_table_range_t range;
     ecs_map_iter_t tgt_iter;
-    ecs_entity_t cur;
+    const ecs_vec_t *elements; /* Entities for current target */
+    int32_t elem;              /* Number of elements left to iterate */
     ecs_entity_t tgt;
     int32_t row;
 } ecs_query_union_ctx_t;
@@ -332,22 +332,42 @@ int32_t flecs_relation_depth_walk(
 
     int32_t i = tr->index, end = i + tr->count;
     for (; i != end; i ++) {
+        /* Depth is cached on (R, O) records that are in the list of 
+         * traversable records for O, as those are invalidated when O or one of
+         * its ancestors changes. */
+        ecs_id_record_t *pair_idr = 
+            (ecs_id_record_t*)table->_->records[i].hdr.cache;
+        if (pair_idr->trav.prev) {
+            if (pair_idr->depth) {
+                if (pair_idr->depth > result) {
+                    result = pair_idr->depth;
+                }
+                continue;
+            }
+        } else {
+            pair_idr = NULL;
+        }
+
         ecs_entity_t o = ecs_pair_second(world, table->type.array[i]);
         ecs_assert(o != 0, ECS_INTERNAL_ERROR, NULL);
 
+        int32_t cur = 1;
         ecs_table_t *ot = ecs_get_table(world, o);
-        if (!ot) {
-            continue;
+        if (ot) {
+            ecs_assert(ot != first, ECS_CYCLE_DETECTED, NULL);
+            cur += flecs_relation_depth_walk(world, idr, first, ot);
         }
-        
-        ecs_assert(ot != first, ECS_CYCLE_DETECTED, NULL);
-        int32_t cur = flecs_relation_depth_walk(world, idr, first, ot);
+
+        if (pair_idr) {
+            pair_idr->depth = cur;
+        }
+
         if (cur > result) {
             result = cur;
         }
     }
     
-    return result + 1;
+    return result;
 }
 
 int32_t flecs_relation_depth(
@@ -16,6 +16,7 @@
  */
 
 #include "private_api.h"
+#include "addons/timeline/timeline.h"
 
 static
 ecs_cmd_t* flecs_cmd_new(
@@ -554,6 +555,287 @@ void flecs_enqueue(
     }
 }
 
+/* Async commands are allocated with a size that's a multiple of this value,
+ * which ensures that values stored after the command are properly aligned. */
+#define FLECS_ASYNC_CMD_ALIGN (16)
+
+static
+ecs_async_cmd_t* flecs_async_cmd_new(
+    ecs_cmd_kind_t kind,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    ecs_size_t size)
+{
+    ecs_size_t hdr_size = ECS_ALIGN(ECS_SIZEOF(ecs_async_cmd_t), 
+        FLECS_ASYNC_CMD_ALIGN);
+    ecs_async_cmd_t *cmd = ecs_os_malloc(hdr_size + size);
+    cmd->next = NULL;
+    cmd->kind = kind;
+    cmd->entity = entity;
+    cmd->id = id;
+    cmd->size = size;
+    cmd->value = size ? ECS_OFFSET(cmd, hdr_size) : NULL;
+    return cmd;
+}
+
+static
+void flecs_async_push(
+    ecs_world_t *world,
+    ecs_async_cmd_t *cmd)
+{
+    ecs_async_queue_t *q = &world->async_queue;
+    ecs_async_cmd_t *head;
+    do {
+        head = q->head;
+        cmd->next = head;
+    } while (!ecs_os_acas((void**)&q->head, head, cmd));
+}
+
+static
+ecs_async_cmd_t* flecs_async_pop_all(
+    ecs_world_t *world)
+{
+    ecs_async_queue_t *q = &world->async_queue;
+    ecs_async_cmd_t *head;
+    do {
+        head = q->head;
+    } while (head && !ecs_os_acas((void**)&q->head, head, NULL));
+
+    /* Commands are pushed on the head of the queue, reverse the list so that
+     * they're executed in the order they were enqueued. */
+    ecs_async_cmd_t *prev = NULL;
+    while (head) {
+        ecs_async_cmd_t *next = head->next;
+        head->next = prev;
+        prev = head;
+        head = next;
+    }
+
+    return prev;
+}
+
+static
+ecs_world_t* flecs_async_world(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_assert(ecs_os_api.acas_ != NULL, ECS_MISSING_OS_API, "acas");
+    return world;
+}
+
+void ecs_async_add_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id)
+{
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    world = flecs_async_world(world);
+    flecs_async_push(world, flecs_async_cmd_new(EcsCmdAdd, entity, id, 0));
+error:
+    return;
+}
+
+void ecs_async_remove_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id)
+{
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    world = flecs_async_world(world);
+    flecs_async_push(world, flecs_async_cmd_new(EcsCmdRemove, entity, id, 0));
+error:
+    return;
+}
+
+void ecs_async_set_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    size_t size,
+    const void *ptr)
+{
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(size != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(ptr != NULL, ECS_INVALID_PARAMETER, NULL);
+    world = flecs_async_world(world);
+    ecs_async_cmd_t *cmd = flecs_async_cmd_new(
+        EcsCmdSet, entity, id, flecs_utosize(size));
+    ecs_os_memcpy(cmd->value, ptr, cmd->size);
+    flecs_async_push(world, cmd);
+error:
+    return;
+}
+
+void ecs_async_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    world = flecs_async_world(world);
+    flecs_async_push(world, flecs_async_cmd_new(EcsCmdDelete, entity, 0, 0));
+error:
+    return;
+}
+
+void ecs_async_enqueue(
+    ecs_world_t *world,
+    const ecs_event_desc_t *desc,
+    ecs_size_t param_size)
+{
+    ecs_check(desc != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(desc->event != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(desc->entity != 0, ECS_INVALID_PARAMETER, 
+        "async events must be emitted for an entity");
+    ecs_check(desc->table == NULL, ECS_INVALID_PARAMETER, 
+        "async events cannot be emitted for a table");
+    ecs_check(!(desc->const_param && desc->param), ECS_INVALID_PARAMETER, 
+        "cannot set param and const_param at the same time");
+    ecs_check(!param_size == !(desc->param || desc->const_param), 
+        ECS_INVALID_PARAMETER, "param_size must be set if event has param");
+    world = flecs_async_world(world);
+
+    int32_t id_count = desc->ids ? desc->ids->count : 0;
+    ecs_size_t desc_size = ECS_ALIGN(ECS_SIZEOF(ecs_event_desc_t) + 
+        ECS_SIZEOF(ecs_type_t), FLECS_ASYNC_CMD_ALIGN);
+    ecs_size_t ids_size = ECS_ALIGN(id_count * ECS_SIZEOF(ecs_id_t),
+        FLECS_ASYNC_CMD_ALIGN);
+
+    ecs_async_cmd_t *cmd = flecs_async_cmd_new(EcsCmdEvent, desc->entity, 
+        desc->event, desc_size + ids_size + param_size);
+
+    ecs_event_desc_t *desc_cmd = cmd->value;
+    ecs_os_memcpy_t(desc_cmd, desc, ecs_event_desc_t);
+    desc_cmd->observable = NULL;
+
+    if (id_count) {
+        ecs_type_t *type_cmd = ECS_OFFSET_T(desc_cmd, ecs_event_desc_t);
+        type_cmd->count = id_count;
+        type_cmd->array = ECS_OFFSET(desc_cmd, desc_size);
+        ecs_os_memcpy_n(type_cmd->array, desc->ids->array, ecs_id_t, id_count);
+        desc_cmd->ids = type_cmd;
+    } else {
+        desc_cmd->ids = NULL;
+    }
+
+    if (param_size) {
+        /* Parameter is copied bitwise, async events with a parameter should use
+         * types that can be moved with a memcpy. */
+        void *param_cmd = ECS_OFFSET(desc_cmd, desc_size + ids_size);
+        ecs_os_memcpy(param_cmd, 
+            desc->param ? desc->param : desc->const_param, param_size);
+        desc_cmd->param = param_cmd;
+        desc_cmd->const_param = NULL;
+    }
+
+    flecs_async_push(world, cmd);
+error:
+    return;
+}
+
+int32_t ecs_async_flush(
+    ecs_world_t *world)
+{
+    ecs_world_t *real_world = ECS_CONST_CAST(ecs_world_t*, 
+        ecs_get_world(world));
+    flecs_poly_assert(real_world, ecs_world_t);
+
+    if (!real_world->async_queue.head) {
+        return 0;
+    }
+
+    ecs_async_cmd_t *cmd = flecs_async_pop_all(real_world);
+    int32_t count = 0;
+
+    while (cmd) {
+        ecs_async_cmd_t *next = cmd->next;
+        ecs_entity_t e = cmd->entity;
+
+        /* Ids can't be validated by producers, as that reads world data that
+         * may be modified by the thread that owns the world. */
+        if (cmd->kind == EcsCmdAdd || cmd->kind == EcsCmdRemove || 
+            cmd->kind == EcsCmdSet) 
+        {
+            if (!ecs_id_is_valid(world, cmd->id)) {
+                ecs_err("discarding async command for entity #%u: "
+                    "invalid id", (uint32_t)e);
+                ecs_os_free(cmd);
+                cmd = next;
+                continue;
+            }
+        }
+
+        /* The entity could have been deleted by the time the command is 
+         * executed, in which case it is ignored. */
+        if (ecs_is_alive(world, e)) {
+            switch(cmd->kind) {
+            case EcsCmdAdd:
+                ecs_add_id(world, e, cmd->id);
+                break;
+            case EcsCmdRemove:
+                ecs_remove_id(world, e, cmd->id);
+                break;
+            case EcsCmdSet:
+                ecs_set_id(world, e, cmd->id, 
+                    flecs_itosize(cmd->size), cmd->value);
+                break;
+            case EcsCmdDelete:
+                ecs_delete(world, e);
+                break;
+            case EcsCmdEvent: {
+                ecs_event_desc_t *desc = cmd->value;
+#ifdef FLECS_DEBUG
+                if (desc->param) {
+                    const ecs_type_info_t *ti = ecs_get_type_info(
+                        world, desc->event);
+                    ecs_assert(ti != NULL, ECS_INVALID_PARAMETER, 
+                        "can only enqueue events with data for events that "
+                        "are components");
+                    ecs_assert(ti->size == cmd->size - (ecs_size_t)
+                        ((uintptr_t)desc->param - (uintptr_t)desc),
+                            ECS_INVALID_PARAMETER, 
+                            "param_size does not match size of event type");
+                }
+#endif
+                ecs_enqueue(world, desc);
+                break;
+            }
+            case EcsCmdClone:
+            case EcsCmdBulkNew:
+            case EcsCmdEmplace:
+            case EcsCmdEnsure:
+            case EcsCmdModified:
+            case EcsCmdModifiedNoHook:
+            case EcsCmdAddModified:
+            case EcsCmdPath:
+            case EcsCmdClear:
+            case EcsCmdOnDeleteAction:
+            case EcsCmdEnable:
+            case EcsCmdDisable:
+            case EcsCmdSkip:
+                ecs_assert(false, ECS_INTERNAL_ERROR, NULL);
+                break;
+            }
+        }
+
+        ecs_os_free(cmd);
+        cmd = next;
+        count ++;
+    }
+
+    return count;
+}
+
+void flecs_async_queue_fini(
+    ecs_world_t *world)
+{
+    ecs_async_cmd_t *cmd = flecs_async_pop_all(world);
+    while (cmd) {
+        ecs_async_cmd_t *next = cmd->next;
+        ecs_os_free(cmd);
+        cmd = next;
+    }
+}
+
 void flecs_stage_merge_post_frame(
     ecs_world_t *world,
     ecs_stage_t *stage)
@@ -627,6 +909,7 @@ ecs_stage_t* flecs_stage_new(
 
     stage->world = world;
     stage->thread_ctx = world;
+    stage->numa_node = -1;
 
     flecs_stack_init(&stage->allocators.iter_stack);
     flecs_stack_init(&stage->allocators.deser_stack);
@@ -670,6 +953,9 @@ void flecs_stage_free(
         flecs_commands_fini(stage, &stage->cmd_stack[i]);
     }
 
+    flecs_timeline_buffer_free(stage);
+    ecs_os_free(stage->cpus);
+
     flecs_stack_fini(&stage->allocators.iter_stack);
     flecs_stack_fini(&stage->allocators.deser_stack);
     flecs_ballocator_fini(&stage->allocators.cmd_entry_chunk);
@@ -94,6 +94,9 @@ void flecs_enqueue(
     ecs_stage_t *stage,
     ecs_event_desc_t *desc);
 
+void flecs_async_queue_fini(
+    ecs_world_t *world);
+
 void flecs_commands_push(
     ecs_stage_t *stage);
 
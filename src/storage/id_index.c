@@ -169,6 +169,59 @@ void flecs_id_record_fini_sparse(
     }
 }
 
+void flecs_id_record_init_ordered_children(
+    ecs_world_t *world,
+    ecs_id_record_t *idr)
+{
+    ecs_assert(ECS_PAIR_FIRST(idr->id) == EcsChildOf, 
+        ECS_INTERNAL_ERROR, NULL);
+
+    if (idr->flags & EcsIdOrderedChildren) {
+        return;
+    }
+
+    idr->flags |= EcsIdOrderedChildren;
+    ecs_vec_init_t(&world->allocator, &idr->ordered_children, ecs_entity_t, 0);
+
+    /* Add existing children. These have no defined order yet, so use the
+     * order in which they're stored in tables. */
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_all_iter(&idr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            int32_t count = ecs_table_count(table);
+            table->flags |= EcsTableHasOrderedParent;
+            if (count) {
+                ecs_entity_t *dst = ecs_vec_grow_t(&world->allocator, 
+                    &idr->ordered_children, ecs_entity_t, count);
+                ecs_os_memcpy_n(dst, ecs_table_entities(table), 
+                    ecs_entity_t, count);
+            }
+        }
+    }
+}
+
+void flecs_id_record_fini_ordered_children(
+    ecs_world_t *world,
+    ecs_id_record_t *idr)
+{
+    if (!(idr->flags & EcsIdOrderedChildren)) {
+        return;
+    }
+
+    idr->flags &= ~EcsIdOrderedChildren;
+    ecs_vec_fini_t(&world->allocator, &idr->ordered_children, ecs_entity_t);
+
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_all_iter(&idr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            tr->hdr.table->flags &= ~EcsTableHasOrderedParent;
+        }
+    }
+}
+
 static
 ecs_flags32_t flecs_id_record_event_flags(
     ecs_world_t *world,
@@ -370,6 +423,17 @@ ecs_id_record_t* flecs_id_record_new(
 
     idr->flags |= flecs_id_record_event_flags(world, id);
 
+    if (rel == EcsChildOf && tgt) {
+        /* Children of a parent with the OrderedChildren trait are kept in a
+         * list that preserves the order in which they were added. */
+        ecs_record_t *parent_r = flecs_entities_get_any(world, tgt);
+        if (parent_r && parent_r->table && 
+            (parent_r->table->flags & EcsTableHasOrderedChildren)) 
+        {
+            flecs_id_record_init_ordered_children(world, idr);
+        }
+    }
+
     if (idr->flags & EcsIdIsSparse) {
         flecs_id_record_init_sparse(world, idr);
     } else if (idr->flags & EcsIdIsUnion) {
@@ -460,6 +524,11 @@ void flecs_id_record_free(
     /* Cleanup sparse storage */
     flecs_id_record_fini_sparse(world, idr);
 
+    /* Cleanup ordered children */
+    if (idr->flags & EcsIdOrderedChildren) {
+        ecs_vec_fini_t(&world->allocator, &idr->ordered_children, ecs_entity_t);
+    }
+
     /* Update counters */
     world->info.id_delete_total ++;
     world->info.pair_id_count -= ECS_IS_PAIR(id);
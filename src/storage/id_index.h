@@ -47,6 +47,10 @@ struct ecs_id_record_t {
     /* Storage for sparse components or union relationships */
     void *sparse;
 
+    /* Children in order (only used for (ChildOf, parent) pairs where the
+     * parent has the OrderedChildren trait) */
+    ecs_vec_t ordered_children; /* vec<ecs_entity_t> */
+
     /* Lists for all id records that match a pair wildcard. The wildcard id
      * record is at the head of the list. */
     ecs_id_record_elem_t first;   /* (R, *) */
@@ -66,6 +70,11 @@ struct ecs_id_record_t {
 
     /* Cache for finding components that are reachable through a relationship */
     ecs_reachable_cache_t reachable;
+
+    /* Depth of tables with a (R, O) pair for a traversable relationship, which
+     * is the depth of O plus one. Invalidated together with the reachable 
+     * cache when O or one of its ancestors changes. 0 if not computed. */
+    int32_t depth;
 };
 
 /* Get id record for id */
@@ -78,6 +87,16 @@ ecs_id_record_t* flecs_id_record_ensure(
     ecs_world_t *world,
     ecs_id_t id);
 
+/* Start tracking the order of children for a (ChildOf, parent) record */
+void flecs_id_record_init_ordered_children(
+    ecs_world_t *world,
+    ecs_id_record_t *idr);
+
+/* Stop tracking the order of children for a (ChildOf, parent) record */
+void flecs_id_record_fini_ordered_children(
+    ecs_world_t *world,
+    ecs_id_record_t *idr);
+
 /* Increase refcount of id record */
 void flecs_id_record_claim(
     ecs_world_t *world,
@@ -231,6 +231,8 @@ void flecs_table_init_flags(
             table->flags |= EcsTableIsDisabled;
         } else if (id == EcsNotQueryable) {
             table->flags |= EcsTableNotQueryable;
+        } else if (id == EcsOrderedChildren) {
+            table->flags |= EcsTableHasOrderedChildren;
         } else {
             if (ECS_IS_PAIR(id)) {
                 ecs_entity_t r = ECS_PAIR_FIRST(id);
@@ -324,6 +326,7 @@ void flecs_table_init(
 {
     /* Make sure table->flags is initialized */
     flecs_table_init_flags(world, table);
+    flecs_table_bump_version(world, table);
 
     /* The following code walks the table type to discover which id records the
      * table needs to register table records with. 
@@ -569,6 +572,10 @@ void flecs_table_init(
         }
     }
 
+    if (childof_idr && (childof_idr->flags & EcsIdOrderedChildren)) {
+        table->flags |= EcsTableHasOrderedParent;
+    }
+
     table->component_map = flecs_wcalloc_n(
         world, int16_t, FLECS_HI_COMPONENT_ID);
 
@@ -822,9 +829,13 @@ void flecs_table_dtor_all(
             }
         }
 
-        /* Destruct components */
-        for (c = 0; c < column_count; c++) {
-            flecs_table_invoke_dtor(&table->data.columns[c], row, count);
+        /* Destruct components. When tables are deleted in bulk, the column
+         * storage is handed off by flecs_table_fini_data, and destructors run
+         * after all tables have been emptied. */
+        if (!is_delete || !world->store.defer_dtors) {
+            for (c = 0; c < column_count; c++) {
+                flecs_table_invoke_dtor(&table->data.columns[c], row, count);
+            }
         }
 
         /* Iterate entities first, then components. This ensures that only one
@@ -896,13 +907,23 @@ void flecs_table_fini_data(
         flecs_table_dtor_all(world, table, 0, count, is_delete);
     }
 
+    bool defer_dtors = count && is_delete && world->store.defer_dtors &&
+        (table->flags & EcsTableHasDtors);
+
     ecs_column_t *columns = table->data.columns;
     if (columns) {
         int32_t c, column_count = table->column_count;
         for (c = 0; c < column_count; c ++) {
             ecs_column_t *column = &columns[c];
             ecs_vec_t v = ecs_vec_from_column(column, table, column->ti->size);
-            ecs_vec_fini(&world->allocator, &v, column->ti->size);
+            if (defer_dtors && column->ti->hooks.dtor) {
+                ecs_deleted_column_t *dc = ecs_vec_append_t(&world->allocator,
+                    &world->store.deleted_columns, ecs_deleted_column_t);
+                dc->data = v;
+                dc->ti = column->ti;
+            } else {
+                ecs_vec_fini(&world->allocator, &v, column->ti->size);
+            }
             column->data = NULL;
         }
 
@@ -926,6 +947,7 @@ void flecs_table_fini_data(
     table->data.entities = NULL;
     table->data.count = 0;
     table->data.size = 0;
+    flecs_table_bump_version(world, table);
 
     if (deactivate && count) {
         flecs_table_set_empty(world, table);
@@ -1025,6 +1047,7 @@ void flecs_table_fini(
         table->column_map);
     flecs_wfree_n(world, int16_t, FLECS_HI_COMPONENT_ID, table->component_map);
     flecs_table_records_unregister(world, table);
+    flecs_table_observer_cache_fini(world, table);
 
     /* Update counters */
     world->info.table_count --;
@@ -1319,6 +1342,9 @@ int32_t flecs_table_grow_data(
 
     /* Update table entities/count/size */
     int32_t prev_count = table->data.count, prev_size = table->data.size;
+    if (v_entities.size != prev_size) {
+        flecs_table_bump_version(world, table);
+    }
     table->data.entities = v_entities.array;
     table->data.count = v_entities.count;
     table->data.size = v_entities.size;
@@ -1412,6 +1438,11 @@ int32_t flecs_table_append(
     ecs_assert(e != NULL, ECS_INTERNAL_ERROR, NULL);
     ecs_entity_t *entities = table->data.entities = v_entities.array;
     *e = entity;
+
+    /* Columns are reallocated along with the entity array */
+    if (v_entities.size != table->data.size) {
+        flecs_table_bump_version(world, table);
+    }
  
     /* If the table is monitored indicate that there has been a change */
     flecs_table_mark_table_dirty(world, table, 0);
@@ -1816,6 +1847,7 @@ bool flecs_table_shrink(
     table->data.count = v_entities.count;
     table->data.size = v_entities.size;
     table->data.entities = v_entities.array;
+    flecs_table_bump_version(world, table);
 
     flecs_table_check_sanity(world, table);
 
@@ -2108,6 +2140,9 @@ void flecs_table_merge_data(
     src_table->data.entities = src_entities.array;
     src_table->data.count = src_entities.count;
     src_table->data.size = src_entities.size;
+
+    flecs_table_bump_version(world, dst_table);
+    flecs_table_bump_version(world, src_table);
 }
 
 /* Merge source table into destination table. This typically happens as result
@@ -82,6 +82,7 @@ typedef struct ecs_table__t {
     
     struct ecs_table_record_t *records; /* Array with table records */
     ecs_hashmap_t *name_index;       /* Cached pointer to name index */
+    struct ecs_table_observer_cache_t *observers; /* Flattened observers per event */
 
     ecs_bitset_t *bs_columns;        /* Bitset columns */
     int16_t bs_count;
@@ -110,6 +111,9 @@ struct ecs_data_t {
 struct ecs_table_t {
     uint64_t id;                     /* Table id in sparse set */
     ecs_flags32_t flags;             /* Flags for testing table properties */
+    uint32_t version;                /* Storage version, changes when columns
+                                      * are reallocated or freed. Unique across
+                                      * tables, used to validate cached refs. */
     int16_t column_count;            /* Number of components (excluding tags) */
     ecs_type_t type;                 /* Vector with component ids */
 
@@ -126,6 +130,11 @@ struct ecs_table_t {
     ecs_table__t *_;                 /* Infrequently accessed table metadata */
 };
 
+/* Assign new storage version to table. Invalidates cached component pointers
+ * of refs to entities in the table. */
+#define flecs_table_bump_version(world, table)\
+    ((table)->version = ++ (world)->store.table_version)
+
 /* Init table */
 void flecs_table_init(
     ecs_world_t *world,
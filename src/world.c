@@ -4,6 +4,7 @@
  */
 
 #include "private_api.h"
+#include "addons/timeline/timeline.h"
 
 /* Id flags */
 const ecs_id_t ECS_PAIR =                                          (1ull << 63);
@@ -95,6 +96,7 @@ const ecs_entity_t EcsPanic =                       FLECS_HI_COMPONENT_ID + 54;
 /* Storage */
 const ecs_entity_t EcsSparse =                      FLECS_HI_COMPONENT_ID + 55;
 const ecs_entity_t EcsUnion =                       FLECS_HI_COMPONENT_ID + 56;
+const ecs_entity_t EcsOrderedChildren =             FLECS_HI_COMPONENT_ID + 78;
 
 /* Misc */
 const ecs_entity_t ecs_id(EcsDefaultChildComponent) = FLECS_HI_COMPONENT_ID + 57;
@@ -571,6 +573,7 @@ void flecs_init_store(
     ecs_allocator_t *a = &world->allocator;
     ecs_vec_init_t(a, &world->store.records, ecs_table_record_t, 0);
     ecs_vec_init_t(a, &world->store.marked_ids, ecs_marked_id_t, 0);
+    ecs_vec_init_t(a, &world->store.deleted_columns, ecs_deleted_column_t, 0);
     ecs_vec_init_t(a, &world->store.depth_ids, ecs_entity_t, 0);
     ecs_map_init(&world->store.entity_to_depth, &world->allocator);
 
@@ -707,8 +710,10 @@ void flecs_fini_store(ecs_world_t *world) {
     flecs_sparse_fini(&world->store.observers);
 
     ecs_allocator_t *a = &world->allocator;
+    ecs_vec_fini_t(a, &world->store.async_observers, ecs_observer_t*);
     ecs_vec_fini_t(a, &world->store.records, ecs_table_record_t);
     ecs_vec_fini_t(a, &world->store.marked_ids, ecs_marked_id_t);
+    ecs_vec_fini_t(a, &world->store.deleted_columns, ecs_deleted_column_t);
     ecs_vec_fini_t(a, &world->store.depth_ids, ecs_entity_t);
     ecs_map_fini(&world->store.entity_to_depth);
 }
@@ -835,6 +840,9 @@ static const char *flecs_addons_info[] = {
 #ifdef FLECS_REST
     "FLECS_REST",
 #endif
+#ifdef FLECS_TIMELINE
+    "FLECS_TIMELINE",
+#endif
 NULL
 };
 
@@ -1403,6 +1411,9 @@ int ecs_fini(
 
     world->flags |= EcsWorldQuit;
 
+    /* Stop recording before entities recorded on the timeline are deleted */
+    flecs_timeline_fini(world);
+
     /* Delete root entities first using regular APIs. This ensures that cleanup
      * policies get a chance to execute. */
     ecs_dbg_1("#[bold]cleanup root entities");
@@ -1436,6 +1447,9 @@ int ecs_fini(
     /* Purge deferred operations from the queue. This discards operations but
      * makes sure that any resources in the queue are freed */
     flecs_defer_purge(world, world->stages[0]);
+
+    /* Discard commands enqueued by threads without a stage */
+    flecs_async_queue_fini(world);
     ecs_log_pop_1();
 
     /* All queries are cleaned up, so monitors should've been cleaned up too */
@@ -1464,6 +1478,7 @@ int ecs_fini(
     flecs_observable_fini(&world->observable);
     flecs_name_index_fini(&world->aliases);
     flecs_name_index_fini(&world->symbols);
+    flecs_path_cache_fini(world);
     ecs_set_stage_count(world, 0);
     ecs_log_pop_1();
 
@@ -1912,8 +1927,16 @@ ecs_ftime_t ecs_frame_begin(
     world->on_commands_ctx_active = world->on_commands_ctx;
     world->on_commands_ctx = NULL;
 
+    /* Execute commands enqueued by threads without a stage, unless they are
+     * flushed at a different point in the frame */
+    if (!(world->flags & EcsWorldNoAsyncFlush)) {
+        ecs_async_flush(world);
+    }
+
     ecs_run_aperiodic(world, 0);
 
+    flecs_timeline_begin(world->stages[0]);
+
     return world->info.delta_time;
 error:
     return (ecs_ftime_t)0;
@@ -1935,6 +1958,8 @@ void ecs_frame_end(
 
     flecs_stop_measure_frame(world);
 
+    flecs_timeline_end(world->stages[0], EcsTimelineFrame, 0, 0, 1);
+
     /* Reset command handler each frame */
     world->on_commands_active = NULL;
     world->on_commands_ctx_active = NULL;
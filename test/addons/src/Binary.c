@@ -0,0 +1,951 @@
+#include <addons.h>
+
+typedef struct Named {
+    char *value;
+} Named;
+
+typedef struct Points {
+    ecs_vec_t value;
+} Points;
+
+static
+ECS_COMPONENT_DECLARE(Position);
+
+static
+ECS_COMPONENT_DECLARE(Velocity);
+
+static
+ECS_COMPONENT_DECLARE(Self);
+
+static
+ECS_COMPONENT_DECLARE(Named);
+
+static
+ECS_COMPONENT_DECLARE(Points);
+
+static
+void register_types(
+    ecs_world_t *world)
+{
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_COMPONENT_DEFINE(world, Velocity);
+    ECS_COMPONENT_DEFINE(world, Self);
+    ECS_COMPONENT_DEFINE(world, Named);
+    ECS_COMPONENT_DEFINE(world, Points);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            {"x", ecs_id(ecs_f32_t)},
+            {"y", ecs_id(ecs_f32_t)}
+        }
+    });
+
+    ecs_struct(world, {
+        .entity = ecs_id(Self),
+        .members = {
+            {"value", ecs_id(ecs_entity_t)}
+        }
+    });
+
+    ecs_struct(world, {
+        .entity = ecs_id(Named),
+        .members = {
+            {"value", ecs_id(ecs_string_t)}
+        }
+    });
+
+    ecs_struct(world, {
+        .entity = ecs_id(Points),
+        .members = {
+            {"value", ecs_vector(world, { .type = ecs_id(ecs_i32_t) })}
+        }
+    });
+}
+
+static
+ecs_world_t* round_trip(
+    ecs_world_t *world)
+{
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+    test_assert(size != 0);
+
+    ecs_world_t *result = ecs_init();
+    register_types(result);
+    test_int(ecs_world_from_binary(result, data, size), 0);
+    ecs_os_free(data);
+    return result;
+}
+
+static
+uint32_t read_u32(
+    const uint8_t **ptr)
+{
+    uint32_t result;
+    ecs_os_memcpy(&result, *ptr, 4);
+    *ptr += 4;
+    return result;
+}
+
+static
+uint64_t read_u64(
+    const uint8_t **ptr)
+{
+    uint64_t result;
+    ecs_os_memcpy(&result, *ptr, 8);
+    *ptr += 8;
+    return result;
+}
+
+static
+const char* read_str(
+    const uint8_t **ptr,
+    uint32_t length)
+{
+    const char *result = (const char*)*ptr;
+    *ptr += (length + 1 + 7) & ~7u;
+    return result;
+}
+
+static
+void read_iter_header(
+    const uint8_t **ptr,
+    uint32_t field_count)
+{
+    test_assert(!ecs_os_memcmp(*ptr, "FLQR", 4));
+    *ptr += 4;
+    test_int(read_u32(ptr), 1);
+    test_int(read_u32(ptr), 0x01020304);
+    test_int(read_u32(ptr), field_count);
+}
+
+static
+void read_iter_field(
+    const uint8_t **ptr,
+    ecs_id_t id,
+    const char *name)
+{
+    test_uint(read_u64(ptr), id);
+    uint32_t length = read_u32(ptr);
+    test_int(length, ecs_os_strlen(name));
+    read_u32(ptr);
+    test_str(read_str(ptr, length), name);
+}
+
+static
+void read_column(
+    const uint8_t **ptr,
+    ecs_id_t id,
+    ecs_entity_t src,
+    uint32_t kind,
+    uint32_t size,
+    uint32_t data_size)
+{
+    test_uint(read_u64(ptr), id);
+    test_uint(read_u64(ptr), src);
+    test_int(read_u32(ptr), kind);
+    test_int(read_u32(ptr), size);
+    test_int(read_u32(ptr), data_size);
+    read_u32(ptr);
+}
+
+void Binary_empty_world(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+    test_assert(size != 0);
+
+    ecs_world_t *dst = ecs_init();
+    test_int(ecs_world_from_binary(dst, data, size), 0);
+    ecs_os_free(data);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_component(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    ecs_world_t *dst = round_trip(world);
+
+    const Position *p = ecs_get(dst, e1, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    p = ecs_get(dst, e2, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_component_no_reflection(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Velocity, {1, 2}));
+
+    ecs_world_t *dst = round_trip(world);
+
+    const Velocity *v = ecs_get(dst, e, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_tag(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t Tag = ecs_entity(world, { .name = "Tag" });
+    ecs_entity_t e = ecs_new_w_id(world, Tag);
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_world_t *dst = round_trip(world);
+
+    ecs_entity_t dst_tag = ecs_lookup(dst, "Tag");
+    test_assert(dst_tag != 0);
+    test_assert(ecs_has_id(dst, e, dst_tag));
+    test_assert(ecs_has(dst, e, Position));
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_string_member(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Named, {"Hello"}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Named, {NULL}));
+
+    ecs_world_t *dst = round_trip(world);
+
+    const Named *n = ecs_get(dst, e1, Named);
+    test_assert(n != NULL);
+    test_str(n->value, "Hello");
+
+    n = ecs_get(dst, e2, Named);
+    test_assert(n != NULL);
+    test_str(n->value, NULL);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_vector_member(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e = ecs_new(world);
+    Points *p = ecs_ensure(world, e, Points);
+    ecs_vec_init_t(NULL, &p->value, int32_t, 3);
+    ecs_vec_append_t(NULL, &p->value, int32_t)[0] = 1;
+    ecs_vec_append_t(NULL, &p->value, int32_t)[0] = 2;
+    ecs_vec_append_t(NULL, &p->value, int32_t)[0] = 3;
+    ecs_modified(world, e, Points);
+
+    ecs_world_t *dst = round_trip(world);
+
+    const Points *dp = ecs_get(dst, e, Points);
+    test_assert(dp != NULL);
+    test_int(ecs_vec_count(&dp->value), 3);
+    test_int(ecs_vec_get_t(&dp->value, int32_t, 0)[0], 1);
+    test_int(ecs_vec_get_t(&dp->value, int32_t, 1)[0], 2);
+    test_int(ecs_vec_get_t(&dp->value, int32_t, 2)[0], 3);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_entity_member(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_entity_t e2 = ecs_entity(world, { .name = "e2" });
+    ecs_set(world, e2, Self, {e1});
+
+    ecs_world_t *dst = ecs_init();
+    /* Occupy id of e1 so the loader has to map it */
+    ecs_make_alive(dst, e1);
+    register_types(dst);
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+    test_int(ecs_world_from_binary(dst, data, size), 0);
+    ecs_os_free(data);
+
+    ecs_entity_t dst_e1 = ecs_lookup(dst, "e1");
+    test_assert(dst_e1 != 0);
+    test_assert(dst_e1 != e1);
+
+    ecs_entity_t dst_e2 = ecs_lookup(dst, "e2");
+    test_assert(dst_e2 != 0);
+
+    const Self *s = ecs_get(dst, dst_e2, Self);
+    test_assert(s != NULL);
+    test_uint(s->value, dst_e1);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_named_hierarchy(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+    ecs_set(world, child, Position, {10, 20});
+
+    ecs_world_t *dst = round_trip(world);
+
+    ecs_entity_t dst_parent = ecs_lookup(dst, "parent");
+    test_assert(dst_parent != 0);
+    ecs_entity_t dst_child = ecs_lookup(dst, "parent.child");
+    test_assert(dst_child != 0);
+    test_assert(ecs_has_pair(dst, dst_child, EcsChildOf, dst_parent));
+
+    const Position *p = ecs_get(dst, dst_child, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    (void)parent;
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_existing_named_entity(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e = ecs_entity(world, { .name = "e" });
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    ecs_world_t *dst = ecs_init();
+    register_types(dst);
+    ecs_new(dst);
+    ecs_new(dst);
+    ecs_entity_t dst_e = ecs_entity(dst, { .name = "e" });
+    ecs_set(dst, dst_e, Velocity, {1, 2});
+
+    test_int(ecs_world_from_binary(dst, data, size), 0);
+    ecs_os_free(data);
+
+    test_uint(ecs_lookup(dst, "e"), dst_e);
+
+    const Position *p = ecs_get(dst, dst_e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    const Velocity *v = ecs_get(dst, dst_e, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_load_twice(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t named = ecs_entity(world, { .name = "named" });
+    ecs_set(world, named, Position, {10, 20});
+    ecs_entity_t anon = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    ecs_world_t *dst = ecs_init();
+    register_types(dst);
+    test_int(ecs_world_from_binary(dst, data, size), 0);
+    test_int(ecs_world_from_binary(dst, data, size), 0);
+    ecs_os_free(data);
+
+    test_uint(ecs_lookup(dst, "named"), named);
+    test_assert(ecs_has(dst, anon, Position));
+
+    ecs_query_t *q = ecs_query(dst, { .terms = {{ ecs_id(Position) }}});
+    test_int(ecs_query_count(q).entities, 2);
+    ecs_query_fini(q);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_prefab_instance(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t base = ecs_entity(world, { .name = "Base" });
+    ecs_add_id(world, base, EcsPrefab);
+    ecs_entity_t base_child = ecs_entity(world, { .name = "Base.child" });
+    ecs_add_id(world, base_child, EcsPrefab);
+    ecs_set(world, base_child, Position, {10, 20});
+
+    ecs_entity_t inst = ecs_entity(world, { .name = "inst" });
+    ecs_add_pair(world, inst, EcsIsA, base);
+    ecs_entity_t inst_child = ecs_lookup(world, "inst.child");
+    test_assert(inst_child != 0);
+    ecs_set(world, inst_child, Position, {30, 40});
+
+    ecs_world_t *dst = round_trip(world);
+
+    ecs_entity_t dst_inst = ecs_lookup(dst, "inst");
+    test_assert(dst_inst != 0);
+    test_assert(ecs_has_pair(dst, dst_inst, EcsIsA, ecs_lookup(dst, "Base")));
+
+    ecs_entity_t dst_child = ecs_lookup(dst, "inst.child");
+    test_assert(dst_child != 0);
+
+    const Position *p = ecs_get(dst, dst_child, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    int32_t count = 0;
+    ecs_iter_t it = ecs_children(dst, dst_inst);
+    while (ecs_children_next(&it)) {
+        count += it.count;
+    }
+    test_int(count, 1);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_sparse_component(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+    ecs_add_id(world, ecs_id(Velocity), EcsSparse);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Velocity, {1, 2}));
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    ecs_world_t *dst = ecs_init();
+    register_types(dst);
+    ecs_add_id(dst, ecs_id(Velocity), EcsSparse);
+    test_int(ecs_world_from_binary(dst, data, size), 0);
+    ecs_os_free(data);
+
+    const Velocity *v = ecs_get(dst, e, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_union_relationship(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t Movement = ecs_entity(world, { .name = "Movement" });
+    ecs_add_id(world, Movement, EcsUnion);
+    ecs_entity_t Walking = ecs_entity(world, { .name = "Walking" });
+    ecs_entity_t Running = ecs_entity(world, { .name = "Running" });
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Running);
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    ecs_world_t *dst = ecs_init();
+    register_types(dst);
+    ecs_entity_t dst_movement = ecs_entity(dst, { .name = "Movement" });
+    ecs_add_id(dst, dst_movement, EcsUnion);
+    test_int(ecs_world_from_binary(dst, data, size), 0);
+    ecs_os_free(data);
+
+    test_uint(ecs_get_target(dst, e1, dst_movement, 0),
+        ecs_lookup(dst, "Walking"));
+    test_uint(ecs_get_target(dst, e2, dst_movement, 0),
+        ecs_lookup(dst, "Running"));
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_file(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e = ecs_entity(world, { .name = "e" });
+    ecs_set(world, e, Position, {10, 20});
+    ecs_set(world, e, Named, {"Hello"});
+
+    const char *filename = "binary_file_test.bin";
+    test_int(ecs_world_to_binary_file(world, filename), 0);
+
+    ecs_world_t *dst = ecs_init();
+    register_types(dst);
+    test_int(ecs_world_from_binary_file(dst, filename), 0);
+    remove(filename);
+
+    ecs_entity_t dst_e = ecs_lookup(dst, "e");
+    test_assert(dst_e != 0);
+
+    const Position *p = ecs_get(dst, dst_e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    const Named *n = ecs_get(dst, dst_e, Named);
+    test_assert(n != NULL);
+    test_str(n->value, "Hello");
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_invalid_magic(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_size_t size = 0;
+    char *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+    data[0] = 'X';
+
+    ecs_log_set_level(-4);
+    test_assert(ecs_world_from_binary(world, data, size) != 0);
+    ecs_os_free(data);
+
+    ecs_fini(world);
+}
+
+void Binary_truncated(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e = ecs_entity(world, { .name = "e" });
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    ecs_world_t *dst = ecs_init();
+    register_types(dst);
+
+    ecs_log_set_level(-4);
+    test_assert(ecs_world_from_binary(dst, data, size - 8) != 0);
+    test_assert(ecs_world_from_binary(dst, data, 4) != 0);
+    ecs_os_free(data);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_vector_member_invalid_count(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e = ecs_new(world);
+    Points *p = ecs_ensure(world, e, Points);
+    ecs_vec_init_t(NULL, &p->value, int32_t, 3);
+    ecs_vec_append_t(NULL, &p->value, int32_t)[0] = 1;
+    ecs_vec_append_t(NULL, &p->value, int32_t)[0] = 2;
+    ecs_vec_append_t(NULL, &p->value, int32_t)[0] = 3;
+    ecs_modified(world, e, Points);
+
+    ecs_size_t size = 0;
+    uint8_t *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    /* Find vector count followed by elements */
+    uint32_t elems[4] = {3, 1, 2, 3};
+    ecs_size_t i, offset = -1;
+    for (i = 0; i <= size - ECS_SIZEOF(elems); i ++) {
+        if (!ecs_os_memcmp(&data[i], elems, ECS_SIZEOF(elems))) {
+            offset = i;
+            break;
+        }
+    }
+    test_assert(offset != -1);
+
+    ecs_world_t *dst = ecs_init();
+    register_types(dst);
+
+    ecs_log_set_level(-4);
+
+    uint32_t count = UINT32_MAX;
+    ecs_os_memcpy(&data[offset], &count, 4);
+    test_assert(ecs_world_from_binary(dst, data, size) != 0);
+
+    count = 1000000;
+    ecs_os_memcpy(&data[offset], &count, 4);
+    test_assert(ecs_world_from_binary(dst, data, size) != 0);
+
+    ecs_os_free(data);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_named_hierarchy_parent_cycle(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+
+    ecs_size_t size = 0;
+    uint8_t *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    /* Find name entry of parent, and make child the parent of parent */
+    ecs_size_t i, offset = -1;
+    for (i = 0; i <= size - 32; i += 8) {
+        uint64_t entity, entity_parent;
+        uint32_t length;
+        ecs_os_memcpy(&entity, &data[i], 8);
+        ecs_os_memcpy(&entity_parent, &data[i + 8], 8);
+        ecs_os_memcpy(&length, &data[i + 20], 4);
+        if (entity == parent && !entity_parent && length == 6 &&
+            !ecs_os_memcmp(&data[i + 24], "parent", 7))
+        {
+            offset = i;
+            break;
+        }
+    }
+    test_assert(offset != -1);
+
+    uint64_t cycle = child;
+    ecs_os_memcpy(&data[offset + 8], &cycle, 8);
+
+    ecs_world_t *dst = ecs_init();
+    register_types(dst);
+
+    ecs_log_set_level(-4);
+    test_assert(ecs_world_from_binary(dst, data, size) != 0);
+    ecs_os_free(data);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_component_size_mismatch(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t c = ecs_component(world, {
+        .entity = ecs_entity(world, { .name = "C" }),
+        .type.size = 8,
+        .type.alignment = 4
+    });
+
+    ecs_entity_t e = ecs_new(world);
+    ecs_add_id(world, e, c);
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    ecs_world_t *dst = ecs_init();
+    ecs_component(dst, {
+        .entity = ecs_entity(dst, { .name = "C" }),
+        .type.size = 4,
+        .type.alignment = 4
+    });
+
+    ecs_log_set_level(-4);
+    test_assert(ecs_world_from_binary(dst, data, size) != 0);
+    ecs_os_free(data);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Binary_iter_to_binary(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    ecs_query_t *q = ecs_query(world, { .expr = "Position" });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    ecs_size_t size = 0;
+    uint8_t *data = ecs_iter_to_binary(&it, &size);
+    test_assert(data != NULL);
+    test_int(size, 144);
+
+    const uint8_t *ptr = data;
+    read_iter_header(&ptr, 1);
+    read_iter_field(&ptr, ecs_id(Position), "Position");
+
+    test_int(read_u32(&ptr), 0);
+    test_int(read_u32(&ptr), 2);
+    test_int(read_u32(&ptr), 1);
+    read_u32(&ptr);
+    test_uint(read_u64(&ptr), e1);
+    test_uint(read_u64(&ptr), e2);
+
+    read_column(&ptr, ecs_id(Position), 0, 1, 8, 16);
+    const Position *p = (const Position*)ptr;
+    test_int(p[0].x, 10);
+    test_int(p[0].y, 20);
+    test_int(p[1].x, 30);
+    test_int(p[1].y, 40);
+    ptr += 16;
+
+    test_int(read_u32(&ptr), 1);
+    test_int(ptr - data + 12, size);
+
+    ecs_os_free(data);
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+void Binary_iter_to_binary_shared_field(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t parent = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t child = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ecs_add_pair(world, child, EcsChildOf, parent);
+
+    ecs_query_t *q = ecs_query(world, { .expr = "Position, Position(up)" });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    ecs_size_t size = 0;
+    uint8_t *data = ecs_iter_to_binary(&it, &size);
+    test_assert(data != NULL);
+
+    const uint8_t *ptr = data;
+    read_iter_header(&ptr, 2);
+    read_iter_field(&ptr, ecs_id(Position), "Position");
+    read_iter_field(&ptr, ecs_id(Position), "Position");
+
+    test_int(read_u32(&ptr), 0);
+    test_int(read_u32(&ptr), 1);
+    test_int(read_u32(&ptr), 3);
+    read_u32(&ptr);
+    test_uint(read_u64(&ptr), child);
+
+    read_column(&ptr, ecs_id(Position), 0, 1, 8, 8);
+    const Position *p = (const Position*)ptr;
+    test_int(p->x, 3);
+    test_int(p->y, 4);
+    ptr += 8;
+
+    read_column(&ptr, ecs_id(Position), parent, 1, 8, 8);
+    p = (const Position*)ptr;
+    test_int(p->x, 1);
+    test_int(p->y, 2);
+    ptr += 8;
+
+    test_int(read_u32(&ptr), 1);
+    test_int(ptr - data + 12, size);
+
+    ecs_os_free(data);
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+void Binary_iter_to_binary_tag_and_optional(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ECS_TAG(world, Tag);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_add(world, e, Tag);
+
+    ecs_query_t *q = ecs_query(world, { .expr = "Position, Tag, ?Velocity" });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    ecs_size_t size = 0;
+    uint8_t *data = ecs_iter_to_binary(&it, &size);
+    test_assert(data != NULL);
+
+    const uint8_t *ptr = data;
+    read_iter_header(&ptr, 3);
+    read_iter_field(&ptr, ecs_id(Position), "Position");
+    read_iter_field(&ptr, Tag, "Tag");
+    read_iter_field(&ptr, ecs_id(Velocity), "Velocity");
+
+    test_int(read_u32(&ptr), 0);
+    test_int(read_u32(&ptr), 1);
+    test_int(read_u32(&ptr), 3);
+    read_u32(&ptr);
+    test_uint(read_u64(&ptr), e);
+
+    read_column(&ptr, ecs_id(Position), 0, 1, 8, 8);
+    ptr += 8;
+    read_column(&ptr, Tag, 0, 0, 0, 0);
+
+    test_int(read_u32(&ptr), 1);
+    test_int(ptr - data + 12, size);
+
+    ecs_os_free(data);
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+void Binary_iter_to_binary_string_member(void) {
+    ecs_world_t *world = ecs_init();
+    register_types(world);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Named, {"foo"}));
+
+    ecs_query_t *q = ecs_query(world, { .expr = "Named" });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    ecs_size_t size = 0;
+    uint8_t *data = ecs_iter_to_binary(&it, &size);
+    test_assert(data != NULL);
+
+    const uint8_t *ptr = data;
+    read_iter_header(&ptr, 1);
+    read_iter_field(&ptr, ecs_id(Named), "Named");
+
+    test_int(read_u32(&ptr), 0);
+    test_int(read_u32(&ptr), 1);
+    test_int(read_u32(&ptr), 1);
+    read_u32(&ptr);
+    test_uint(read_u64(&ptr), e);
+
+    read_column(&ptr, ecs_id(Named), 0, 2, ECS_SIZEOF(Named), 8);
+    test_int(read_u32(&ptr), 4);
+    test_str((const char*)ptr, "foo");
+    ptr += 4;
+
+    test_int(read_u32(&ptr), 1);
+    test_int(ptr - data + 12, size);
+
+    ecs_os_free(data);
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+typedef struct Floats {
+    int32_t count;
+    float *elems;
+} Floats;
+
+static ECS_DTOR(Floats, ptr, {
+    ecs_os_free(ptr->elems);
+})
+
+static
+size_t Floats_count(const void *ptr) {
+    const Floats *data = ptr;
+    return (size_t)data->count;
+}
+
+static
+void Floats_resize(void *ptr, size_t count) {
+    Floats *data = ptr;
+    data->count = (int32_t)count;
+    if (count) {
+        data->elems = ecs_os_realloc_n(data->elems, float, data->count);
+    } else {
+        ecs_os_free(data->elems);
+        data->elems = NULL;
+    }
+}
+
+static
+void* Floats_data(void *ptr) {
+    Floats *data = ptr;
+    return data->elems;
+}
+
+static
+void register_floats(
+    ecs_world_t *world)
+{
+    ECS_COMPONENT(world, Floats);
+
+    ecs_set_hooks(world, Floats, {
+        .ctor = flecs_default_ctor,
+        .dtor = ecs_dtor(Floats)
+    });
+
+    ecs_opaque(world, {
+        .entity = ecs_id(Floats),
+        .type.as_type = ecs_vector(world, { .type = ecs_id(ecs_f32_t) }),
+        .type.count = Floats_count,
+        .type.resize = Floats_resize,
+        .type.data = Floats_data
+    });
+}
+
+void Binary_opaque_span(void) {
+    ecs_world_t *world = ecs_init();
+    register_floats(world);
+
+    ecs_entity_t ecs_id(Floats) = ecs_lookup(world, "Floats");
+    test_assert(ecs_id(Floats) != 0);
+
+    ecs_entity_t e1 = ecs_new(world);
+    Floats *f = ecs_ensure(world, e1, Floats);
+    Floats_resize(f, 3);
+    f->elems[0] = 1.5f;
+    f->elems[1] = 2.5f;
+    f->elems[2] = 3.5f;
+    ecs_modified(world, e1, Floats);
+
+    ecs_entity_t e2 = ecs_new(world);
+    ecs_add(world, e2, Floats);
+
+    ecs_size_t size = 0;
+    void *data = ecs_world_to_binary(world, &size);
+    test_assert(data != NULL);
+
+    ecs_world_t *dst = ecs_init();
+    register_floats(dst);
+    test_int(ecs_world_from_binary(dst, data, size), 0);
+    ecs_os_free(data);
+
+    const Floats *df = ecs_get(dst, e1, Floats);
+    test_assert(df != NULL);
+    test_int(df->count, 3);
+    test_flt(df->elems[0], 1.5f);
+    test_flt(df->elems[1], 2.5f);
+    test_flt(df->elems[2], 3.5f);
+
+    df = ecs_get(dst, e2, Floats);
+    test_assert(df != NULL);
+    test_int(df->count, 0);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
@@ -68,3 +68,51 @@ void Http_stop_start(void) {
     
     ecs_http_server_fini(srv);
 }
+
+static char content_type_buf[32];
+
+static bool OnRequestContentType(
+    const ecs_http_request_t* request, 
+    ecs_http_reply_t *reply,
+    void *ctx)
+{
+    ecs_strbuf_appendlit(&reply->body, "Hello");
+    reply->content_type = content_type_buf;
+    return true;
+}
+
+void Http_cached_reply_content_type(void) {
+    ecs_set_os_api_impl();
+
+    ecs_http_server_t *srv = ecs_http_server_init(&(ecs_http_server_desc_t){
+        .callback = OnRequestContentType,
+        .cache_timeout = 1.0
+    });
+
+    test_assert(srv != NULL);
+
+    ecs_os_strcpy(content_type_buf, "text/plain");
+
+    {
+        ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+        test_int(0, ecs_http_server_request(srv, "GET", "/hello", &reply));
+        test_int(reply.code, 200);
+        test_str(reply.content_type, "text/plain");
+        ecs_strbuf_reset(&reply.body);
+    }
+
+    /* Cached reply must not depend on storage owned by the handler */
+    ecs_os_strcpy(content_type_buf, "invalid");
+
+    {
+        ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+        test_int(0, ecs_http_server_request(srv, "GET", "/hello", &reply));
+        test_int(reply.code, 200);
+        test_str(reply.content_type, "text/plain");
+        char *reply_str = ecs_strbuf_get(&reply.body);
+        test_str(reply_str, "Hello");
+        ecs_os_free(reply_str);
+    }
+
+    ecs_http_server_fini(srv);
+}
@@ -1,6 +1,7 @@
 #include <addons.h>
 
 static ECS_COMPONENT_DECLARE(Position);
+static ECS_COMPONENT_DECLARE(Velocity);
 static ECS_DECLARE(Tag);
 
 void MultiThread_setup(void) {
@@ -1394,3 +1395,183 @@ void MultiThread_run_single_thread_on_main(void) {
 
     ecs_fini(world);
 }
+
+static
+void ProgressTableStage(ecs_iter_t *it) {
+    Position *pos = ecs_field(it, Position, 0);
+    int row;
+    for (row = 0; row < it->count; row ++) {
+        pos[row].x ++;
+        pos[row].y = (float)ecs_stage_get_id(it->world);
+    }
+}
+
+void MultiThread_table_affinity(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_COMPONENT_DEFINE(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = ProgressTableStage,
+        .multi_threaded = true,
+        .table_affinity = true
+    });
+
+    int i, TABLES = 16, PER_TABLE = 5, ENTITIES = TABLES * PER_TABLE;
+    ecs_entity_t *handles = ecs_os_alloca(sizeof(ecs_entity_t) * ENTITIES);
+
+    /* Create a table per tag */
+    ecs_entity_t tags[16];
+    for (i = 0; i < TABLES; i ++) {
+        tags[i] = ecs_new(world);
+    }
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_new_w_id(world, tags[i / PER_TABLE]);
+        ecs_set(world, handles[i], Position, {0});
+    }
+
+    set_worker_kind(world, 4);
+    ecs_progress(world, 0);
+
+    float stage_of_table[16];
+    for (i = 0; i < ENTITIES; i ++) {
+        const Position *p = ecs_get(world, handles[i], Position);
+        test_int(p->x, 1);
+
+        /* All entities in a table are processed by the same stage */
+        if (!(i % PER_TABLE)) {
+            stage_of_table[i / PER_TABLE] = p->y;
+        } else {
+            test_int(p->y, stage_of_table[i / PER_TABLE]);
+        }
+    }
+
+    /* Tables are processed by the same stage each frame */
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        const Position *p = ecs_get(world, handles[i], Position);
+        test_int(p->x, 2);
+        test_int(p->y, stage_of_table[i / PER_TABLE]);
+    }
+
+    ecs_fini(world);
+}
+
+void MultiThread_set_stage_affinity(void) {
+    ecs_world_t *world = init_world();
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {0}));
+
+    set_worker_kind(world, 2);
+
+    int32_t cpu = 0;
+    test_int(ecs_set_stage_affinity(world, 0, &cpu, 1), 0);
+    test_int(ecs_set_stage_affinity(world, 1, &cpu, 1), 0);
+    test_int(ecs_get_stage_numa_node(world, 1), -1);
+
+    ecs_progress(world, 0);
+    test_int(ecs_get(world, e, Position)->x, 1);
+
+    /* Remove affinity */
+    test_int(ecs_set_stage_affinity(world, 1, NULL, 0), 0);
+
+    ecs_progress(world, 0);
+    test_int(ecs_get(world, e, Position)->x, 2);
+
+    ecs_fini(world);
+}
+
+void MultiThread_set_stage_numa_node(void) {
+    ecs_world_t *world = init_world();
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {0}));
+
+    set_worker_kind(world, 2);
+
+    int32_t cpu;
+    if (ecs_os_numa_node_cpus(0, &cpu, 1) <= 0) {
+        /* Platform doesn't report NUMA nodes */
+        test_assert(ecs_set_stage_numa_node(world, 1, 0) != 0);
+        test_int(ecs_get_stage_numa_node(world, 1), -1);
+        ecs_fini(world);
+        return;
+    }
+
+    test_int(ecs_get_stage_numa_node(world, 0), -1);
+    test_int(ecs_get_stage_numa_node(world, 1), -1);
+    test_int(ecs_set_stage_numa_node(world, 1, 0), 0);
+    test_int(ecs_get_stage_numa_node(world, 0), -1);
+    test_int(ecs_get_stage_numa_node(world, 1), 0);
+
+    ecs_progress(world, 0);
+    test_int(ecs_get(world, e, Position)->x, 1);
+
+    /* Setting explicit CPUs resets node */
+    test_int(ecs_set_stage_affinity(world, 1, &cpu, 1), 0);
+    test_int(ecs_get_stage_numa_node(world, 1), -1);
+
+    ecs_fini(world);
+}
+
+void MultiThread_set_stage_numa_node_invalid(void) {
+    ecs_world_t *world = init_world();
+
+    set_worker_kind(world, 2);
+
+    test_assert(ecs_set_stage_numa_node(world, 1, 100000) != 0);
+    test_int(ecs_get_stage_numa_node(world, 1), -1);
+
+    ecs_fini(world);
+}
+
+static
+void AsyncSetVelocity(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        /* Store stage that ran the event */
+        ecs_set(it->world, it->entities[i], Velocity, 
+            {p[i].x, (float)ecs_stage_get_id(it->world)});
+    }
+}
+
+void MultiThread_observer_async(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_COMPONENT_DEFINE(world, Velocity);
+
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = AsyncSetVelocity,
+        .async = true
+    });
+
+    int i, ENTITIES = 100;
+    ecs_entity_t *handles = ecs_os_alloca(sizeof(ecs_entity_t) * ENTITIES);
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {(float)i, 0}));
+    }
+
+    test_int(ecs_observer_queue_count(world, o), ENTITIES);
+
+    set_worker_kind(world, 4);
+    ecs_progress(world, 0);
+
+    test_int(ecs_observer_queue_count(world, o), 0);
+
+    /* Events are divided in contiguous slices between stages */
+    for (i = 0; i < ENTITIES; i ++) {
+        const Velocity *v = ecs_get(world, handles[i], Velocity);
+        test_assert(v != NULL);
+        test_int(v->x, i);
+        test_int(v->y, i / 25);
+    }
+
+    ecs_fini(world);
+}
@@ -3285,3 +3285,549 @@ void Pipeline_run_w_0_src_query(void) {
 
     ecs_fini(world);
 }
+
+static
+void AsyncCountFoo(ecs_iter_t *it) {
+    int32_t *count = it->ctx;
+    (*count) += it->count;
+}
+
+void Pipeline_async_flush_frame_begin(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new(world);
+
+    int32_t on_load = 0;
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnLoad))
+        }),
+        .query.terms = {{ Foo }},
+        .callback = AsyncCountFoo,
+        .ctx = &on_load
+    });
+
+    ecs_async_add(world, e, Foo);
+    test_assert(!ecs_has(world, e, Foo));
+
+    ecs_progress(world, 0);
+    test_assert(ecs_has(world, e, Foo));
+    test_int(on_load, 1);
+
+    ecs_fini(world);
+}
+
+void Pipeline_async_flush_phase(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new(world);
+
+    int32_t on_load = 0, on_update = 0;
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnLoad))
+        }),
+        .query.terms = {{ Foo }},
+        .callback = AsyncCountFoo,
+        .ctx = &on_load
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ Foo }},
+        .callback = AsyncCountFoo,
+        .ctx = &on_update
+    });
+
+    ecs_set_async_flush_phase(world, EcsPostLoad);
+    test_assert(ecs_lookup(world, "flecs.pipeline.AsyncFlush") != 0);
+
+    ecs_async_add(world, e, Foo);
+
+    ecs_progress(world, 0);
+    test_assert(ecs_has(world, e, Foo));
+    test_int(on_load, 0);
+    test_int(on_update, 1);
+
+    ecs_set_async_flush_phase(world, 0);
+    test_assert(ecs_lookup(world, "flecs.pipeline.AsyncFlush") == 0);
+
+    ecs_async_remove(world, e, Foo);
+    ecs_progress(world, 0);
+    test_assert(!ecs_has(world, e, Foo));
+    test_int(on_load, 0);
+    test_int(on_update, 1);
+
+    ecs_fini(world);
+}
+
+static void RebuildSys(ecs_iter_t *it) { }
+
+#define REBUILD_SYSTEM_COUNT (60)
+
+/* Create systems that alternate between writing a component to the stage and
+ * reading it from the main storage, so that the pipeline contains merges */
+static
+ecs_world_t* rebuild_world(
+    ecs_entity_t *systems,
+    int32_t disabled)
+{
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_COMPONENT_DEFINE(world, Velocity);
+
+    ecs_entity_t e = ecs_new(world);
+    ecs_set(world, e, Position, {0, 0});
+    ecs_set(world, e, Velocity, {0, 0});
+
+    const char *exprs[] = {
+        "Position, [out] Velocity()",
+        "Position",
+        "Velocity"
+    };
+
+    int32_t i;
+    for (i = 0; i < REBUILD_SYSTEM_COUNT; i ++) {
+        systems[i] = ecs_system(world, {
+            .entity = ecs_entity(world, {
+                .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+            }),
+            .query.expr = exprs[i % 3],
+            .callback = RebuildSys
+        });
+    }
+
+    if (disabled != -1) {
+        ecs_enable(world, systems[disabled], false);
+    }
+
+    return world;
+}
+
+static
+void test_same_schedule(
+    ecs_world_t *world_1,
+    ecs_world_t *world_2)
+{
+    ecs_pipeline_stats_t stats_1 = {0}, stats_2 = {0};
+    test_bool(ecs_pipeline_stats_get(
+        world_1, ecs_get_pipeline(world_1), &stats_1), true);
+    test_bool(ecs_pipeline_stats_get(
+        world_2, ecs_get_pipeline(world_2), &stats_2), true);
+
+    int32_t i, count = ecs_vec_count(&stats_1.systems);
+    test_int(count, ecs_vec_count(&stats_2.systems));
+    ecs_entity_t *systems_1 = ecs_vec_first(&stats_1.systems);
+    ecs_entity_t *systems_2 = ecs_vec_first(&stats_2.systems);
+    for (i = 0; i < count; i ++) {
+        test_uint(systems_1[i], systems_2[i]);
+    }
+
+    test_int(ecs_vec_count(&stats_1.sync_points), 
+        ecs_vec_count(&stats_2.sync_points));
+
+    ecs_pipeline_stats_fini(&stats_1);
+    ecs_pipeline_stats_fini(&stats_2);
+}
+
+static
+int32_t rebuild_system_count(
+    ecs_world_t *world)
+{
+    ecs_pipeline_stats_t stats = {0};
+    test_bool(ecs_pipeline_stats_get(
+        world, ecs_get_pipeline(world), &stats), true);
+    int32_t result = stats.rebuild_system_count;
+    ecs_pipeline_stats_fini(&stats);
+    return result;
+}
+
+void Pipeline_rebuild_disable_system(void) {
+    ecs_entity_t systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *world = rebuild_world(systems, -1);
+    ecs_progress(world, 0);
+    test_assert(rebuild_system_count(world) >= REBUILD_SYSTEM_COUNT);
+
+    ecs_enable(world, systems[31], false);
+    ecs_progress(world, 0);
+    test_assert(rebuild_system_count(world) < 10);
+
+    ecs_entity_t expect_systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *expect = rebuild_world(expect_systems, 31);
+    ecs_progress(expect, 0);
+    test_same_schedule(world, expect);
+
+    ecs_fini(world);
+    ecs_fini(expect);
+}
+
+void Pipeline_rebuild_disable_system_w_merge(void) {
+    ecs_entity_t systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *world = rebuild_world(systems, -1);
+    ecs_progress(world, 0);
+
+    ecs_pipeline_stats_t stats = {0};
+    ecs_pipeline_stats_get(world, ecs_get_pipeline(world), &stats);
+    int32_t sync_count = ecs_vec_count(&stats.sync_points);
+    ecs_pipeline_stats_fini(&stats);
+
+    /* System writes component to stage, which causes a merge */
+    ecs_enable(world, systems[30], false);
+    ecs_progress(world, 0);
+    test_assert(rebuild_system_count(world) < 10);
+
+    ecs_pipeline_stats_get(world, ecs_get_pipeline(world), &stats);
+    test_int(ecs_vec_count(&stats.sync_points), sync_count - 1);
+    ecs_pipeline_stats_fini(&stats);
+
+    ecs_entity_t expect_systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *expect = rebuild_world(expect_systems, 30);
+    ecs_progress(expect, 0);
+    test_same_schedule(world, expect);
+
+    ecs_fini(world);
+    ecs_fini(expect);
+}
+
+void Pipeline_rebuild_enable_system(void) {
+    ecs_entity_t systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *world = rebuild_world(systems, 30);
+    ecs_progress(world, 0);
+
+    ecs_enable(world, systems[30], true);
+    ecs_progress(world, 0);
+    test_assert(rebuild_system_count(world) < 10);
+
+    ecs_entity_t expect_systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *expect = rebuild_world(expect_systems, -1);
+    ecs_progress(expect, 0);
+    test_same_schedule(world, expect);
+
+    ecs_fini(world);
+    ecs_fini(expect);
+}
+
+void Pipeline_rebuild_disable_first_system(void) {
+    ecs_entity_t systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *world = rebuild_world(systems, -1);
+    ecs_progress(world, 0);
+
+    ecs_enable(world, systems[0], false);
+    ecs_progress(world, 0);
+    test_assert(rebuild_system_count(world) < 10);
+
+    ecs_entity_t expect_systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *expect = rebuild_world(expect_systems, 0);
+    ecs_progress(expect, 0);
+    test_same_schedule(world, expect);
+
+    ecs_fini(world);
+    ecs_fini(expect);
+}
+
+void Pipeline_rebuild_disable_last_system(void) {
+    ecs_entity_t systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *world = rebuild_world(systems, -1);
+    ecs_progress(world, 0);
+
+    ecs_enable(world, systems[REBUILD_SYSTEM_COUNT - 1], false);
+    ecs_progress(world, 0);
+    test_assert(rebuild_system_count(world) < 10);
+
+    ecs_entity_t expect_systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *expect = rebuild_world(
+        expect_systems, REBUILD_SYSTEM_COUNT - 1);
+    ecs_progress(expect, 0);
+    test_same_schedule(world, expect);
+
+    ecs_fini(world);
+    ecs_fini(expect);
+}
+
+void Pipeline_rebuild_stats(void) {
+    ecs_entity_t systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *world = rebuild_world(systems, -1);
+    ecs_measure_system_time(world, true);
+    ecs_progress(world, 0);
+
+    ecs_pipeline_stats_t stats = {0};
+    test_bool(ecs_pipeline_stats_get(
+        world, ecs_get_pipeline(world), &stats), true);
+    test_int(stats.rebuild_count, 1);
+    test_int(stats.incremental_rebuild_count, 0);
+    test_int(stats.rebuild_system_count, stats.system_count);
+    int32_t system_count = stats.system_count;
+    int32_t active_system_count = stats.active_system_count;
+    test_assert(system_count >= REBUILD_SYSTEM_COUNT);
+
+    ecs_enable(world, systems[31], false);
+    ecs_progress(world, 0);
+
+    test_bool(ecs_pipeline_stats_get(
+        world, ecs_get_pipeline(world), &stats), true);
+    test_int(stats.rebuild_count, 2);
+    test_int(stats.incremental_rebuild_count, 1);
+    test_int(stats.system_count, system_count - 1);
+    test_int(stats.active_system_count, active_system_count - 1);
+    test_assert(stats.rebuild_system_count > 0);
+    test_assert(stats.rebuild_system_count < system_count);
+    test_assert(stats.rebuild_time_spent > 0);
+    ecs_pipeline_stats_fini(&stats);
+
+    ecs_fini(world);
+}
+
+void Pipeline_rebuild_recreate_system_w_different_query(void) {
+    ecs_entity_t systems[REBUILD_SYSTEM_COUNT];
+    ecs_world_t *world = rebuild_world(systems, -1);
+    ecs_progress(world, 0);
+
+    ecs_pipeline_stats_t stats = {0};
+    ecs_pipeline_stats_get(world, ecs_get_pipeline(world), &stats);
+    int32_t sync_count = ecs_vec_count(&stats.sync_points);
+    ecs_pipeline_stats_fini(&stats);
+
+    /* Recreate system that writes to the stage with a query that doesn't */
+    ecs_remove_pair(world, systems[30], ecs_id(EcsPoly), EcsSystem);
+    ecs_system(world, {
+        .entity = systems[30],
+        .query.expr = "Position",
+        .callback = RebuildSys
+    });
+    ecs_progress(world, 0);
+
+    ecs_pipeline_stats_get(world, ecs_get_pipeline(world), &stats);
+    test_int(ecs_vec_count(&stats.sync_points), sync_count - 1);
+    ecs_pipeline_stats_fini(&stats);
+
+    ecs_fini(world);
+}
+
+static
+void AsyncObserver(ecs_iter_t *it) {
+    int32_t *count = it->ctx;
+    (*count) += it->count;
+
+    test_assert(it->event == EcsOnSet);
+    test_assert(it->event_id == ecs_field_id(it, 0));
+
+    Position *p = ecs_field(it, Position, 0);
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        test_int(p[i].x, 10);
+        ecs_add_id(it->world, it->entities[i], 
+            *(ecs_entity_t*)it->callback_ctx);
+    }
+}
+
+void Pipeline_observer_async(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    int32_t invoked = 0;
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = AsyncObserver,
+        .ctx = &invoked,
+        .callback_ctx = &Foo,
+        .async = true
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    test_int(invoked, 0);
+    test_int(ecs_observer_queue_count(world, o), 2);
+
+    ecs_progress(world, 0);
+    test_int(invoked, 2);
+    test_int(ecs_observer_queue_count(world, o), 0);
+    test_assert(ecs_has(world, e1, Foo));
+    test_assert(ecs_has(world, e2, Foo));
+    test_assert(ecs_lookup(world, "flecs.pipeline.AsyncObservers") != 0);
+
+    ecs_progress(world, 0);
+    test_int(invoked, 2);
+
+    ecs_fini(world);
+}
+
+static
+void AsyncSetPosition(ecs_iter_t *it) {
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        ecs_set(it->world, it->entities[i], Position, {10, 20});
+    }
+}
+
+void Pipeline_observer_async_phase(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ Bar }},
+        .callback = AsyncSetPosition
+    });
+
+    int32_t invoked = 0;
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = AsyncObserver,
+        .ctx = &invoked,
+        .callback_ctx = &Foo,
+        .async = true
+    });
+
+    /* Events from OnUpdate run in PostUpdate of the same frame */
+    ecs_entity_t e = ecs_new_w(world, Bar);
+    ecs_progress(world, 0);
+    test_int(invoked, 1);
+    test_assert(ecs_has(world, e, Foo));
+
+    /* Events from OnUpdate run in PreUpdate of the next frame */
+    ecs_set_async_observer_phase(world, EcsPreUpdate);
+    ecs_remove(world, e, Foo);
+    ecs_progress(world, 0);
+    test_int(invoked, 1);
+    test_assert(!ecs_has(world, e, Foo));
+
+    ecs_remove(world, e, Bar);
+    ecs_progress(world, 0);
+    test_int(invoked, 2);
+    test_assert(ecs_has(world, e, Foo));
+
+    ecs_fini(world);
+}
+
+void Pipeline_observer_async_deleted_entity(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    int32_t invoked = 0;
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = AsyncObserver,
+        .ctx = &invoked,
+        .callback_ctx = &Foo,
+        .async = true
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    test_int(ecs_observer_queue_count(world, o), 3);
+
+    /* Events for entities that no longer match are discarded */
+    ecs_delete(world, e1);
+    ecs_remove(world, e2, Position);
+
+    ecs_progress(world, 0);
+    test_int(invoked, 1);
+    test_assert(!ecs_has(world, e2, Foo));
+    test_assert(ecs_has(world, e3, Foo));
+
+    ecs_fini(world);
+}
+
+static
+void AsyncMultiObserver(ecs_iter_t *it) {
+    int32_t *count = it->ctx;
+    (*count) += it->count;
+
+    Position *p = ecs_field(it, Position, 0);
+    Velocity *v = ecs_field(it, Velocity, 1);
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        test_int(p[i].x, 10);
+        test_int(v[i].x, 1);
+    }
+}
+
+void Pipeline_observer_async_multi(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    int32_t invoked = 0;
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }, { ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = AsyncMultiObserver,
+        .ctx = &invoked,
+        .async = true
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+    test_int(ecs_observer_queue_count(world, o), 0);
+    ecs_set(world, e, Velocity, {1, 2});
+    test_int(ecs_observer_queue_count(world, o), 1);
+
+    ecs_progress(world, 0);
+    test_int(invoked, 1);
+    test_int(ecs_observer_queue_count(world, o), 0);
+
+    ecs_fini(world);
+}
+
+void Pipeline_observer_async_on_remove(void) {
+    install_test_abort();
+
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    test_expect_abort();
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnRemove },
+        .callback = AsyncObserver,
+        .async = true
+    });
+}
+
+void Pipeline_observer_async_delete_observer(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    int32_t invoked = 0;
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = AsyncObserver,
+        .ctx = &invoked,
+        .callback_ctx = &Foo,
+        .async = true
+    });
+
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+    test_int(ecs_observer_queue_count(world, o), 1);
+
+    ecs_delete(world, o);
+
+    ecs_progress(world, 0);
+    test_int(invoked, 0);
+
+    ecs_fini(world);
+}
@@ -171,6 +171,95 @@ void Rest_query(void) {
     ecs_fini(world);
 }
 
+void Rest_query_binary(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_http_server_t *srv = ecs_rest_server_init(world, NULL);
+    test_assert(srv != NULL);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_entity(world, { .name = "e" });
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+    test_int(0, ecs_http_server_request(srv, "GET",
+        "/query?expr=Position&format=binary", &reply));
+    test_int(reply.code, 200);
+    test_str(reply.content_type, "application/octet-stream");
+
+    ecs_size_t size = ecs_strbuf_written(&reply.body);
+    char *reply_data = ecs_strbuf_get(&reply.body);
+    test_assert(reply_data != NULL);
+    test_int(size, 128);
+    test_assert(!ecs_os_memcmp(reply_data, "FLQR", 4));
+
+    /* Entity id of first result */
+    ecs_entity_t result_e;
+    ecs_os_memcpy(&result_e, reply_data + 64, 8);
+    test_uint(result_e, e);
+
+    /* Component value */
+    Position p;
+    ecs_os_memcpy(&p, reply_data + 104, 8);
+    test_int(p.x, 10);
+    test_int(p.y, 20);
+    ecs_os_free(reply_data);
+
+    ecs_rest_server_fini(srv);
+
+    ecs_fini(world);
+}
+
+void Rest_query_binary_accept_header(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_http_server_t *srv = ecs_rest_server_init(world, 
+        &(ecs_http_server_desc_t){
+            .cache_timeout = 1.0
+        });
+    test_assert(srv != NULL);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_entity(world, { .name = "e" });
+    ecs_set(world, e, Position, {10, 20});
+
+    {
+        const char *req = "GET /query?expr=Position HTTP/1.1\r\n"
+            "Accept: application/octet-stream\r\n\r\n";
+        ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+        test_int(0, ecs_http_server_http_request(srv, req, 0, &reply));
+        test_int(reply.code, 200);
+        test_str(reply.content_type, "application/octet-stream");
+
+        ecs_size_t size = ecs_strbuf_written(&reply.body);
+        char *reply_data = ecs_strbuf_get(&reply.body);
+        test_int(size, 128);
+        test_assert(!ecs_os_memcmp(reply_data, "FLQR", 4));
+        ecs_os_free(reply_data);
+    }
+
+    /* Cached binary reply must not be returned for a JSON request */
+    {
+        ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+        test_int(0, ecs_http_server_request(srv, "GET",
+            "/query?expr=Position", &reply));
+        test_int(reply.code, 200);
+        test_str(reply.content_type, "application/json");
+
+        char *reply_str = ecs_strbuf_get(&reply.body);
+        test_assert(reply_str != NULL);
+        test_str(reply_str,
+            "{\"results\":[{\"name\":\"e\", \"fields\":{\"values\":[0]}}]}");
+        ecs_os_free(reply_str);
+    }
+
+    ecs_rest_server_fini(srv);
+
+    ecs_fini(world);
+}
+
 void Rest_named_query(void) {
     ecs_world_t *world = ecs_init();
 
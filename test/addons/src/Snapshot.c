@@ -0,0 +1,872 @@
+#include <addons.h>
+
+typedef struct Named {
+    char *value;
+} Named;
+
+static ECS_COPY(Named, dst, src, {
+    ecs_os_strset(&dst->value, src->value);
+})
+
+static ECS_MOVE(Named, dst, src, {
+    ecs_os_free(dst->value);
+    dst->value = src->value;
+    src->value = NULL;
+})
+
+static ECS_DTOR(Named, ptr, {
+    ecs_os_free(ptr->value);
+})
+
+void Snapshot_restore_values(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+    ecs_set(world, e2, Velocity, {1, 2});
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_set(world, e1, Position, {11, 21});
+    ecs_set(world, e2, Position, {31, 41});
+    ecs_set(world, e2, Velocity, {3, 4});
+
+    ecs_snapshot_restore(world, s);
+
+    const Position *p = ecs_get(world, e1, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    p = ecs_get(world, e2, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    const Velocity *v = ecs_get(world, e2, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_twice(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_set(world, e, Position, {11, 21});
+    ecs_snapshot_restore(world, s);
+
+    const Position *p = ecs_get(world, e, Position);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_set(world, e, Position, {12, 22});
+    ecs_snapshot_restore(world, s);
+
+    p = ecs_get(world, e, Position);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_skip_unchanged_column(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_set(world, e, Velocity, {1, 2});
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    /* Write without marking the component as modified isn't detected */
+    Position *p = ecs_get_mut(world, e, Position);
+    p->x = 11;
+    ecs_set(world, e, Velocity, {3, 4});
+
+    ecs_snapshot_restore(world, s);
+
+    p = ecs_get_mut(world, e, Position);
+    test_int(p->x, 11);
+    test_int(p->y, 20);
+
+    const Velocity *v = ecs_get(world, e, Velocity);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_query_write(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position), .inout = EcsInOut }}
+    });
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        Position *p = ecs_field(&it, Position, 0);
+        int i;
+        for (i = 0; i < it.count; i ++) {
+            p[i].x ++;
+        }
+    }
+
+    ecs_snapshot_restore(world, s);
+
+    const Position *p = ecs_get(world, e, Position);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_query_fini(q);
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_marks_changed(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position), .inout = EcsIn }},
+        .cache_kind = EcsQueryCacheAuto
+    });
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    test_bool(ecs_query_changed(q), true);
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) { }
+    test_bool(ecs_query_changed(q), false);
+
+    ecs_set(world, e, Position, {11, 21});
+    ecs_snapshot_restore(world, s);
+    test_bool(ecs_query_changed(q), true);
+
+    ecs_query_fini(q);
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_new_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+    ecs_entity_t e3 = ecs_new(world);
+
+    ecs_snapshot_restore(world, s);
+
+    test_assert(ecs_is_alive(world, e1));
+    test_assert(!ecs_is_alive(world, e2));
+    test_assert(!ecs_is_alive(world, e3));
+
+    const Position *p = ecs_get(world, e1, Position);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_deleted_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+    ecs_entity_t e3 = ecs_new(world);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_delete(world, e1);
+    ecs_delete(world, e3);
+
+    /* Recycles id of deleted entity */
+    ecs_entity_t e4 = ecs_insert(world, ecs_value(Position, {50, 60}));
+    test_uint((uint32_t)e4, (uint32_t)e3);
+
+    ecs_snapshot_restore(world, s);
+
+    test_assert(ecs_is_alive(world, e1));
+    test_assert(ecs_is_alive(world, e2));
+    test_assert(ecs_is_alive(world, e3));
+    test_assert(!ecs_is_alive(world, e4));
+    test_assert(ecs_get_table(world, e3) == NULL);
+
+    const Position *p = ecs_get(world, e1, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    p = ecs_get(world, e2, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_added_component(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_set(world, e1, Velocity, {1, 2});
+    ecs_set(world, e1, Position, {11, 21});
+
+    ecs_snapshot_restore(world, s);
+
+    test_assert(!ecs_has(world, e1, Velocity));
+    test_assert(!ecs_has(world, e2, Velocity));
+
+    const Position *p = ecs_get(world, e1, Position);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    p = ecs_get(world, e2, Position);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_removed_component(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_set(world, e, Velocity, {1, 2});
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_remove(world, e, Velocity);
+    ecs_remove(world, e, Position);
+
+    ecs_snapshot_restore(world, s);
+
+    const Position *p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    const Velocity *v = ecs_get(world, e, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_empty_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_snapshot_restore(world, s);
+
+    test_assert(ecs_is_alive(world, e));
+    test_assert(!ecs_has(world, e, Position));
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_deleted_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+    ecs_set(world, child, Position, {10, 20});
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_delete(world, parent);
+    test_assert(!ecs_is_alive(world, child));
+
+    ecs_snapshot_restore(world, s);
+
+    test_assert(ecs_is_alive(world, parent));
+    test_assert(ecs_is_alive(world, child));
+    test_assert(ecs_has_pair(world, child, EcsChildOf, parent));
+    test_uint(ecs_lookup(world, "parent.child"), child);
+
+    const Position *p = ecs_get(world, child, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_instance(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t base = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t base_child = ecs_new_w_pair(world, EcsChildOf, base);
+    ecs_add_id(world, base_child, EcsPrefab);
+    ecs_set(world, base_child, Position, {10, 20});
+
+    ecs_entity_t inst = ecs_new_w_pair(world, EcsIsA, base);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_delete(world, inst);
+
+    ecs_snapshot_restore(world, s);
+
+    test_assert(ecs_is_alive(world, inst));
+    test_assert(ecs_has_pair(world, inst, EcsIsA, base));
+
+    int32_t count = 0;
+    ecs_iter_t it = ecs_children(world, inst);
+    while (ecs_children_next(&it)) {
+        count += it.count;
+    }
+    test_int(count, 1);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_restore_w_hooks(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Named);
+
+    ecs_set_hooks(world, Named, {
+        .ctor = flecs_default_ctor,
+        .copy = ecs_copy(Named),
+        .move = ecs_move(Named),
+        .dtor = ecs_dtor(Named)
+    });
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_set(world, e1, Named, {"foo"});
+    ecs_entity_t e2 = ecs_new(world);
+    ecs_set(world, e2, Named, {"bar"});
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_set(world, e1, Named, {"hello"});
+    ecs_delete(world, e2);
+
+    ecs_snapshot_restore(world, s);
+
+    const Named *n = ecs_get(world, e1, Named);
+    test_assert(n != NULL);
+    test_str(n->value, "foo");
+
+    n = ecs_get(world, e2, Named);
+    test_assert(n != NULL);
+    test_str(n->value, "bar");
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_update(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_set(world, e1, Position, {11, 21});
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Velocity, {1, 2}));
+
+    ecs_snapshot_update(world, s);
+
+    ecs_set(world, e1, Position, {12, 22});
+    ecs_set(world, e2, Velocity, {3, 4});
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {50, 60}));
+
+    ecs_snapshot_restore(world, s);
+
+    test_assert(ecs_is_alive(world, e2));
+    test_assert(!ecs_is_alive(world, e3));
+
+    const Position *p = ecs_get(world, e1, Position);
+    test_int(p->x, 11);
+    test_int(p->y, 21);
+
+    const Velocity *v = ecs_get(world, e2, Velocity);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+void Snapshot_update_w_hooks(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Named);
+
+    ecs_set_hooks(world, Named, {
+        .ctor = flecs_default_ctor,
+        .copy = ecs_copy(Named),
+        .move = ecs_move(Named),
+        .dtor = ecs_dtor(Named)
+    });
+
+    ecs_entity_t e = ecs_new(world);
+    ecs_set(world, e, Named, {"foo"});
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_snapshot_update(world, s);
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(world);
+}
+
+static
+ecs_entity_t delta_component(
+    ecs_world_t *world,
+    const char *name)
+{
+    return ecs_component(world, {
+        .entity = ecs_entity(world, { .name = name, .use_low_id = true }),
+        .type = {
+            .size = ECS_SIZEOF(Position),
+            .alignment = ECS_ALIGNOF(Position)
+        }
+    });
+}
+
+/* Create world for applying deltas. Components are registered in a different
+ * order than in the source world, so that they have different ids. */
+static
+ecs_world_t* delta_world(void) {
+    ecs_world_t *world = ecs_mini();
+    delta_component(world, "Velocity");
+    delta_component(world, "Position");
+    return world;
+}
+
+static
+void delta_apply(
+    ecs_world_t *world,
+    ecs_snapshot_t *s,
+    ecs_world_t *dst)
+{
+    ecs_size_t size = 0;
+    void *data = ecs_snapshot_delta(world, s, &size);
+    test_assert(data != NULL);
+    test_int(ecs_snapshot_apply_delta(dst, data, size), 0);
+    ecs_os_free(data);
+}
+
+static
+const Position* delta_get(
+    ecs_world_t *world,
+    ecs_entity_t e,
+    const char *component)
+{
+    return ecs_get_id(world, e, ecs_lookup(world, component));
+}
+
+void Snapshot_delta_new_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+    ecs_set(world, e2, Velocity, {1, 2});
+
+    ecs_world_t *dst = delta_world();
+    delta_apply(world, s, dst);
+
+    test_assert(ecs_is_alive(dst, e1));
+    test_assert(ecs_is_alive(dst, e2));
+
+    const Position *p = delta_get(dst, e1, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+    test_assert(delta_get(dst, e1, "Velocity") == NULL);
+
+    p = delta_get(dst, e2, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    const Velocity *v = (const Velocity*)delta_get(dst, e2, "Velocity");
+    test_assert(v != NULL);
+    test_int(v->x, 1);
+    test_int(v->y, 2);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_set_value(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    ecs_world_t *dst = delta_world();
+    delta_apply(world, s, dst);
+
+    ecs_set(world, e2, Position, {31, 40});
+    delta_apply(world, s, dst);
+
+    const Position *p = delta_get(dst, e1, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    p = delta_get(dst, e2, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 31);
+    test_int(p->y, 40);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_query_write(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_world_t *dst = delta_world();
+    delta_apply(world, s, dst);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Position), .inout = EcsInOut }}
+    });
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        Position *p = ecs_field(&it, Position, 0);
+        p[0].y ++;
+    }
+
+    delta_apply(world, s, dst);
+
+    const Position *p = delta_get(dst, e, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 21);
+
+    ecs_query_fini(q);
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_no_changes(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_world_t *dst = delta_world();
+    delta_apply(world, s, dst);
+
+    /* Value is written, but does not change */
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_size_t size = 0;
+    void *data = ecs_snapshot_delta(world, s, &size);
+    test_assert(data != NULL);
+
+    /* Header and four empty sections */
+    test_int(size, 9);
+    test_int(ecs_snapshot_apply_delta(dst, data, size), 0);
+    ecs_os_free(data);
+
+    const Position *p = delta_get(dst, e, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_deleted_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    ecs_world_t *dst = delta_world();
+    delta_apply(world, s, dst);
+
+    ecs_delete(world, e1);
+
+    /* Recycles id of e1 */
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {50, 60}));
+    test_assert((uint32_t)e3 == (uint32_t)e1);
+
+    delta_apply(world, s, dst);
+
+    test_assert(!ecs_is_alive(dst, e1));
+    test_assert(ecs_is_alive(dst, e2));
+    test_assert(ecs_is_alive(dst, e3));
+
+    const Position *p = delta_get(dst, e3, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 50);
+    test_int(p->y, 60);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_add_remove_component(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}),
+        ecs_value(Velocity, {1, 2}));
+
+    ecs_world_t *dst = delta_world();
+    delta_apply(world, s, dst);
+
+    ecs_set(world, e1, Velocity, {3, 4});
+    ecs_remove(world, e2, Velocity);
+    ecs_set(world, e2, Position, {31, 41});
+
+    delta_apply(world, s, dst);
+
+    const Velocity *v = (const Velocity*)delta_get(dst, e1, "Velocity");
+    test_assert(v != NULL);
+    test_int(v->x, 3);
+    test_int(v->y, 4);
+
+    test_assert(delta_get(dst, e2, "Velocity") == NULL);
+
+    const Position *p = delta_get(dst, e2, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 31);
+    test_int(p->y, 41);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_tag_and_pair(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    /* Tags are replicated with the delta */
+    ECS_TAG(world, Tag);
+    ECS_TAG(world, Likes);
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new_w_id(world, Tag);
+    ecs_add_pair(world, e1, Likes, e2);
+
+    ecs_world_t *dst = ecs_mini();
+    delta_apply(world, s, dst);
+
+    test_uint(ecs_lookup(dst, "Tag"), Tag);
+    test_uint(ecs_lookup(dst, "Likes"), Likes);
+    test_assert(ecs_has_id(dst, e2, Tag));
+    test_assert(ecs_has_pair(dst, e1, Likes, e2));
+
+    ecs_remove_pair(world, e1, Likes, e2);
+    delta_apply(world, s, dst);
+
+    test_assert(!ecs_has_pair(dst, e1, Likes, e2));
+    test_assert(ecs_is_alive(dst, e1));
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_name(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+
+    ecs_world_t *dst = ecs_mini();
+    delta_apply(world, s, dst);
+
+    test_uint(ecs_lookup(dst, "parent"), parent);
+    test_uint(ecs_lookup(dst, "parent.child"), child);
+    test_assert(ecs_has_pair(dst, child, EcsChildOf, parent));
+
+    ecs_set_name(world, child, "renamed");
+    delta_apply(world, s, dst);
+
+    test_uint(ecs_lookup(dst, "parent.child"), 0);
+    test_uint(ecs_lookup(dst, "parent.renamed"), child);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_replay(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_snapshot_t *s = ecs_snapshot_take(world);
+
+    void *deltas[3];
+    ecs_size_t sizes[3];
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    deltas[0] = ecs_snapshot_delta(world, s, &sizes[0]);
+
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+    ecs_set(world, e1, Position, {11, 21});
+    deltas[1] = ecs_snapshot_delta(world, s, &sizes[1]);
+
+    ecs_delete(world, e1);
+    ecs_set(world, e2, Position, {31, 41});
+    deltas[2] = ecs_snapshot_delta(world, s, &sizes[2]);
+
+    ecs_world_t *dst = delta_world();
+
+    int i;
+    for (i = 0; i < 3; i ++) {
+        test_assert(deltas[i] != NULL);
+        test_int(ecs_snapshot_apply_delta(dst, deltas[i], sizes[i]), 0);
+        ecs_os_free(deltas[i]);
+    }
+
+    test_assert(!ecs_is_alive(dst, e1));
+    test_assert(ecs_is_alive(dst, e2));
+
+    const Position *p = delta_get(dst, e2, "Position");
+    test_assert(p != NULL);
+    test_int(p->x, 31);
+    test_int(p->y, 41);
+
+    ecs_snapshot_free(world, s);
+
+    ecs_fini(dst);
+    ecs_fini(world);
+}
+
+void Snapshot_delta_invalid(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_log_set_level(-4);
+
+    const char data[] = "FLDT\x01\x05";
+    test_assert(ecs_snapshot_apply_delta(world, data, 6) != 0);
+    test_assert(ecs_snapshot_apply_delta(world, "FLBS", 4) != 0);
+
+    ecs_fini(world);
+}
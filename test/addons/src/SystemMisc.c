@@ -1797,3 +1797,259 @@ void SystemMisc_register_run_after_callback_ctx(void) {
     test_int(callback_ctx, 1);
     test_int(run_ctx, 1);
 }
+
+typedef struct {
+    int32_t run_count;
+    int32_t count;
+    int32_t visited[32];
+} SliceCtx;
+
+static
+void SliceCount(ecs_iter_t *it) {
+    SliceCtx *ctx = it->ctx;
+    Position *p = ecs_field(it, Position, 0);
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        ecs_os_ainc(&ctx->count);
+        ecs_os_ainc(&ctx->visited[(int)p[i].x]);
+    }
+}
+
+static
+void SliceRun(ecs_iter_t *it) {
+    SliceCtx *ctx = it->ctx;
+    ctx->run_count ++;
+    while (ecs_iter_next(it)) {
+        SliceCount(it);
+    }
+}
+
+void SystemMisc_time_sliced_system(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    SliceCtx ctx = {0};
+    ecs_entity_t s = ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = SliceCount,
+        .ctx = &ctx,
+        .time_slices = 4
+    });
+    test_assert(s != 0);
+
+    int i;
+    for (i = 0; i < 10; i ++) {
+        ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_progress(world, 0);
+    test_int(ctx.count, 3);
+    ecs_progress(world, 0);
+    test_int(ctx.count, 6);
+    ecs_progress(world, 0);
+    test_int(ctx.count, 9);
+    ecs_progress(world, 0);
+    test_int(ctx.count, 10);
+
+    for (i = 0; i < 10; i ++) {
+        test_int(ctx.visited[i], 1);
+    }
+
+    /* Next cycle starts from the first entity */
+    ecs_progress(world, 0);
+    test_int(ctx.count, 13);
+    test_int(ctx.visited[0], 2);
+
+    ecs_fini(world);
+}
+
+void SystemMisc_time_sliced_system_multiple_tables(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    SliceCtx ctx = {0};
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = SliceCount,
+        .ctx = &ctx,
+        .time_slices = 3
+    });
+
+    int i;
+    for (i = 0; i < 9; i ++) {
+        ecs_entity_t e = ecs_insert(world, ecs_value(Position, {i, 0}));
+        if (i % 3 == 1) {
+            ecs_add(world, e, TagA);
+        } else if (i % 3 == 2) {
+            ecs_add(world, e, TagB);
+        }
+    }
+
+    ecs_progress(world, 0);
+    test_int(ctx.count, 3);
+    ecs_progress(world, 0);
+    test_int(ctx.count, 6);
+    ecs_progress(world, 0);
+    test_int(ctx.count, 9);
+
+    for (i = 0; i < 9; i ++) {
+        test_int(ctx.visited[i], 1);
+    }
+
+    ecs_fini(world);
+}
+
+void SystemMisc_time_sliced_system_w_run(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    SliceCtx ctx = {0};
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ ecs_id(Position) }},
+        .run = SliceRun,
+        .ctx = &ctx,
+        .time_slices = 2
+    });
+
+    int i;
+    for (i = 0; i < 4; i ++) {
+        ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_progress(world, 0);
+    test_int(ctx.run_count, 1);
+    test_int(ctx.count, 2);
+    ecs_progress(world, 0);
+    test_int(ctx.run_count, 2);
+    test_int(ctx.count, 4);
+
+    for (i = 0; i < 4; i ++) {
+        test_int(ctx.visited[i], 1);
+    }
+
+    ecs_fini(world);
+}
+
+void SystemMisc_time_sliced_system_fewer_entities_than_slices(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    SliceCtx ctx = {0};
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = SliceCount,
+        .ctx = &ctx,
+        .time_slices = 4
+    });
+
+    ecs_insert(world, ecs_value(Position, {0, 0}));
+    ecs_insert(world, ecs_value(Position, {1, 0}));
+
+    ecs_progress(world, 0);
+    test_int(ctx.count, 1);
+    ecs_progress(world, 0);
+    test_int(ctx.count, 2);
+
+    /* Cycle restarts when all entities have been visited */
+    ecs_progress(world, 0);
+    test_int(ctx.count, 3);
+    test_int(ctx.visited[0], 2);
+    test_int(ctx.visited[1], 1);
+
+    ecs_fini(world);
+}
+
+void SystemMisc_time_sliced_system_delete_during_cycle(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    SliceCtx ctx = {0};
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = SliceCount,
+        .ctx = &ctx,
+        .time_slices = 2
+    });
+
+    ecs_entity_t e[4];
+    int i;
+    for (i = 0; i < 4; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_progress(world, 0);
+    test_int(ctx.count, 2);
+
+    ecs_delete(world, e[2]);
+    ecs_delete(world, e[3]);
+
+    /* Slice is past the end of the remaining entities */
+    ecs_progress(world, 0);
+    test_int(ctx.count, 2);
+
+    ecs_progress(world, 0);
+    test_int(ctx.count, 3);
+    test_int(ctx.visited[0], 2);
+
+    ecs_fini(world);
+}
+
+void SystemMisc_time_sliced_system_multi_threaded(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    SliceCtx ctx = {0};
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = SliceCount,
+        .ctx = &ctx,
+        .multi_threaded = true,
+        .time_slices = 3
+    });
+
+    int i;
+    for (i = 0; i < 12; i ++) {
+        ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_set_threads(world, 2);
+
+    ecs_progress(world, 0);
+    test_int(ctx.count, 4);
+    ecs_progress(world, 0);
+    test_int(ctx.count, 8);
+    ecs_progress(world, 0);
+    test_int(ctx.count, 12);
+
+    for (i = 0; i < 12; i ++) {
+        test_int(ctx.visited[i], 1);
+    }
+
+    ecs_fini(world);
+}
@@ -0,0 +1,302 @@
+#include <addons.h>
+
+static
+int32_t count_occurrences(
+    const char *str,
+    const char *needle)
+{
+    int32_t result = 0;
+    const char *ptr = str;
+    while ((ptr = strstr(ptr, needle))) {
+        result ++;
+        ptr ++;
+    }
+    return result;
+}
+
+static
+void Move(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        p[i].x ++;
+    }
+}
+
+static
+void AddVelocity(ecs_iter_t *it) {
+    ecs_id_t velocity = ecs_field_id(it, 1);
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        ecs_add_id(it->world, it->entities[i], velocity);
+    }
+}
+
+static
+void OnVelocity(ecs_iter_t *it) { }
+
+void Timeline_enable(void) {
+    ecs_world_t *world = ecs_init();
+
+    test_bool(ecs_timeline_is_enabled(world), false);
+    ecs_timeline_enable(world, 16);
+    test_bool(ecs_timeline_is_enabled(world), true);
+    ecs_timeline_enable(world, 0);
+    test_bool(ecs_timeline_is_enabled(world), false);
+
+    ecs_fini(world);
+}
+
+void Timeline_to_json_not_enabled(void) {
+    ecs_world_t *world = ecs_init();
+
+    test_assert(ecs_timeline_to_json(world) == NULL);
+
+    ecs_fini(world);
+}
+
+void Timeline_to_json_empty(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_timeline_enable(world, 16);
+
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_str(json,
+        "{\"traceEvents\":["
+        "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,"
+        "\"args\":{\"name\":\"main\"}}"
+        "],\"displayTimeUnit\":\"ns\"}");
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_record_frame(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_timeline_enable(world, 16);
+    ecs_progress(world, 1);
+    ecs_progress(world, 1);
+
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_int(count_occurrences(json,
+        "{\"name\":\"frame\",\"cat\":\"frame\",\"ph\":\"X\""), 2);
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_record_system(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_SYSTEM(world, Move, EcsOnUpdate, Position);
+
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_timeline_enable(world, 16);
+    ecs_progress(world, 1);
+
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_int(count_occurrences(json,
+        "{\"name\":\"Move\",\"cat\":\"system\",\"ph\":\"X\",\"pid\":0,"
+        "\"tid\":0"), 1);
+    char *args = flecs_asprintf("\"args\":{\"entity\":%u}", (uint32_t)Move);
+    test_int(count_occurrences(json, args), 1);
+    ecs_os_free(args);
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_record_merge(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_SYSTEM(world, Move, EcsOnUpdate, Position);
+
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_timeline_enable(world, 64);
+    ecs_progress(world, 1);
+
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_assert(count_occurrences(json,
+        "{\"name\":\"merge\",\"cat\":\"merge\",\"ph\":\"X\"") >= 1);
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_record_observer(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_SYSTEM(world, AddVelocity, EcsOnUpdate, Position, !Velocity);
+    ECS_OBSERVER(world, OnVelocity, EcsOnAdd, Velocity);
+
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_timeline_enable(world, 64);
+    ecs_progress(world, 1);
+
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_int(count_occurrences(json,
+        "{\"name\":\"OnVelocity\",\"cat\":\"observer\",\"ph\":\"X\""), 1);
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_record_multi_threaded(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, {
+            .name = "Move",
+            .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+        }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = Move,
+        .multi_threaded = true
+    });
+
+    int i;
+    for (i = 0; i < 10; i ++) {
+        ecs_insert(world, ecs_value(Position, {10, 20}));
+    }
+
+    ecs_set_threads(world, 2);
+    ecs_timeline_enable(world, 64);
+
+    /* A worker waits on the sync point until it receives the next job, so its
+     * first sync event is completed in the second frame. */
+    ecs_progress(world, 1);
+    ecs_progress(world, 1);
+
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_int(count_occurrences(json,
+        "\"tid\":1,\"args\":{\"name\":\"worker 1\"}"), 1);
+    test_int(count_occurrences(json,
+        "{\"name\":\"Move\",\"cat\":\"system\",\"ph\":\"X\",\"pid\":0,"
+        "\"tid\":0"), 2);
+    test_int(count_occurrences(json,
+        "{\"name\":\"Move\",\"cat\":\"system\",\"ph\":\"X\",\"pid\":0,"
+        "\"tid\":1"), 2);
+    test_int(count_occurrences(json,
+        "{\"name\":\"sync\",\"cat\":\"sync\",\"ph\":\"X\",\"pid\":0,"
+        "\"tid\":0"), 2);
+    test_int(count_occurrences(json,
+        "{\"name\":\"sync\",\"cat\":\"sync\",\"ph\":\"X\",\"pid\":0,"
+        "\"tid\":1"), 1);
+    test_int(count_occurrences(json, "\"slice\":0,\"slice_count\":2"), 4);
+    test_int(count_occurrences(json, "\"slice\":1,\"slice_count\":2"), 3);
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_ring_buffer_wrap(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_timeline_enable(world, 4);
+
+    int i;
+    for (i = 0; i < 10; i ++) {
+        ecs_progress(world, 1);
+    }
+
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_int(count_occurrences(json, "\"ph\":\"X\""), 4);
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_clear(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_timeline_enable(world, 16);
+    ecs_progress(world, 1);
+    ecs_timeline_clear(world);
+    test_bool(ecs_timeline_is_enabled(world), true);
+
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_int(count_occurrences(json, "\"ph\":\"X\""), 0);
+    ecs_os_free(json);
+
+    ecs_progress(world, 1);
+
+    json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_int(count_occurrences(json, "\"ph\":\"X\""), 1);
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_disable_while_recording(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_timeline_enable(world, 16);
+    ecs_frame_begin(world, 1);
+    ecs_timeline_enable(world, 0);
+    ecs_frame_end(world);
+
+    test_bool(ecs_timeline_is_enabled(world), false);
+
+    ecs_frame_begin(world, 1);
+    ecs_timeline_enable(world, 16);
+    ecs_frame_end(world);
+
+    /* Frame was started before recording was enabled */
+    char *json = ecs_timeline_to_json(world);
+    test_assert(json != NULL);
+    test_int(count_occurrences(json, "\"ph\":\"X\""), 0);
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Timeline_to_file(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_timeline_enable(world, 16);
+    ecs_progress(world, 1);
+
+    const char *filename = "timeline_to_file.json";
+    test_int(ecs_timeline_to_file(world, filename), 0);
+
+    FILE *file;
+    ecs_os_fopen(&file, filename, "r");
+    test_assert(file != NULL);
+
+    char buf[32] = {0};
+    test_assert(fread(buf, 1, 15, file) == 15);
+    fclose(file);
+    remove(filename);
+
+    test_str(buf, "{\"traceEvents\":");
+
+    ecs_fini(world);
+}
+
+void Timeline_to_file_not_enabled(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_log_set_level(-4);
+    test_int(ecs_timeline_to_file(world, "timeline_not_enabled.json"), -1);
+
+    ecs_fini(world);
+}
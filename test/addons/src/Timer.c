@@ -756,3 +756,98 @@ void Timer_randomize_timers(void) {
 
     ecs_fini(world);
 }
+
+void Timer_rate_filter_staggered(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t f[4];
+    int i;
+    for (i = 0; i < 4; i ++) {
+        f[i] = ecs_set_rate_staggered(world, 0, 4, 0);
+        test_assert(f[i] != 0);
+    }
+
+    /* Each filter should tick on a different frame */
+    int frame;
+    for (frame = 0; frame < 8; frame ++) {
+        ecs_progress(world, 1.0);
+
+        int ticked = 0;
+        for (i = 0; i < 4; i ++) {
+            const EcsTickSource *t = ecs_get(world, f[i], EcsTickSource);
+            test_assert(t != NULL);
+            ticked += t->tick;
+        }
+        test_int(ticked, 1);
+    }
+
+    ecs_fini(world);
+}
+
+void Timer_rate_filter_staggered_w_src(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t src = ecs_set_rate(world, 0, 2, 0);
+    ecs_entity_t f_a = ecs_set_rate_staggered(world, 0, 2, src);
+    ecs_entity_t f_b = ecs_set_rate_staggered(world, 0, 2, src);
+    ecs_entity_t f_c = ecs_set_rate_staggered(world, 0, 2, 0);
+
+    {
+        const EcsRateFilter *a = ecs_get(world, f_a, EcsRateFilter);
+        const EcsRateFilter *b = ecs_get(world, f_b, EcsRateFilter);
+        const EcsRateFilter *c = ecs_get(world, f_c, EcsRateFilter);
+        test_int(a->tick_count, 0);
+        test_int(b->tick_count, 1);
+
+        /* Different source than f_a and f_b, only src shares the phase */
+        test_int(c->tick_count, 1);
+    }
+
+    ecs_fini(world);
+}
+
+static
+void CountInvoked(ecs_iter_t *it) {
+    Probe *ctx = it->ctx;
+    ctx->invoked ++;
+}
+
+void Timer_system_rate_staggered(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_new_w(world, Position);
+
+    Probe ctx_a = {0}, ctx_b = {0}, ctx_c = {0};
+
+    ecs_entity_t sys[3];
+    Probe *ctx[3] = {&ctx_a, &ctx_b, &ctx_c};
+    int i;
+    for (i = 0; i < 3; i ++) {
+        sys[i] = ecs_system(world, {
+            .entity = ecs_entity(world, {
+                .add = ecs_ids(ecs_dependson(EcsOnUpdate))
+            }),
+            .query.terms = {{ ecs_id(Position) }},
+            .callback = CountInvoked,
+            .ctx = ctx[i],
+            .rate = 3,
+            .stagger = true
+        });
+        test_assert(sys[i] != 0);
+    }
+
+    int frame;
+    for (frame = 0; frame < 3; frame ++) {
+        int32_t prev = ctx_a.invoked + ctx_b.invoked + ctx_c.invoked;
+        ecs_progress(world, 1.0);
+        test_int(ctx_a.invoked + ctx_b.invoked + ctx_c.invoked, prev + 1);
+    }
+
+    test_int(ctx_a.invoked, 1);
+    test_int(ctx_b.invoked, 1);
+    test_int(ctx_c.invoked, 1);
+
+    ecs_fini(world);
+}
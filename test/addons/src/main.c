@@ -106,6 +106,21 @@ void Pipeline_pipeline_init_no_system_term(void);
 void Pipeline_disable_component_from_immediate_system(void);
 void Pipeline_run_w_empty_query(void);
 void Pipeline_run_w_0_src_query(void);
+void Pipeline_async_flush_frame_begin(void);
+void Pipeline_async_flush_phase(void);
+void Pipeline_rebuild_disable_system(void);
+void Pipeline_rebuild_disable_system_w_merge(void);
+void Pipeline_rebuild_enable_system(void);
+void Pipeline_rebuild_disable_first_system(void);
+void Pipeline_rebuild_disable_last_system(void);
+void Pipeline_rebuild_stats(void);
+void Pipeline_observer_async(void);
+void Pipeline_observer_async_phase(void);
+void Pipeline_observer_async_deleted_entity(void);
+void Pipeline_observer_async_multi(void);
+void Pipeline_observer_async_delete_observer(void);
+void Pipeline_rebuild_recreate_system_w_different_query(void);
+void Pipeline_observer_async_on_remove(void);
 
 // Testsuite 'SystemMisc'
 void SystemMisc_invalid_not_without_id(void);
@@ -177,6 +192,12 @@ void SystemMisc_register_callback_after_run(void);
 void SystemMisc_register_run_after_callback(void);
 void SystemMisc_register_callback_after_run_ctx(void);
 void SystemMisc_register_run_after_callback_ctx(void);
+void SystemMisc_time_sliced_system(void);
+void SystemMisc_time_sliced_system_multiple_tables(void);
+void SystemMisc_time_sliced_system_w_run(void);
+void SystemMisc_time_sliced_system_fewer_entities_than_slices(void);
+void SystemMisc_time_sliced_system_delete_during_cycle(void);
+void SystemMisc_time_sliced_system_multi_threaded(void);
 
 // Testsuite 'SystemPeriodic'
 void SystemPeriodic_1_type_1_component(void);
@@ -247,6 +268,9 @@ void Timer_naked_tick_entity(void);
 void Timer_stop_timer_w_rate(void);
 void Timer_stop_timer_w_rate_same_src(void);
 void Timer_randomize_timers(void);
+void Timer_rate_filter_staggered(void);
+void Timer_rate_filter_staggered_w_src(void);
+void Timer_system_rate_staggered(void);
 
 // Testsuite 'SystemCascade'
 void SystemCascade_cascade_depth_1(void);
@@ -381,6 +405,11 @@ void MultiThread_bulk_new_in_no_readonly_w_multithread(void);
 void MultiThread_bulk_new_in_no_readonly_w_multithread_2(void);
 void MultiThread_run_first_worker_on_main(void);
 void MultiThread_run_single_thread_on_main(void);
+void MultiThread_table_affinity(void);
+void MultiThread_set_stage_affinity(void);
+void MultiThread_set_stage_numa_node(void);
+void MultiThread_set_stage_numa_node_invalid(void);
+void MultiThread_observer_async(void);
 
 // Testsuite 'MultiThreadStaging'
 void MultiThreadStaging_setup(void);
@@ -437,6 +466,7 @@ void Http_teardown(void);
 void Http_teardown_started(void);
 void Http_teardown_stopped(void);
 void Http_stop_start(void);
+void Http_cached_reply_content_type(void);
 
 // Testsuite 'Rest'
 void Rest_teardown(void);
@@ -456,6 +486,8 @@ void Rest_script_error(void);
 void Rest_import_rest_after_mini(void);
 void Rest_get_pipeline_stats_after_delete_system(void);
 void Rest_request_world_summary_before_monitor_sys_run(void);
+void Rest_query_binary(void);
+void Rest_query_binary_accept_header(void);
 
 // Testsuite 'Metrics'
 void Metrics_member_gauge_1_entity(void);
@@ -534,6 +566,74 @@ void Alerts_member_range_from_var_after_remove(void);
 void Alerts_retained_alert_w_dead_source(void);
 void Alerts_alert_counts(void);
 
+// Testsuite 'Timeline'
+void Timeline_enable(void);
+void Timeline_to_json_not_enabled(void);
+void Timeline_to_json_empty(void);
+void Timeline_record_frame(void);
+void Timeline_record_system(void);
+void Timeline_record_merge(void);
+void Timeline_record_observer(void);
+void Timeline_record_multi_threaded(void);
+void Timeline_ring_buffer_wrap(void);
+void Timeline_clear(void);
+void Timeline_disable_while_recording(void);
+void Timeline_to_file(void);
+void Timeline_to_file_not_enabled(void);
+
+// Testsuite 'Binary'
+void Binary_empty_world(void);
+void Binary_component(void);
+void Binary_component_no_reflection(void);
+void Binary_tag(void);
+void Binary_string_member(void);
+void Binary_vector_member(void);
+void Binary_entity_member(void);
+void Binary_named_hierarchy(void);
+void Binary_existing_named_entity(void);
+void Binary_load_twice(void);
+void Binary_prefab_instance(void);
+void Binary_sparse_component(void);
+void Binary_union_relationship(void);
+void Binary_file(void);
+void Binary_invalid_magic(void);
+void Binary_truncated(void);
+void Binary_component_size_mismatch(void);
+void Binary_iter_to_binary(void);
+void Binary_iter_to_binary_shared_field(void);
+void Binary_iter_to_binary_tag_and_optional(void);
+void Binary_iter_to_binary_string_member(void);
+void Binary_opaque_span(void);
+void Binary_vector_member_invalid_count(void);
+void Binary_named_hierarchy_parent_cycle(void);
+
+// Testsuite 'Snapshot'
+void Snapshot_restore_values(void);
+void Snapshot_restore_twice(void);
+void Snapshot_restore_skip_unchanged_column(void);
+void Snapshot_restore_query_write(void);
+void Snapshot_restore_marks_changed(void);
+void Snapshot_restore_new_entity(void);
+void Snapshot_restore_deleted_entity(void);
+void Snapshot_restore_added_component(void);
+void Snapshot_restore_removed_component(void);
+void Snapshot_restore_empty_entity(void);
+void Snapshot_restore_deleted_parent(void);
+void Snapshot_restore_instance(void);
+void Snapshot_restore_w_hooks(void);
+void Snapshot_update(void);
+void Snapshot_update_w_hooks(void);
+void Snapshot_delta_new_entity(void);
+void Snapshot_delta_set_value(void);
+void Snapshot_delta_query_write(void);
+void Snapshot_delta_no_changes(void);
+void Snapshot_delta_deleted_entity(void);
+void Snapshot_delta_add_remove_component(void);
+void Snapshot_delta_tag_and_pair(void);
+void Snapshot_delta_name(void);
+void Snapshot_delta_replay(void);
+void Snapshot_delta_invalid(void);
+
 bake_test_case Doc_testcases[] = {
     {
         "get_set_name",
@@ -917,6 +1017,66 @@ bake_test_case Pipeline_testcases[] = {
     {
         "run_w_0_src_query",
         Pipeline_run_w_0_src_query
+    },
+    {
+        "async_flush_frame_begin",
+        Pipeline_async_flush_frame_begin
+    },
+    {
+        "async_flush_phase",
+        Pipeline_async_flush_phase
+    },
+    {
+        "rebuild_disable_system",
+        Pipeline_rebuild_disable_system
+    },
+    {
+        "rebuild_disable_system_w_merge",
+        Pipeline_rebuild_disable_system_w_merge
+    },
+    {
+        "rebuild_enable_system",
+        Pipeline_rebuild_enable_system
+    },
+    {
+        "rebuild_disable_first_system",
+        Pipeline_rebuild_disable_first_system
+    },
+    {
+        "rebuild_disable_last_system",
+        Pipeline_rebuild_disable_last_system
+    },
+    {
+        "rebuild_stats",
+        Pipeline_rebuild_stats
+    },
+    {
+        "observer_async",
+        Pipeline_observer_async
+    },
+    {
+        "observer_async_phase",
+        Pipeline_observer_async_phase
+    },
+    {
+        "observer_async_deleted_entity",
+        Pipeline_observer_async_deleted_entity
+    },
+    {
+        "observer_async_multi",
+        Pipeline_observer_async_multi
+    },
+    {
+        "observer_async_delete_observer",
+        Pipeline_observer_async_delete_observer
+    },
+    {
+        "rebuild_recreate_system_w_different_query",
+        Pipeline_rebuild_recreate_system_w_different_query
+    },
+    {
+        "observer_async_on_remove",
+        Pipeline_observer_async_on_remove
     }
 };
 
@@ -1196,6 +1356,30 @@ bake_test_case SystemMisc_testcases[] = {
     {
         "register_run_after_callback_ctx",
         SystemMisc_register_run_after_callback_ctx
+    },
+    {
+        "time_sliced_system",
+        SystemMisc_time_sliced_system
+    },
+    {
+        "time_sliced_system_multiple_tables",
+        SystemMisc_time_sliced_system_multiple_tables
+    },
+    {
+        "time_sliced_system_w_run",
+        SystemMisc_time_sliced_system_w_run
+    },
+    {
+        "time_sliced_system_fewer_entities_than_slices",
+        SystemMisc_time_sliced_system_fewer_entities_than_slices
+    },
+    {
+        "time_sliced_system_delete_during_cycle",
+        SystemMisc_time_sliced_system_delete_during_cycle
+    },
+    {
+        "time_sliced_system_multi_threaded",
+        SystemMisc_time_sliced_system_multi_threaded
     }
 };
 
@@ -1466,6 +1650,18 @@ bake_test_case Timer_testcases[] = {
     {
         "randomize_timers",
         Timer_randomize_timers
+    },
+    {
+        "rate_filter_staggered",
+        Timer_rate_filter_staggered
+    },
+    {
+        "rate_filter_staggered_w_src",
+        Timer_rate_filter_staggered_w_src
+    },
+    {
+        "system_rate_staggered",
+        Timer_system_rate_staggered
     }
 };
 
@@ -1936,6 +2132,26 @@ bake_test_case MultiThread_testcases[] = {
     {
         "run_single_thread_on_main",
         MultiThread_run_single_thread_on_main
+    },
+    {
+        "table_affinity",
+        MultiThread_table_affinity
+    },
+    {
+        "set_stage_affinity",
+        MultiThread_set_stage_affinity
+    },
+    {
+        "set_stage_numa_node",
+        MultiThread_set_stage_numa_node
+    },
+    {
+        "set_stage_numa_node_invalid",
+        MultiThread_set_stage_numa_node_invalid
+    },
+    {
+        "observer_async",
+        MultiThread_observer_async
     }
 };
 
@@ -2132,6 +2348,10 @@ bake_test_case Http_testcases[] = {
     {
         "stop_start",
         Http_stop_start
+    },
+    {
+        "cached_reply_content_type",
+        Http_cached_reply_content_type
     }
 };
 
@@ -2203,6 +2423,14 @@ bake_test_case Rest_testcases[] = {
     {
         "request_world_summary_before_monitor_sys_run",
         Rest_request_world_summary_before_monitor_sys_run
+    },
+    {
+        "query_binary",
+        Rest_query_binary
+    },
+    {
+        "query_binary_accept_header",
+        Rest_query_binary_accept_header
     }
 };
 
@@ -2504,6 +2732,263 @@ bake_test_case Alerts_testcases[] = {
     }
 };
 
+bake_test_case Timeline_testcases[] = {
+    {
+        "enable",
+        Timeline_enable
+    },
+    {
+        "to_json_not_enabled",
+        Timeline_to_json_not_enabled
+    },
+    {
+        "to_json_empty",
+        Timeline_to_json_empty
+    },
+    {
+        "record_frame",
+        Timeline_record_frame
+    },
+    {
+        "record_system",
+        Timeline_record_system
+    },
+    {
+        "record_merge",
+        Timeline_record_merge
+    },
+    {
+        "record_observer",
+        Timeline_record_observer
+    },
+    {
+        "record_multi_threaded",
+        Timeline_record_multi_threaded
+    },
+    {
+        "ring_buffer_wrap",
+        Timeline_ring_buffer_wrap
+    },
+    {
+        "clear",
+        Timeline_clear
+    },
+    {
+        "disable_while_recording",
+        Timeline_disable_while_recording
+    },
+    {
+        "to_file",
+        Timeline_to_file
+    },
+    {
+        "to_file_not_enabled",
+        Timeline_to_file_not_enabled
+    }
+};
+
+bake_test_case Binary_testcases[] = {
+    {
+        "empty_world",
+        Binary_empty_world
+    },
+    {
+        "component",
+        Binary_component
+    },
+    {
+        "component_no_reflection",
+        Binary_component_no_reflection
+    },
+    {
+        "tag",
+        Binary_tag
+    },
+    {
+        "string_member",
+        Binary_string_member
+    },
+    {
+        "vector_member",
+        Binary_vector_member
+    },
+    {
+        "entity_member",
+        Binary_entity_member
+    },
+    {
+        "named_hierarchy",
+        Binary_named_hierarchy
+    },
+    {
+        "existing_named_entity",
+        Binary_existing_named_entity
+    },
+    {
+        "load_twice",
+        Binary_load_twice
+    },
+    {
+        "prefab_instance",
+        Binary_prefab_instance
+    },
+    {
+        "sparse_component",
+        Binary_sparse_component
+    },
+    {
+        "union_relationship",
+        Binary_union_relationship
+    },
+    {
+        "file",
+        Binary_file
+    },
+    {
+        "invalid_magic",
+        Binary_invalid_magic
+    },
+    {
+        "truncated",
+        Binary_truncated
+    },
+    {
+        "component_size_mismatch",
+        Binary_component_size_mismatch
+    },
+    {
+        "iter_to_binary",
+        Binary_iter_to_binary
+    },
+    {
+        "iter_to_binary_shared_field",
+        Binary_iter_to_binary_shared_field
+    },
+    {
+        "iter_to_binary_tag_and_optional",
+        Binary_iter_to_binary_tag_and_optional
+    },
+    {
+        "iter_to_binary_string_member",
+        Binary_iter_to_binary_string_member
+    },
+    {
+        "opaque_span",
+        Binary_opaque_span
+    },
+    {
+        "vector_member_invalid_count",
+        Binary_vector_member_invalid_count
+    },
+    {
+        "named_hierarchy_parent_cycle",
+        Binary_named_hierarchy_parent_cycle
+    }
+};
+
+bake_test_case Snapshot_testcases[] = {
+    {
+        "restore_values",
+        Snapshot_restore_values
+    },
+    {
+        "restore_twice",
+        Snapshot_restore_twice
+    },
+    {
+        "restore_skip_unchanged_column",
+        Snapshot_restore_skip_unchanged_column
+    },
+    {
+        "restore_query_write",
+        Snapshot_restore_query_write
+    },
+    {
+        "restore_marks_changed",
+        Snapshot_restore_marks_changed
+    },
+    {
+        "restore_new_entity",
+        Snapshot_restore_new_entity
+    },
+    {
+        "restore_deleted_entity",
+        Snapshot_restore_deleted_entity
+    },
+    {
+        "restore_added_component",
+        Snapshot_restore_added_component
+    },
+    {
+        "restore_removed_component",
+        Snapshot_restore_removed_component
+    },
+    {
+        "restore_empty_entity",
+        Snapshot_restore_empty_entity
+    },
+    {
+        "restore_deleted_parent",
+        Snapshot_restore_deleted_parent
+    },
+    {
+        "restore_instance",
+        Snapshot_restore_instance
+    },
+    {
+        "restore_w_hooks",
+        Snapshot_restore_w_hooks
+    },
+    {
+        "update",
+        Snapshot_update
+    },
+    {
+        "update_w_hooks",
+        Snapshot_update_w_hooks
+    },
+    {
+        "delta_new_entity",
+        Snapshot_delta_new_entity
+    },
+    {
+        "delta_set_value",
+        Snapshot_delta_set_value
+    },
+    {
+        "delta_query_write",
+        Snapshot_delta_query_write
+    },
+    {
+        "delta_no_changes",
+        Snapshot_delta_no_changes
+    },
+    {
+        "delta_deleted_entity",
+        Snapshot_delta_deleted_entity
+    },
+    {
+        "delta_add_remove_component",
+        Snapshot_delta_add_remove_component
+    },
+    {
+        "delta_tag_and_pair",
+        Snapshot_delta_tag_and_pair
+    },
+    {
+        "delta_name",
+        Snapshot_delta_name
+    },
+    {
+        "delta_replay",
+        Snapshot_delta_replay
+    },
+    {
+        "delta_invalid",
+        Snapshot_delta_invalid
+    }
+};
+
 const char* MultiThread_worker_kind_param[] = {"thread", "task"};
 bake_test_param MultiThread_params[] = {
     {"worker_kind", (char**)MultiThread_worker_kind_param, 2}
@@ -2525,14 +3010,14 @@ static bake_test_suite suites[] = {
         "Pipeline",
         NULL,
         NULL,
-        85,
+        100,
         Pipeline_testcases
     },
     {
         "SystemMisc",
         NULL,
         NULL,
-        69,
+        75,
         SystemMisc_testcases
     },
     {
@@ -2546,7 +3031,7 @@ static bake_test_suite suites[] = {
         "Timer",
         NULL,
         NULL,
-        19,
+        22,
         Timer_testcases
     },
     {
@@ -2616,7 +3101,7 @@ static bake_test_suite suites[] = {
         "MultiThread",
         MultiThread_setup,
         NULL,
-        50,
+        55,
         MultiThread_testcases,
         1,
         MultiThread_params
@@ -2648,14 +3133,14 @@ static bake_test_suite suites[] = {
         "Http",
         NULL,
         NULL,
-        4,
+        5,
         Http_testcases
     },
     {
         "Rest",
         NULL,
         NULL,
-        17,
+        19,
         Rest_testcases
     },
     {
@@ -2671,9 +3156,30 @@ static bake_test_suite suites[] = {
         NULL,
         36,
         Alerts_testcases
+    },
+    {
+        "Timeline",
+        NULL,
+        NULL,
+        13,
+        Timeline_testcases
+    },
+    {
+        "Binary",
+        NULL,
+        NULL,
+        24,
+        Binary_testcases
+    },
+    {
+        "Snapshot",
+        NULL,
+        NULL,
+        25,
+        Snapshot_testcases
     }
 };
 
 int main(int argc, char *argv[]) {
-    return bake_test_run("addons", argc, argv, suites, 22);
+    return bake_test_run("addons", argc, argv, suites, 25);
 }
@@ -529,3 +529,121 @@ void Strbuf_append_inf_delim(void) {
         ecs_os_free(str);
     }
 }
+
+typedef struct {
+    ecs_strbuf_t out;
+    int32_t flush_count;
+    ecs_size_t max_length;
+    int32_t fail_after;
+} flush_ctx_t;
+
+static
+int flush_to_buf(
+    const char *data,
+    ecs_size_t length,
+    void *ptr)
+{
+    flush_ctx_t *ctx = ptr;
+    ctx->flush_count ++;
+    if (length > ctx->max_length) {
+        ctx->max_length = length;
+    }
+    if (ctx->fail_after && ctx->flush_count > ctx->fail_after) {
+        return -1;
+    }
+    ecs_strbuf_appendstrn(&ctx->out, data, length);
+    return 0;
+}
+
+void Strbuf_flush_action(void) {
+    flush_ctx_t ctx = { .out = ECS_STRBUF_INIT };
+
+    ecs_strbuf_t b = ECS_STRBUF_INIT;
+    b.flush_action = flush_to_buf;
+    b.flush_ctx = &ctx;
+
+    ecs_strbuf_t expect = ECS_STRBUF_INIT;
+
+    int i;
+    for (i = 0; i < 100000; i ++) {
+        ecs_strbuf_append(&b, "Foo %d,", i);
+        ecs_strbuf_appendstr(&b, "Bar");
+        ecs_strbuf_append(&expect, "Foo %d,", i);
+        ecs_strbuf_appendstr(&expect, "Bar");
+    }
+
+    test_assert(ctx.flush_count > 1);
+    test_assert(ctx.max_length <= ECS_STRBUF_FLUSH_SIZE);
+    test_int(ecs_strbuf_flush(&b), 0);
+
+    char *str = ecs_strbuf_get(&ctx.out);
+    char *expect_str = ecs_strbuf_get(&expect);
+    test_str(str, expect_str);
+    ecs_os_free(str);
+    ecs_os_free(expect_str);
+}
+
+void Strbuf_flush_action_large_append(void) {
+    flush_ctx_t ctx = { .out = ECS_STRBUF_INIT };
+
+    ecs_strbuf_t b = ECS_STRBUF_INIT;
+    b.flush_action = flush_to_buf;
+    b.flush_ctx = &ctx;
+
+    ecs_size_t large_size = ECS_STRBUF_FLUSH_SIZE * 3;
+    char *large = ecs_os_malloc(large_size + 1);
+    ecs_os_memset(large, 'a', large_size);
+    large[large_size] = '\0';
+
+    ecs_strbuf_appendstr(&b, "Foo");
+    ecs_strbuf_appendstr(&b, large);
+    ecs_strbuf_appendstr(&b, "Bar");
+    test_int(ecs_strbuf_flush(&b), 0);
+
+    test_int(ecs_strbuf_written(&ctx.out), large_size + 6);
+    char *str = ecs_strbuf_get(&ctx.out);
+    test_assert(!ecs_os_strncmp(str, "Fooaaa", 6));
+    test_str(&str[large_size + 3], "Bar");
+    ecs_os_free(str);
+    ecs_os_free(large);
+}
+
+void Strbuf_flush_action_error(void) {
+    flush_ctx_t ctx = { .out = ECS_STRBUF_INIT, .fail_after = 1 };
+
+    ecs_strbuf_t b = ECS_STRBUF_INIT;
+    b.flush_action = flush_to_buf;
+    b.flush_ctx = &ctx;
+
+    int i;
+    for (i = 0; i < 100000; i ++) {
+        ecs_strbuf_append(&b, "Foo %d,", i);
+    }
+
+    test_int(ctx.flush_count, 2);
+    test_int(ecs_strbuf_flush(&b), -1);
+    test_int(ctx.flush_count, 2);
+
+    ecs_strbuf_reset(&ctx.out);
+}
+
+void Strbuf_flush_action_reset(void) {
+    flush_ctx_t ctx = { .out = ECS_STRBUF_INIT };
+
+    ecs_strbuf_t b = ECS_STRBUF_INIT;
+    b.flush_action = flush_to_buf;
+    b.flush_ctx = &ctx;
+
+    ecs_strbuf_appendstr(&b, "Foo");
+    ecs_strbuf_reset(&b);
+    test_assert(b.flush_action == flush_to_buf);
+    test_assert(b.flush_ctx == &ctx);
+
+    ecs_strbuf_appendstr(&b, "Bar");
+    test_int(ecs_strbuf_flush(&b), 0);
+    test_int(ctx.flush_count, 1);
+
+    char *str = ecs_strbuf_get(&ctx.out);
+    test_str(str, "Bar");
+    ecs_os_free(str);
+}
@@ -102,6 +102,10 @@ void Strbuf_append_nan(void);
 void Strbuf_append_inf(void);
 void Strbuf_append_nan_delim(void);
 void Strbuf_append_inf_delim(void);
+void Strbuf_flush_action(void);
+void Strbuf_flush_action_large_append(void);
+void Strbuf_flush_action_error(void);
+void Strbuf_flush_action_reset(void);
 
 // Testsuite 'Allocator'
 void Allocator_setup(void);
@@ -457,6 +461,22 @@ bake_test_case Strbuf_testcases[] = {
     {
         "append_inf_delim",
         Strbuf_append_inf_delim
+    },
+    {
+        "flush_action",
+        Strbuf_flush_action
+    },
+    {
+        "flush_action_large_append",
+        Strbuf_flush_action_large_append
+    },
+    {
+        "flush_action_error",
+        Strbuf_flush_action_error
+    },
+    {
+        "flush_action_reset",
+        Strbuf_flush_action_reset
     }
 };
 
@@ -487,7 +507,7 @@ static bake_test_suite suites[] = {
         "Strbuf",
         Strbuf_setup,
         NULL,
-        35,
+        39,
         Strbuf_testcases
     },
     {
@@ -4149,3 +4149,292 @@ void Commands_defer_emplace_after_remove(void) {
 
     ecs_fini(world);
 }
+
+void Commands_async_add(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_add(world, e, Foo);
+    test_assert(!ecs_has(world, e, Foo));
+
+    test_int(ecs_async_flush(world), 1);
+    test_assert(ecs_has(world, e, Foo));
+
+    ecs_fini(world);
+}
+
+void Commands_async_remove(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+
+    ecs_async_remove(world, e, Foo);
+    test_assert(ecs_has(world, e, Foo));
+
+    test_int(ecs_async_flush(world), 1);
+    test_assert(!ecs_has(world, e, Foo));
+
+    ecs_fini(world);
+}
+
+void Commands_async_set(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_set(world, e, Position, {10, 20});
+    test_assert(!ecs_has(world, e, Position));
+
+    test_int(ecs_async_flush(world), 1);
+    
+    const Position *p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_fini(world);
+}
+
+void Commands_async_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_delete(world, e);
+    test_assert(ecs_is_alive(world, e));
+
+    test_int(ecs_async_flush(world), 1);
+    test_assert(!ecs_is_alive(world, e));
+
+    ecs_fini(world);
+}
+
+static
+void Commands_on_event(ecs_iter_t *it) {
+    Probe *ctx = it->ctx;
+    probe_iter(it);
+
+    if (it->param) {
+        ctx->param = it->param;
+        test_int(((Position*)it->param)->x, 10);
+        test_int(((Position*)it->param)->y, 20);
+    }
+}
+
+void Commands_async_enqueue(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ Foo }},
+        .events = { ecs_id(Position) },
+        .callback = Commands_on_event,
+        .ctx = &ctx
+    });
+
+    ecs_async_enqueue(world, &(ecs_event_desc_t) {
+        .event = ecs_id(Position),
+        .entity = e,
+        .ids = &(ecs_type_t){ .array = (ecs_id_t[]){ Foo }, .count = 1 },
+        .const_param = &(Position){10, 20}
+    }, ECS_SIZEOF(Position));
+    test_int(ctx.invoked, 0);
+
+    test_int(ecs_async_flush(world), 1);
+    test_int(ctx.invoked, 1);
+    test_assert(ctx.param != NULL);
+    test_uint(ctx.e[0], e);
+
+    ecs_fini(world);
+}
+
+void Commands_async_flush_order(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_add(world, e, Foo);
+    ecs_async_remove(world, e, Foo);
+    ecs_async_add(world, e, Foo);
+    test_int(ecs_async_flush(world), 3);
+    test_assert(ecs_has(world, e, Foo));
+
+    ecs_async_remove(world, e, Foo);
+    ecs_async_add(world, e, Foo);
+    ecs_async_remove(world, e, Foo);
+    test_int(ecs_async_flush(world), 3);
+    test_assert(!ecs_has(world, e, Foo));
+
+    ecs_fini(world);
+}
+
+void Commands_async_flush_deferred(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_add(world, e, Foo);
+
+    ecs_defer_begin(world);
+    test_int(ecs_async_flush(world), 1);
+    test_assert(!ecs_has(world, e, Foo));
+    ecs_defer_end(world);
+
+    test_assert(ecs_has(world, e, Foo));
+
+    ecs_fini(world);
+}
+
+void Commands_async_flush_empty(void) {
+    ecs_world_t *world = ecs_mini();
+
+    test_int(ecs_async_flush(world), 0);
+
+    ecs_fini(world);
+}
+
+void Commands_async_not_alive(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_add(world, e, Foo);
+    ecs_delete(world, e);
+
+    test_int(ecs_async_flush(world), 1);
+    test_assert(!ecs_is_alive(world, e));
+
+    ecs_fini(world);
+}
+
+void Commands_async_flush_frame_begin(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_add(world, e, Foo);
+    test_assert(!ecs_has(world, e, Foo));
+
+    ecs_frame_begin(world, 1);
+    test_assert(ecs_has(world, e, Foo));
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+void Commands_async_fini_w_queued(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_new(world);
+    ecs_async_set(world, e, Position, {10, 20});
+
+    ecs_fini(world);
+
+    /* Queued commands must be freed without leaking */
+    test_assert(true);
+}
+
+#define ASYNC_THREAD_COUNT (4)
+#define ASYNC_CMD_COUNT (1000)
+
+typedef struct {
+    ecs_world_t *world;
+    ecs_entity_t *entities;
+    ecs_entity_t component;
+} async_thread_ctx_t;
+
+static
+void* Commands_async_thread(void *arg) {
+    async_thread_ctx_t *ctx = arg;
+    int32_t i;
+    for (i = 0; i < ASYNC_CMD_COUNT; i ++) {
+        Position p = {i, i * 2};
+        ecs_async_set_id(ctx->world, ctx->entities[i], ctx->component, 
+            sizeof(Position), &p);
+    }
+    return NULL;
+}
+
+void Commands_async_multi_thread(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t entities[ASYNC_THREAD_COUNT][ASYNC_CMD_COUNT];
+    async_thread_ctx_t ctx[ASYNC_THREAD_COUNT];
+    ecs_os_thread_t threads[ASYNC_THREAD_COUNT];
+
+    int32_t i, t;
+    for (t = 0; t < ASYNC_THREAD_COUNT; t ++) {
+        for (i = 0; i < ASYNC_CMD_COUNT; i ++) {
+            entities[t][i] = ecs_new(world);
+        }
+        ctx[t].world = world;
+        ctx[t].entities = entities[t];
+        ctx[t].component = ecs_id(Position);
+    }
+
+    for (t = 0; t < ASYNC_THREAD_COUNT; t ++) {
+        threads[t] = ecs_os_thread_new(Commands_async_thread, &ctx[t]);
+    }
+
+    /* Flush while threads are still producing */
+    int32_t flushed = ecs_async_flush(world);
+
+    for (t = 0; t < ASYNC_THREAD_COUNT; t ++) {
+        ecs_os_thread_join(threads[t]);
+    }
+
+    flushed += ecs_async_flush(world);
+    test_int(flushed, ASYNC_THREAD_COUNT * ASYNC_CMD_COUNT);
+
+    for (t = 0; t < ASYNC_THREAD_COUNT; t ++) {
+        for (i = 0; i < ASYNC_CMD_COUNT; i ++) {
+            const Position *p = ecs_get(world, entities[t][i], Position);
+            test_assert(p != NULL);
+            test_int(p->x, i);
+            test_int(p->y, i * 2);
+        }
+    }
+
+    ecs_fini(world);
+}
+
+void Commands_async_invalid_id(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_add_id(world, e, 0);
+    ecs_async_add(world, e, Foo);
+
+    ecs_log_set_level(-4);
+    test_int(ecs_async_flush(world), 1);
+    test_assert(ecs_has(world, e, Foo));
+
+    ecs_fini(world);
+}
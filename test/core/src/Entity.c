@@ -1834,6 +1834,115 @@ void Entity_get_depth_2_paths(void) {
     ecs_fini(world);
 }
 
+void Entity_get_depth_after_reparent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, e1);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, e2);
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, e3);
+    ecs_entity_t e5 = ecs_new(world);
+
+    test_int(3, ecs_get_depth(world, e4, EcsChildOf));
+
+    ecs_add_pair(world, e3, EcsChildOf, e5);
+    test_int(1, ecs_get_depth(world, e3, EcsChildOf));
+    test_int(2, ecs_get_depth(world, e4, EcsChildOf));
+
+    ecs_add_pair(world, e5, EcsChildOf, e2);
+    test_int(2, ecs_get_depth(world, e5, EcsChildOf));
+    test_int(3, ecs_get_depth(world, e3, EcsChildOf));
+    test_int(4, ecs_get_depth(world, e4, EcsChildOf));
+
+    ecs_fini(world);
+}
+
+void Entity_get_depth_after_reparent_root(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, e1);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, e2);
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, e3);
+    ecs_entity_t e5 = ecs_new(world);
+
+    test_int(3, ecs_get_depth(world, e4, EcsChildOf));
+
+    ecs_add_pair(world, e1, EcsChildOf, e5);
+    test_int(1, ecs_get_depth(world, e1, EcsChildOf));
+    test_int(4, ecs_get_depth(world, e4, EcsChildOf));
+
+    ecs_remove_pair(world, e1, EcsChildOf, e5);
+    test_int(0, ecs_get_depth(world, e1, EcsChildOf));
+    test_int(3, ecs_get_depth(world, e4, EcsChildOf));
+
+    ecs_remove_pair(world, e3, EcsChildOf, e2);
+    test_int(0, ecs_get_depth(world, e3, EcsChildOf));
+    test_int(1, ecs_get_depth(world, e4, EcsChildOf));
+
+    ecs_fini(world);
+}
+
+void Entity_get_depth_after_add_path(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsIsA, e1);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsIsA, e2);
+    ecs_entity_t e4 = ecs_new(world);
+    ecs_entity_t e5 = ecs_new_w_pair(world, EcsIsA, e4);
+
+    test_int(2, ecs_get_depth(world, e3, EcsIsA));
+    test_int(1, ecs_get_depth(world, e5, EcsIsA));
+
+    ecs_add_pair(world, e4, EcsIsA, e3);
+    test_int(3, ecs_get_depth(world, e4, EcsIsA));
+    test_int(4, ecs_get_depth(world, e5, EcsIsA));
+
+    ecs_remove_pair(world, e4, EcsIsA, e3);
+    test_int(0, ecs_get_depth(world, e4, EcsIsA));
+    test_int(1, ecs_get_depth(world, e5, EcsIsA));
+
+    ecs_fini(world);
+}
+
+void Entity_get_depth_after_delete_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Rel, Acyclic, Traversable, (OnDeleteTarget, Remove));
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Rel, e1);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Rel, e2);
+    ecs_entity_t e4 = ecs_new_w_pair(world, Rel, e3);
+
+    test_int(3, ecs_get_depth(world, e4, Rel));
+
+    ecs_delete(world, e2);
+    test_int(0, ecs_get_depth(world, e3, Rel));
+    test_int(1, ecs_get_depth(world, e4, Rel));
+
+    ecs_fini(world);
+}
+
+void Entity_get_depth_not_traversable(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Rel, Acyclic);
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Rel, e1);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Rel, e2);
+    ecs_entity_t e4 = ecs_new(world);
+
+    test_int(2, ecs_get_depth(world, e3, Rel));
+
+    ecs_add_pair(world, e1, Rel, e4);
+    test_int(3, ecs_get_depth(world, e3, Rel));
+
+    ecs_fini(world);
+}
+
 void Entity_entity_init_w_empty_sep(void) {
     ecs_world_t *world = ecs_mini();
 
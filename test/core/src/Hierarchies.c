@@ -1747,3 +1747,389 @@ void Hierarchies_defer_batch_remove_childof_w_add_name(void) {
 
     ecs_fini(world);
 }
+
+void Hierarchies_ordered_children(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e2, Foo);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e4, Bar);
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 4);
+    test_uint(it.entities[0], e1);
+    test_uint(it.entities[1], e2);
+    test_uint(it.entities[2], e3);
+    test_uint(it.entities[3], e4);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_remove_child(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, parent);
+
+    ecs_remove_pair(world, e2, EcsChildOf, parent);
+    ecs_delete(world, e4);
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 2);
+    test_uint(it.entities[0], e1);
+    test_uint(it.entities[1], e3);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_delete(world, e1);
+    ecs_delete(world, e3);
+
+    it = ecs_children(world, parent);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_reparent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t p1 = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t p2 = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, p1);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, p2);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, p1);
+
+    ecs_add_pair(world, e1, EcsChildOf, p2);
+
+    ecs_iter_t it = ecs_children(world, p1);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 1);
+    test_uint(it.entities[0], e3);
+    test_bool(false, ecs_children_next(&it));
+
+    it = ecs_children(world, p2);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 2);
+    test_uint(it.entities[0], e2);
+    test_uint(it.entities[1], e1);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_add_trait_after_children(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t parent = ecs_new(world);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e2, Foo);
+
+    ecs_add_id(world, parent, EcsOrderedChildren);
+
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e3, Foo);
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, parent);
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 4);
+    test_uint(it.entities[0], e1);
+    test_uint(it.entities[1], e2);
+    test_uint(it.entities[2], e3);
+    test_uint(it.entities[3], e4);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_remove_trait(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e2, Foo);
+
+    ecs_remove_id(world, parent, EcsOrderedChildren);
+
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_delete(world, e1);
+
+    /* Children are returned per table */
+    int32_t count = 0;
+    ecs_iter_t it = ecs_children(world, parent);
+    while (ecs_children_next(&it)) {
+        test_assert(it.table != NULL);
+        int32_t i;
+        for (i = 0; i < it.count; i ++) {
+            test_assert(it.entities[i] == e2 || it.entities[i] == e3);
+        }
+        count += it.count;
+    }
+    test_int(count, 2);
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_set_order(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+
+    ecs_set_child_order(world, parent, (ecs_entity_t[]){ e3, e1, e2 }, 3);
+
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_delete(world, e1);
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 3);
+    test_uint(it.entities[0], e3);
+    test_uint(it.entities[1], e2);
+    test_uint(it.entities[2], e4);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_delete_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e2, Foo);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, e1);
+
+    ecs_add_id(world, e1, EcsOrderedChildren);
+
+    ecs_delete(world, parent);
+
+    test_assert(!ecs_is_alive(world, parent));
+    test_assert(!ecs_is_alive(world, e1));
+    test_assert(!ecs_is_alive(world, e2));
+    test_assert(!ecs_is_alive(world, e3));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_deferred(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+
+    ecs_defer_begin(world);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_set_name(world, e3, "e3");
+    ecs_delete(world, e1);
+    ecs_defer_end(world);
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 2);
+    test_uint(it.entities[0], e2);
+    test_uint(it.entities[1], e3);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_remove_all(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e2, Foo);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+
+    ecs_remove_all(world, Foo);
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 3);
+    test_uint(it.entities[0], e1);
+    test_uint(it.entities[1], e2);
+    test_uint(it.entities[2], e3);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_remove_all(world, ecs_childof(parent));
+
+    it = ecs_children(world, parent);
+    test_bool(false, ecs_children_next(&it));
+    test_assert(!ecs_has_pair(world, e1, EcsChildOf, parent));
+    test_assert(!ecs_has_pair(world, e2, EcsChildOf, parent));
+    test_assert(!ecs_has_pair(world, e3, EcsChildOf, parent));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_delete_with(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e2, Foo);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e4, Foo);
+    ecs_entity_t e5 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e6 = ecs_new_w_id(world, Foo);
+
+    ecs_delete_with(world, Foo);
+
+    test_assert(!ecs_is_alive(world, e2));
+    test_assert(!ecs_is_alive(world, e4));
+    test_assert(!ecs_is_alive(world, e6));
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 3);
+    test_uint(it.entities[0], e1);
+    test_uint(it.entities[1], e3);
+    test_uint(it.entities[2], e5);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_delete_with_childof(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e2, Foo);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+
+    ecs_delete_with(world, ecs_childof(parent));
+
+    test_assert(ecs_is_alive(world, parent));
+    test_assert(!ecs_is_alive(world, e1));
+    test_assert(!ecs_is_alive(world, e2));
+    test_assert(!ecs_is_alive(world, e3));
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e5 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add(world, e5, Foo);
+
+    it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 2);
+    test_uint(it.entities[0], e4);
+    test_uint(it.entities[1], e5);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_delete_relationship_target(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t Rel = ecs_new(world);
+    ecs_add_pair(world, Rel, EcsOnDeleteTarget, EcsDelete);
+
+    ecs_entity_t tgt = ecs_new(world);
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add_pair(world, e2, Rel, tgt);
+    ecs_entity_t e3 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t e4 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add_pair(world, e4, Rel, tgt);
+    ecs_entity_t e5 = ecs_new_w_pair(world, EcsChildOf, parent);
+
+    ecs_delete(world, tgt);
+
+    test_assert(!ecs_is_alive(world, e2));
+    test_assert(!ecs_is_alive(world, e4));
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 3);
+    test_uint(it.entities[0], e1);
+    test_uint(it.entities[1], e3);
+    test_uint(it.entities[2], e5);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
+
+void Hierarchies_ordered_children_delete_child_w_children(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t parent = ecs_new_w_id(world, EcsOrderedChildren);
+    ecs_entity_t p1 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_entity_t p2 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add_id(world, p2, EcsOrderedChildren);
+    ecs_entity_t p3 = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_add_id(world, p3, EcsOrderedChildren);
+
+    int32_t i;
+    for (i = 0; i < 100; i ++) {
+        ecs_entity_t c = ecs_new_w_pair(world, EcsChildOf, p2);
+        if (i % 2) {
+            ecs_add(world, c, Foo);
+        }
+        ecs_new_w_pair(world, EcsChildOf, c);
+    }
+
+    ecs_entity_t c1 = ecs_new_w_pair(world, EcsChildOf, p3);
+    ecs_entity_t c2 = ecs_new_w_pair(world, EcsChildOf, p3);
+
+    ecs_delete(world, p2);
+
+    test_assert(!ecs_is_alive(world, p2));
+
+    ecs_iter_t it = ecs_children(world, parent);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 2);
+    test_uint(it.entities[0], p1);
+    test_uint(it.entities[1], p3);
+    test_bool(false, ecs_children_next(&it));
+
+    it = ecs_children(world, p3);
+    test_bool(true, ecs_children_next(&it));
+    test_int(it.count, 2);
+    test_uint(it.entities[0], c1);
+    test_uint(it.entities[1], c2);
+    test_bool(false, ecs_children_next(&it));
+
+    ecs_fini(world);
+}
@@ -2870,3 +2870,137 @@ void Iter_to_str(void) {
 
     ecs_fini(world);
 }
+
+void Iter_worker_table_iter_1(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Self);
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e1 = ecs_new(world); ecs_set(world, e1, Self, {e1});
+    ecs_entity_t e2 = ecs_new(world); ecs_set(world, e2, Self, {e2});
+    ecs_entity_t e3 = ecs_new(world); ecs_set(world, e3, Self, {e3});
+    ecs_add(world, e3, TagA);
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Self) }}
+    });
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    ecs_iter_t wit = ecs_worker_table_iter(&it, 0, 1);
+
+    test_bool(ecs_worker_next(&wit), true);
+    test_int(wit.count, 2);
+    test_int(wit.entities[0], e1);
+    test_int(wit.entities[1], e2);
+    Self *ptr = ecs_field(&wit, Self, 0);
+    test_int(ptr[0].value, e1);
+    test_int(ptr[1].value, e2);
+
+    test_bool(ecs_worker_next(&wit), true);
+    test_int(wit.count, 1);
+    test_int(wit.entities[0], e3);
+    ptr = ecs_field(&wit, Self, 0);
+    test_int(ptr[0].value, e3);
+
+    test_bool(ecs_worker_next(&wit), false);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Iter_worker_table_iter_4(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Self);
+
+    int i, t, TABLES = 16, PER_TABLE = 3;
+    for (t = 0; t < TABLES; t ++) {
+        ecs_entity_t tag = ecs_new(world);
+        for (i = 0; i < PER_TABLE; i ++) {
+            ecs_entity_t e = ecs_new_w_id(world, tag);
+            ecs_set(world, e, Self, {e});
+        }
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Self) }}
+    });
+
+    ecs_map_t tables;
+    ecs_map_init(&tables, NULL);
+
+    int32_t w, entity_count = 0, table_count = 0;
+    for (w = 0; w < 4; w ++) {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        ecs_iter_t wit = ecs_worker_table_iter(&it, w, 4);
+        while (ecs_worker_next(&wit)) {
+            /* Each table is returned in its entirety to a single worker */
+            test_int(wit.count, PER_TABLE);
+            test_int(wit.offset, 0);
+            test_assert(!ecs_map_get(&tables, (ecs_map_key_t)wit.table));
+            ecs_map_insert(&tables, (ecs_map_key_t)wit.table, 1);
+
+            Self *ptr = ecs_field(&wit, Self, 0);
+            for (i = 0; i < wit.count; i ++) {
+                test_int(ptr[i].value, wit.entities[i]);
+            }
+
+            entity_count += wit.count;
+            table_count ++;
+        }
+    }
+
+    test_int(table_count, TABLES);
+    test_int(entity_count, TABLES * PER_TABLE);
+
+    /* Tables are assigned to the same worker each iteration */
+    for (w = 0; w < 4; w ++) {
+        ecs_iter_t it_1 = ecs_query_iter(world, q);
+        ecs_iter_t wit_1 = ecs_worker_table_iter(&it_1, w, 4);
+        ecs_iter_t it_2 = ecs_query_iter(world, q);
+        ecs_iter_t wit_2 = ecs_worker_table_iter(&it_2, w, 4);
+        while (ecs_worker_next(&wit_1)) {
+            test_bool(ecs_worker_next(&wit_2), true);
+            test_assert(wit_1.table == wit_2.table);
+        }
+        test_bool(ecs_worker_next(&wit_2), false);
+    }
+
+    ecs_map_fini(&tables);
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Iter_worker_table_iter_w_task_query(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Self);
+
+    ecs_entity_t foo = ecs_new(world); ecs_set(world, foo, Self, {foo});
+
+    ecs_query_t *q = ecs_query(world, {
+        .terms = {{ ecs_id(Self), .src.id = foo }}
+    });
+
+    ecs_iter_t it_1 = ecs_query_iter(world, q);
+    ecs_iter_t wit_1 = ecs_worker_table_iter(&it_1, 0, 2);
+    ecs_iter_t it_2 = ecs_query_iter(world, q);
+    ecs_iter_t wit_2 = ecs_worker_table_iter(&it_2, 1, 2);
+
+    /* Result without table is only returned to first worker */
+    test_bool(ecs_worker_next(&wit_1), true);
+    test_int(wit_1.count, 0);
+    test_int(wit_1.sources[0], foo);
+    Self *ptr = ecs_field(&wit_1, Self, 0);
+    test_int(ptr[0].value, foo);
+    test_bool(ecs_worker_next(&wit_1), false);
+
+    test_bool(ecs_worker_next(&wit_2), false);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
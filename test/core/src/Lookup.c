@@ -949,3 +949,222 @@ void Lookup_lookup_path_65_chars(void) {
 
     ecs_fini(world);
 }
+
+void Lookup_path_cache_get_path(void) {
+    ecs_world_t *world = ecs_mini();
+
+    test_bool(ecs_enable_path_cache(world, true), false);
+
+    ecs_entity_t p = ecs_entity(world, { .name = "Parent" });
+    ecs_entity_t e = ecs_entity(world, { .name = "Child", .parent = p });
+    ecs_entity_t u = ecs_new(world);
+
+    for (int i = 0; i < 2; i ++) {
+        char *path = ecs_get_path(world, e);
+        test_str(path, "Parent.Child");
+        ecs_os_free(path);
+
+        path = ecs_get_path_w_sep(world, 0, e, ".", "");
+        test_str(path, "Parent.Child");
+        ecs_os_free(path);
+
+        path = ecs_get_path_w_sep(world, 0, e, "::", "::");
+        test_str(path, "::Parent::Child");
+        ecs_os_free(path);
+
+        path = ecs_get_path(world, p);
+        test_str(path, "Parent");
+        ecs_os_free(path);
+
+        path = ecs_get_path(world, ecs_id(EcsComponent));
+        test_str(path, "Component");
+        ecs_os_free(path);
+
+        path = ecs_get_path_w_sep(world, 0, ecs_id(EcsComponent), ".", "");
+        test_str(path, "flecs.core.Component");
+        ecs_os_free(path);
+
+        path = ecs_get_path(world, u);
+        char *expect = flecs_asprintf("#%u", (uint32_t)u);
+        test_str(path, expect);
+        ecs_os_free(expect);
+        ecs_os_free(path);
+    }
+
+    test_bool(ecs_enable_path_cache(world, false), true);
+
+    ecs_fini(world);
+}
+
+void Lookup_path_cache_rename(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t p = ecs_entity(world, { .name = "Parent" });
+    ecs_entity_t e = ecs_entity(world, { .name = "Child", .parent = p });
+
+    char *path = ecs_get_path(world, e);
+    test_str(path, "Parent.Child");
+    ecs_os_free(path);
+
+    ecs_set_name(world, e, "Foo");
+
+    path = ecs_get_path(world, e);
+    test_str(path, "Parent.Foo");
+    ecs_os_free(path);
+
+    ecs_set_name(world, p, "Bar");
+
+    path = ecs_get_path(world, e);
+    test_str(path, "Bar.Foo");
+    ecs_os_free(path);
+
+    ecs_set_name(world, e, NULL);
+
+    path = ecs_get_path(world, e);
+    char *expect = flecs_asprintf("#%u", (uint32_t)e);
+    test_str(path, expect);
+    ecs_os_free(expect);
+    ecs_os_free(path);
+
+    ecs_fini(world);
+}
+
+void Lookup_path_cache_reparent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t p = ecs_entity(world, { .name = "Parent" });
+    ecs_entity_t q = ecs_entity(world, { .name = "Other" });
+    ecs_entity_t e = ecs_entity(world, { .name = "Child", .parent = p });
+    ecs_entity_t c = ecs_entity(world, { .name = "GrandChild", .parent = e });
+
+    char *path = ecs_get_path(world, c);
+    test_str(path, "Parent.Child.GrandChild");
+    ecs_os_free(path);
+
+    ecs_add_pair(world, e, EcsChildOf, q);
+
+    path = ecs_get_path(world, c);
+    test_str(path, "Other.Child.GrandChild");
+    ecs_os_free(path);
+
+    ecs_remove_pair(world, e, EcsChildOf, q);
+
+    path = ecs_get_path(world, c);
+    test_str(path, "Child.GrandChild");
+    ecs_os_free(path);
+
+    ecs_fini(world);
+}
+
+void Lookup_path_cache_unnamed_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t p = ecs_entity(world, { .name = "Parent" });
+    ecs_entity_t u = ecs_new_w_pair(world, EcsChildOf, p);
+    ecs_entity_t e = ecs_entity(world, { .name = "Child", .parent = u });
+
+    char *lookup = flecs_asprintf("Parent.#%u.Child", (uint32_t)u);
+    test_assert(ecs_lookup(world, lookup) == e);
+    test_assert(ecs_lookup(world, lookup) == e);
+
+    ecs_remove_pair(world, u, EcsChildOf, p);
+    test_assert(ecs_lookup(world, lookup) == 0);
+    ecs_os_free(lookup);
+
+    char *path = ecs_get_path(world, e);
+    char *expect = flecs_asprintf("#%u.Child", (uint32_t)u);
+    test_str(path, expect);
+    ecs_os_free(expect);
+    ecs_os_free(path);
+
+    ecs_fini(world);
+}
+
+void Lookup_path_cache_delete_recycle(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t p = ecs_entity(world, { .name = "Parent" });
+    ecs_entity_t e = ecs_entity(world, { .name = "Child", .parent = p });
+
+    char *path = ecs_get_path(world, e);
+    test_str(path, "Parent.Child");
+    ecs_os_free(path);
+
+    ecs_delete(world, p);
+    test_assert(!ecs_is_alive(world, e));
+
+    ecs_entity_t r = ecs_new(world);
+    test_assert((uint32_t)r == (uint32_t)p || (uint32_t)r == (uint32_t)e);
+    ecs_set_name(world, r, "Recycled");
+
+    path = ecs_get_path(world, r);
+    test_str(path, "Recycled");
+    ecs_os_free(path);
+
+    test_assert(ecs_lookup(world, "Parent.Child") == 0);
+    test_assert(ecs_lookup(world, "Recycled") == r);
+
+    ecs_fini(world);
+}
+
+void Lookup_path_cache_lookup(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t p = ecs_entity(world, { .name = "Parent" });
+    ecs_entity_t e = ecs_entity(world, { .name = "Child", .parent = p });
+
+    test_assert(ecs_lookup(world, "Parent.Child") == e);
+    test_assert(ecs_lookup(world, "Parent.Child") == e);
+    test_assert(ecs_lookup(world, "Parent") == p);
+    test_assert(ecs_lookup(world, "Parent.Foo") == 0);
+    test_assert(ecs_lookup(world, "Component") == ecs_id(EcsComponent));
+    test_assert(ecs_lookup(world, "Component") == ecs_id(EcsComponent));
+
+    ecs_set_name(world, e, "Foo");
+    test_assert(ecs_lookup(world, "Parent.Child") == 0);
+    test_assert(ecs_lookup(world, "Parent.Foo") == e);
+
+    ecs_set_name(world, p, "Bar");
+    test_assert(ecs_lookup(world, "Parent.Foo") == 0);
+    test_assert(ecs_lookup(world, "Bar.Foo") == e);
+
+    ecs_remove_pair(world, e, EcsChildOf, p);
+    test_assert(ecs_lookup(world, "Bar.Foo") == 0);
+    test_assert(ecs_lookup(world, "Foo") == e);
+
+    ecs_delete(world, e);
+    test_assert(ecs_lookup(world, "Foo") == 0);
+
+    ecs_fini(world);
+}
+
+void Lookup_path_cache_lookup_scope(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t p = ecs_entity(world, { .name = "Parent" });
+    ecs_entity_t e = ecs_entity(world, { .name = "Foo" });
+    ecs_entity_t c = ecs_entity(world, { .name = "Foo", .parent = p });
+
+    test_assert(ecs_lookup(world, "Foo") == e);
+
+    ecs_set_scope(world, p);
+    test_assert(ecs_lookup(world, "Foo") == c);
+    ecs_set_scope(world, 0);
+
+    test_assert(ecs_lookup(world, "Foo") == e);
+    test_assert(ecs_lookup(world, "Parent.Foo") == c);
+
+    ecs_fini(world);
+}
@@ -8329,3 +8329,770 @@ void Observer_multi_observer_eval_count(void) {
 
     ecs_fini(world);
 }
+
+void Observer_on_set_coalesce_deferred_set(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {5, 6}));
+    ctx = (Probe){0};
+
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e2, Position, {30, 40});
+    ecs_set(world, e3, Position, {50, 60});
+    test_int(ctx.invoked, 0);
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 1);
+    test_int(ctx.count, 3);
+    test_uint(ctx.e[0], e1);
+    test_uint(ctx.e[1], e2);
+    test_uint(ctx.e[2], e3);
+
+    test_int(ecs_get(world, e1, Position)->x, 10);
+    test_int(ecs_get(world, e2, Position)->x, 30);
+    test_int(ecs_get(world, e3, Position)->x, 50);
+
+    ecs_fini(world);
+}
+
+void Observer_on_set_coalesce_deferred_modified(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ctx = (Probe){0};
+
+    ecs_defer_begin(world);
+    ecs_modified(world, e1, Position);
+    ecs_modified(world, e2, Position);
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 1);
+    test_int(ctx.count, 2);
+    test_uint(ctx.e[0], e1);
+    test_uint(ctx.e[1], e2);
+
+    ecs_fini(world);
+}
+
+void Observer_on_set_coalesce_2_components(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    Probe ctx_p = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_p
+    });
+
+    Probe ctx_v = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_v
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, 
+        ecs_value(Position, {3, 4}), ecs_value(Velocity, {3, 4}));
+    ctx_p = (Probe){0};
+    ctx_v = (Probe){0};
+
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e1, Velocity, {10, 20});
+    ecs_set(world, e2, Position, {30, 40});
+    ecs_set(world, e2, Velocity, {30, 40});
+    ecs_defer_end(world);
+
+    test_int(ctx_p.invoked, 1);
+    test_int(ctx_p.count, 2);
+    test_uint(ctx_p.e[0], e1);
+    test_uint(ctx_p.e[1], e2);
+
+    test_int(ctx_v.invoked, 1);
+    test_int(ctx_v.count, 2);
+    test_uint(ctx_v.e[0], e1);
+    test_uint(ctx_v.e[1], e2);
+
+    ecs_fini(world);
+}
+
+void Observer_on_set_coalesce_interleaved_add(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Tag);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {5, 6}));
+    ctx = (Probe){0};
+
+    /* Adding Tag moves e2, which must not invalidate the pending event for e1 */
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_add(world, e2, Tag);
+    ecs_set(world, e3, Position, {50, 60});
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 2);
+    test_int(ctx.count, 2);
+    test_uint(ctx.e[0], e1);
+    test_uint(ctx.e[1], e3);
+
+    test_assert(ecs_has(world, e2, Tag));
+
+    ecs_fini(world);
+}
+
+void Observer_on_set_coalesce_different_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Tag);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ecs_add(world, e2, Tag);
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {5, 6}));
+    ctx = (Probe){0};
+
+    /* Events are delivered in command order, so e1 and e3 are not combined */
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e2, Position, {30, 40});
+    ecs_set(world, e3, Position, {50, 60});
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 3);
+    test_int(ctx.count, 3);
+    test_uint(ctx.e[0], e1);
+    test_uint(ctx.e[1], e2);
+    test_uint(ctx.e[2], e3);
+
+    ecs_fini(world);
+}
+
+static
+void Observer_add_tag(ecs_iter_t *it) {
+    probe_system_w_ctx(it, it->ctx);
+
+    ecs_entity_t tag = *(ecs_entity_t*)it->callback_ctx;
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        ecs_add_id(it->world, it->entities[i], tag);
+    }
+}
+
+void Observer_on_set_coalesce_observer_w_add(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Tag);
+
+    Probe ctx_p = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer_add_tag,
+        .ctx = &ctx_p,
+        .callback_ctx = &Tag
+    });
+
+    Probe ctx_v = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_v
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, 
+        ecs_value(Position, {3, 4}), ecs_value(Velocity, {3, 4}));
+    ctx_p = (Probe){0};
+    ctx_v = (Probe){0};
+
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e1, Velocity, {10, 20});
+    ecs_set(world, e2, Position, {30, 40});
+    ecs_set(world, e2, Velocity, {30, 40});
+    ecs_defer_end(world);
+
+    /* The entities already have the tag, so commands enqueued by the first 
+     * observer don't move the entities of the Velocity range. */
+    test_int(ctx_p.invoked, 1);
+    test_int(ctx_p.count, 2);
+    test_int(ctx_v.invoked, 1);
+    test_int(ctx_v.count, 2);
+
+    test_assert(ecs_has(world, e1, Tag));
+    test_assert(ecs_has(world, e2, Tag));
+
+    ecs_fini(world);
+}
+
+static
+void Observer_read_back_tag(ecs_iter_t *it) {
+    probe_system_w_ctx(it, it->ctx);
+
+    ecs_entity_t tag = *(ecs_entity_t*)it->callback_ctx;
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        test_assert(ecs_has_id(it->world, it->entities[i], tag));
+    }
+}
+
+void Observer_on_set_merge_observer_add_read_back(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Tag);
+
+    ecs_entity_t e1 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, 
+        ecs_value(Position, {3, 4}), ecs_value(Velocity, {3, 4}));
+
+    Probe ctx_p = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer_add_tag,
+        .ctx = &ctx_p,
+        .callback_ctx = &Tag
+    });
+
+    Probe ctx_v = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = Observer_read_back_tag,
+        .ctx = &ctx_v,
+        .callback_ctx = &Tag
+    });
+
+    ecs_entity_t e = ecs_new(world);
+    ctx_p = (Probe){0};
+
+    /* The component added by the Position observer is merged before the
+     * event for Velocity is emitted. */
+    ecs_defer_begin(world);
+    ecs_set(world, e, Position, {10, 20});
+    ecs_set(world, e, Velocity, {1, 2});
+    ecs_defer_end(world);
+
+    test_int(ctx_p.invoked, 1);
+    test_int(ctx_v.invoked, 1);
+    test_assert(ecs_has(world, e, Tag));
+
+    ctx_p = (Probe){0};
+    ctx_v = (Probe){0};
+
+    /* Adding the tag moves the entities of the pending Velocity range, so the
+     * Velocity event is emitted for each entity. */
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e1, Velocity, {1, 2});
+    ecs_set(world, e2, Position, {30, 40});
+    ecs_set(world, e2, Velocity, {3, 4});
+    ecs_defer_end(world);
+
+    test_int(ctx_p.invoked, 1);
+    test_int(ctx_p.count, 2);
+    test_int(ctx_v.invoked, 2);
+    test_int(ctx_v.count, 2);
+    test_uint(ctx_v.e[0], e1);
+    test_uint(ctx_v.e[1], e2);
+
+    ecs_fini(world);
+}
+
+static
+void Observer_delete_tagged(ecs_iter_t *it) {
+    probe_system_w_ctx(it, it->ctx);
+
+    ecs_entity_t tag = *(ecs_entity_t*)it->callback_ctx;
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        if (ecs_has_id(it->world, it->entities[i], tag)) {
+            ecs_delete(it->world, it->entities[i]);
+        }
+    }
+}
+
+void Observer_on_set_coalesce_observer_w_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Tag);
+
+    Probe ctx_p = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }, { Tag, .oper = EcsOptional }},
+        .events = { EcsOnSet },
+        .callback = Observer_delete_tagged,
+        .ctx = &ctx_p,
+        .callback_ctx = &Tag
+    });
+
+    Probe ctx_v = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_v
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, 
+        ecs_value(Position, {3, 4}), ecs_value(Velocity, {3, 4}));
+    ecs_entity_t e3 = ecs_insert(world, 
+        ecs_value(Position, {5, 6}), ecs_value(Velocity, {5, 6}));
+    ctx_p = (Probe){0};
+    ctx_v = (Probe){0};
+
+    /* Add tag without moving the entities to a different table while 
+     * deferred, so that the sets are combined into ranges */
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e1, Velocity, {10, 20});
+    ecs_set(world, e2, Position, {30, 40});
+    ecs_set(world, e2, Velocity, {30, 40});
+    ecs_set(world, e3, Position, {50, 60});
+    ecs_set(world, e3, Velocity, {50, 60});
+    ecs_defer_end(world);
+
+    test_int(ctx_p.count, 3);
+    test_int(ctx_v.count, 3);
+
+    ecs_add(world, e2, Tag);
+    ecs_entity_t e4 = ecs_insert(world, 
+        ecs_value(Position, {7, 8}), ecs_value(Velocity, {7, 8}));
+    ecs_add(world, e4, Tag);
+    ctx_p = (Probe){0};
+    ctx_v = (Probe){0};
+
+    /* e2 and e4 are in the same table. The Position observer deletes both,
+     * which invalidates the pending Velocity range. */
+    ecs_defer_begin(world);
+    ecs_set(world, e2, Position, {30, 40});
+    ecs_set(world, e2, Velocity, {30, 40});
+    ecs_set(world, e4, Position, {70, 80});
+    ecs_set(world, e4, Velocity, {70, 80});
+    ecs_defer_end(world);
+
+    test_int(ctx_p.invoked, 1);
+    test_int(ctx_p.count, 2);
+    test_int(ctx_v.invoked, 0);
+    test_assert(!ecs_is_alive(world, e2));
+    test_assert(!ecs_is_alive(world, e4));
+    test_assert(ecs_is_alive(world, e1));
+    test_assert(ecs_is_alive(world, e3));
+
+    ecs_fini(world);
+}
+
+static
+void Observer_last_x(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    float *last_x = it->ctx;
+    *last_x = p[it->count - 1].x;
+}
+
+void Observer_on_set_coalesce_observer_5_sets(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx
+    });
+
+    float last_x = 0;
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer_last_x,
+        .ctx = &last_x,
+        .coalesce = true
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {1, 2}));
+    test_int(ctx.invoked, 1);
+    test_int(last_x, 1);
+
+    ecs_defer_begin(world);
+    int i;
+    for (i = 0; i < 5; i ++) {
+        ecs_set(world, e, Position, {10 + i, 20});
+    }
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 6);
+    test_int(last_x, 14);
+    test_int(ecs_get(world, e, Position)->x, 14);
+
+    ecs_fini(world);
+}
+
+void Observer_on_set_coalesce_observer_2_entities(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .coalesce = true
+    });
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ctx = (Probe){0};
+
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_set(world, e2, Position, {30, 40});
+    ecs_set(world, e1, Position, {11, 21});
+    ecs_set(world, e2, Position, {31, 41});
+    ecs_defer_end(world);
+
+    test_int(ctx.count, 2);
+    test_assert(ctx.e[0] == e1 || ctx.e[1] == e1);
+    test_assert(ctx.e[0] == e2 || ctx.e[1] == e2);
+
+    test_int(ecs_get(world, e1, Position)->x, 11);
+    test_int(ecs_get(world, e2, Position)->x, 31);
+
+    ecs_fini(world);
+}
+
+void Observer_on_set_coalesce_observer_not_deferred(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .coalesce = true
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_set(world, e, Position, {10, 20});
+    ecs_set(world, e, Position, {11, 21});
+
+    test_int(ctx.invoked, 3);
+
+    ecs_fini(world);
+}
+
+void Observer_on_set_coalesce_observer_2_terms(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }, { ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .coalesce = true
+    });
+
+    ecs_entity_t e = ecs_new(world);
+    ecs_set(world, e, Position, {1, 2});
+    ecs_set(world, e, Velocity, {1, 2});
+    ctx = (Probe){0};
+
+    ecs_defer_begin(world);
+    ecs_set(world, e, Position, {10, 20});
+    ecs_set(world, e, Velocity, {10, 20});
+    ecs_set(world, e, Position, {11, 21});
+    ecs_set(world, e, Velocity, {11, 21});
+    ecs_defer_end(world);
+
+    /* One event for the last Position and Velocity command */
+    test_int(ctx.invoked, 2);
+
+    ecs_fini(world);
+}
+
+void Observer_on_set_coalesce_observer_w_add_tag(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Tag);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx,
+        .coalesce = true
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ctx = (Probe){0};
+
+    ecs_defer_begin(world);
+    ecs_set(world, e, Position, {10, 20});
+    ecs_add(world, e, Tag);
+    ecs_set(world, e, Position, {11, 21});
+    ecs_defer_end(world);
+
+    test_int(ctx.invoked, 1);
+    test_assert(ecs_has(world, e, Tag));
+    test_int(ecs_get(world, e, Position)->x, 11);
+
+    ecs_fini(world);
+}
+
+void Observer_cache_add_observer_after_emit(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx_1 = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_1
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {1, 2}));
+    test_int(ctx_1.invoked, 1);
+
+    Probe ctx_2 = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_2
+    });
+
+    ecs_set(world, e, Position, {3, 4});
+    test_int(ctx_1.invoked, 2);
+    test_int(ctx_2.invoked, 1);
+
+    ecs_fini(world);
+}
+
+void Observer_cache_add_observer_for_other_event_after_emit(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx_1 = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_1
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {1, 2}));
+    test_int(ctx_1.invoked, 1);
+
+    Probe ctx_2 = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx_2
+    });
+
+    ecs_set(world, e, Position, {3, 4});
+    test_int(ctx_1.invoked, 2);
+    test_int(ctx_2.invoked, 0);
+
+    Probe ctx_3 = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd, EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_3
+    });
+
+    ecs_set(world, e, Position, {5, 6});
+    test_int(ctx_1.invoked, 3);
+    test_int(ctx_2.invoked, 0);
+    test_int(ctx_3.invoked, 1);
+
+    ecs_fini(world);
+}
+
+void Observer_cache_delete_observer_after_emit(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx_1 = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_1
+    });
+
+    Probe ctx_2 = {0};
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer,
+        .ctx = &ctx_2
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {1, 2}));
+    test_int(ctx_1.invoked, 1);
+    test_int(ctx_2.invoked, 1);
+
+    ecs_delete(world, o);
+
+    ecs_set(world, e, Position, {3, 4});
+    test_int(ctx_1.invoked, 2);
+    test_int(ctx_2.invoked, 1);
+
+    ecs_fini(world);
+}
+
+void Observer_cache_wildcard_and_id(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Rel);
+    ECS_TAG(world, TgtA);
+    ECS_TAG(world, TgtB);
+
+    Probe ctx_wc = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_pair(Rel, EcsWildcard) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx_wc
+    });
+
+    Probe ctx_a = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_pair(Rel, TgtA) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx_a
+    });
+
+    int i;
+    for (i = 0; i < 3; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        ecs_add_pair(world, e, Rel, TgtA);
+        ecs_add_pair(world, e, Rel, TgtB);
+    }
+
+    test_int(ctx_wc.invoked, 6);
+    test_int(ctx_a.invoked, 3);
+
+    ecs_fini(world);
+}
+
+static
+void Observer_create_observer(ecs_iter_t *it) {
+    Probe *ctx = it->ctx;
+    ctx->invoked ++;
+    if (ctx->invoked == 1) {
+        ecs_observer(it->world, {
+            .query.terms = {{ it->ids[0] }},
+            .events = { EcsOnSet },
+            .callback = Observer,
+            .ctx = ctx->param
+        });
+    }
+}
+
+void Observer_cache_create_observer_in_observer(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx_2 = {0};
+    Probe ctx_1 = { .param = &ctx_2 };
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Observer_create_observer,
+        .ctx = &ctx_1
+    });
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {1, 2}));
+    test_int(ctx_1.invoked, 1);
+
+    ecs_set(world, e, Position, {3, 4});
+    test_int(ctx_1.invoked, 2);
+    test_int(ctx_2.invoked, 1);
+
+    ecs_fini(world);
+}
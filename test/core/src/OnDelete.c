@@ -3334,3 +3334,127 @@ void OnDelete_delete_with_3(void) {
 
     ecs_fini(world);
 }
+
+static int32_t parallel_dtor_count = 0;
+static int32_t parallel_dtor_alive = 0;
+static ecs_world_t *parallel_dtor_world = NULL;
+
+static
+void parallel_dtor(void *ptr, int32_t count, const ecs_type_info_t *ti) {
+    Position *p = ptr;
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        test_int(p[i].x, 10);
+        ecs_os_ainc(&parallel_dtor_count);
+    }
+}
+
+static
+void parallel_on_remove(ecs_iter_t *it) {
+    int32_t i;
+    for (i = 0; i < it->count; i ++) {
+        /* Entities are still alive while OnRemove hooks run */
+        if (ecs_is_alive(parallel_dtor_world, it->entities[i])) {
+            parallel_dtor_alive ++;
+        }
+    }
+}
+
+void OnDelete_delete_threads_hierarchy(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    parallel_dtor_count = 0;
+    parallel_dtor_alive = 0;
+    parallel_dtor_world = world;
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor,
+        .on_remove = parallel_on_remove
+    });
+
+    ecs_set_delete_threads(world, 4);
+
+    ecs_entity_t parent = ecs_new(world);
+    ecs_entity_t child = ecs_new_w_pair(world, EcsChildOf, parent);
+    ecs_set(world, child, Position, {10, 20});
+
+    int i, count = FLECS_PARALLEL_DTOR_MIN * 2;
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e = ecs_new_w_pair(world, EcsChildOf, 
+            i % 2 ? parent : child);
+        ecs_set(world, e, Position, {10, 20});
+    }
+
+    ecs_delete(world, parent);
+
+    test_assert(!ecs_is_alive(world, parent));
+    test_assert(!ecs_is_alive(world, child));
+    test_int(parallel_dtor_count, count + 1);
+    test_int(parallel_dtor_alive, count + 1);
+    test_int(0, ecs_count(world, Position));
+
+    ecs_fini(world);
+}
+
+void OnDelete_delete_threads_small_hierarchy(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    parallel_dtor_count = 0;
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor
+    });
+
+    ecs_set_delete_threads(world, 4);
+
+    ecs_entity_t parent = ecs_new(world);
+    int i;
+    for (i = 0; i < 10; i ++) {
+        ecs_entity_t e = ecs_new_w_pair(world, EcsChildOf, parent);
+        ecs_set(world, e, Position, {10, 20});
+    }
+
+    ecs_delete(world, parent);
+
+    test_assert(!ecs_is_alive(world, parent));
+    test_int(parallel_dtor_count, 10);
+
+    ecs_fini(world);
+}
+
+void OnDelete_delete_threads_delete_with(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Tag);
+
+    parallel_dtor_count = 0;
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor
+    });
+
+    ecs_set_delete_threads(world, 2);
+
+    int i, count = FLECS_PARALLEL_DTOR_MIN + 1;
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e = ecs_new_w(world, Tag);
+        ecs_set(world, e, Position, {10, 20});
+    }
+
+    ecs_delete_with(world, Tag);
+
+    test_int(parallel_dtor_count, count);
+    test_int(0, ecs_count(world, Position));
+
+    /* Table can be reused after its storage was handed off */
+    ecs_entity_t e = ecs_new_w(world, Tag);
+    ecs_set(world, e, Position, {10, 20});
+    test_int(1, ecs_count(world, Position));
+
+    ecs_fini(world);
+}
@@ -5070,3 +5070,114 @@ void Prefab_prefab_child_offset_w_smaller_child_id(void) {
 
     ecs_fini(world);
 }
+
+void Prefab_bulk_new_w_isa(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_set(world, p, Position, {10, 20});
+
+    const ecs_entity_t *ids = ecs_bulk_new_w_id(world, ecs_isa(p), 10);
+    test_assert(ids != NULL);
+
+    int i;
+    for (i = 0; i < 10; i ++) {
+        ecs_entity_t e = ids[i];
+        test_assert(ecs_has_pair(world, e, EcsIsA, p));
+        const Position *ptr = ecs_get(world, e, Position);
+        test_assert(ptr != NULL);
+        test_int(ptr->x, 10);
+        test_int(ptr->y, 20);
+    }
+
+    ecs_fini(world);
+}
+
+void Prefab_bulk_new_w_isa_w_children(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c1 = ecs_entity(world, { .name = "c1", .parent = p });
+    ecs_entity_t c2 = ecs_entity(world, { .name = "c2", .parent = p });
+    ecs_entity_t gc = ecs_entity(world, { .name = "gc", .parent = c1 });
+    ecs_set(world, c1, Position, {1, 2});
+    ecs_set(world, c2, Position, {3, 4});
+    ecs_set(world, gc, Position, {5, 6});
+
+    const ecs_entity_t *ids = ecs_bulk_new_w_id(world, ecs_isa(p), 10);
+    test_assert(ids != NULL);
+
+    int i;
+    for (i = 0; i < 10; i ++) {
+        ecs_entity_t e = ids[i];
+        ecs_entity_t ic1 = ecs_lookup_from(world, e, "c1");
+        ecs_entity_t ic2 = ecs_lookup_from(world, e, "c2");
+        ecs_entity_t igc = ecs_lookup_from(world, e, "c1.gc");
+        test_assert(ic1 != 0);
+        test_assert(ic2 != 0);
+        test_assert(igc != 0);
+        test_assert(ic1 != c1);
+        test_assert(igc != gc);
+        test_assert(ecs_has_pair(world, ic1, EcsChildOf, e));
+        test_assert(ecs_has_pair(world, igc, EcsChildOf, ic1));
+        test_assert(!ecs_has_id(world, ic1, EcsPrefab));
+
+        test_int(ecs_get(world, ic1, Position)->x, 1);
+        test_int(ecs_get(world, ic2, Position)->x, 3);
+        test_int(ecs_get(world, igc, Position)->x, 5);
+    }
+
+    ecs_fini(world);
+}
+
+void Prefab_bulk_new_w_isa_deferred(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity(world, { .name = "c", .parent = p });
+
+    ecs_defer_begin(world);
+    const ecs_entity_t *ids = ecs_bulk_new_w_id(world, ecs_isa(p), 3);
+    test_assert(ids != NULL);
+    ecs_entity_t e0 = ids[0], e2 = ids[2];
+    ecs_defer_end(world);
+
+    test_assert(ecs_has_pair(world, e0, EcsIsA, p));
+    test_assert(ecs_has_pair(world, e2, EcsIsA, p));
+    test_assert(ecs_lookup_from(world, e0, "c") != 0);
+    test_assert(ecs_lookup_from(world, e2, "c") != 0);
+
+    ecs_fini(world);
+}
+
+void Prefab_bulk_new_w_isa_observer(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c = ecs_entity(world, { .name = "c", .parent = p });
+    ecs_set(world, c, Position, {1, 2});
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = Dummy,
+        .ctx = &ctx
+    });
+
+    ecs_bulk_new_w_id(world, ecs_isa(p), 5);
+
+    /* One event per instance child table */
+    test_int(ctx.invoked, 5);
+    test_int(ctx.count, 5);
+
+    ecs_fini(world);
+}
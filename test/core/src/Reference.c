@@ -338,3 +338,221 @@ void Reference_aba_table(void) {
   
   ecs_fini(world);
 }
+
+void Reference_get_cached_ptr(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_ref_t ref = ecs_ref_init(world, e, Position);
+    const Position *p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    test_assert(p == ref.ptr);
+    test_assert(p == ecs_get(world, e, Position));
+
+    const Position *p2 = ecs_ref_get(world, &ref, Position);
+    test_assert(p == p2);
+
+    ecs_fini(world);
+}
+
+void Reference_get_after_table_realloc(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_ref_t ref = ecs_ref_init(world, e, Position);
+    const Position *p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    uint32_t version = ref.table_version;
+
+    for (int i = 0; i < 1000; i ++) {
+        ecs_insert(world, ecs_value(Position, {i, i}));
+    }
+
+    p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    test_assert(ref.table_version != version);
+    test_assert(p == ecs_get(world, e, Position));
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_fini(world);
+}
+
+void Reference_get_after_row_change(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    ecs_ref_t ref = ecs_ref_init(world, e2, Position);
+    const Position *p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    /* Moves e2 to row of e1 without reallocating the table */
+    ecs_delete(world, e1);
+
+    p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    test_assert(p == ecs_get(world, e2, Position));
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    ecs_fini(world);
+}
+
+void Reference_get_after_table_change_same_row(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_ref_t ref = ecs_ref_init(world, e, Position);
+    const Position *p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+
+    /* Entity is at row 0 in both tables */
+    ecs_add(world, e, Foo);
+
+    p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    test_assert(p == ecs_get(world, e, Position));
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_remove(world, e, Position);
+    test_assert(ecs_ref_get(world, &ref, Position) == NULL);
+
+    ecs_fini(world);
+}
+
+void Reference_get_after_merge(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_add(world, e, Foo);
+
+    ecs_ref_t ref = ecs_ref_init(world, e, Position);
+    const Position *p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+
+    /* Moves storage of (Position, Foo) table to (Position) table */
+    ecs_remove_all(world, Foo);
+
+    p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    test_assert(p == ecs_get(world, e, Position));
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_fini(world);
+}
+
+void Reference_get_sparse(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ecs_add_id(world, ecs_id(Position), EcsSparse);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_ref_t ref = ecs_ref_init(world, e, Position);
+    const Position *p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    test_assert(p == ecs_get(world, e, Position));
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_remove(world, e, Position);
+    test_assert(ecs_ref_get(world, &ref, Position) == NULL);
+
+    ecs_set(world, e, Position, {30, 40});
+    p = ecs_ref_get(world, &ref, Position);
+    test_assert(p != NULL);
+    test_assert(p == ecs_get(world, e, Position));
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    ecs_fini(world);
+}
+
+void Reference_get_array(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {30, 40}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {50, 60}));
+    ecs_add(world, e2, Foo);
+    ecs_set(world, e3, Velocity, {1, 2});
+
+    ecs_ref_t refs[5] = {
+        ecs_ref_init(world, e3, Position),
+        ecs_ref_init(world, e1, Position),
+        ecs_ref_init(world, e2, Position),
+        ecs_ref_init(world, e3, Velocity),
+        ecs_ref_init(world, e1, Velocity)
+    };
+
+    void *ptrs[5];
+    ecs_ref_get_array(world, refs, 5, ptrs);
+
+    test_assert(ptrs[0] == ecs_get(world, e3, Position));
+    test_assert(ptrs[1] == ecs_get(world, e1, Position));
+    test_assert(ptrs[2] == ecs_get(world, e2, Position));
+    test_assert(ptrs[3] == ecs_get(world, e3, Velocity));
+    test_assert(ptrs[4] == NULL);
+
+    test_int(((Position*)ptrs[0])->x, 50);
+    test_int(((Position*)ptrs[1])->x, 10);
+    test_int(((Position*)ptrs[2])->x, 30);
+    test_int(((Velocity*)ptrs[3])->x, 1);
+
+    ecs_remove(world, e2, Foo);
+    ecs_remove(world, e1, Position);
+    for (int i = 0; i < 100; i ++) {
+        ecs_insert(world, ecs_value(Position, {i, i}));
+    }
+
+    ecs_ref_get_array(world, refs, 5, ptrs);
+
+    test_assert(ptrs[0] == ecs_get(world, e3, Position));
+    test_assert(ptrs[1] == NULL);
+    test_assert(ptrs[2] == ecs_get(world, e2, Position));
+    test_assert(ptrs[3] == ecs_get(world, e3, Velocity));
+    test_assert(ptrs[4] == NULL);
+
+    test_int(((Position*)ptrs[0])->x, 50);
+    test_int(((Position*)ptrs[2])->x, 30);
+
+    /* Refs are up to date after array get */
+    test_assert(ecs_ref_get(world, &refs[0], Position) == ptrs[0]);
+    test_assert(ecs_ref_get(world, &refs[2], Position) == ptrs[2]);
+
+    ecs_fini(world);
+}
+
+void Reference_get_array_empty(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_ref_get_array(world, NULL, 0, NULL);
+
+    ecs_fini(world);
+}
@@ -780,12 +780,9 @@ void Union_delete_first(void) {
     ecs_iter_t it = ecs_query_iter(world, q);
 
     test_assert(ecs_query_next(&it));
-    test_int(it.count, 1);
+    test_int(it.count, 2);
     test_int(it.entities[0], e3);
-
-    test_assert(ecs_query_next(&it));
-    test_int(it.count, 1);
-    test_int(it.entities[0], e2);
+    test_int(it.entities[1], e2);
 
     test_assert(!ecs_query_next(&it));
 
@@ -823,12 +820,9 @@ void Union_delete_last(void) {
     ecs_iter_t it = ecs_query_iter(world, q);
 
     test_assert(ecs_query_next(&it));
-    test_int(it.count, 1);
-    test_int(it.entities[0], e2);
-
-    test_assert(ecs_query_next(&it));
-    test_int(it.count, 1);
+    test_int(it.count, 2);
     test_int(it.entities[0], e1);
+    test_int(it.entities[1], e2);
 
     test_assert(!ecs_query_next(&it));
 
@@ -1444,3 +1438,129 @@ void Union_defer_add_existing_union_relationship_2_ops(void) {
 
     ecs_fini(world);
 }
+
+void Union_query_contiguous_range(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+    ECS_TAG(world, Running);
+
+    ecs_entity_t e[6];
+    for (int i = 0; i < 6; i ++) {
+        e[i] = ecs_new_w_pair(world, Movement, Walking);
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, Walking)"
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_assert(ecs_query_next(&it));
+    test_int(it.count, 6);
+    for (int i = 0; i < 6; i ++) {
+        test_int(it.entities[i], e[i]);
+    }
+    test_uint(ecs_field_id(&it, 0), ecs_pair(Movement, Walking));
+    test_assert(!ecs_query_next(&it));
+
+    /* Changing the target of an entity splits the range */
+    ecs_add_pair(world, e[2], Movement, Running);
+
+    int32_t count = 0;
+    it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        for (int i = 0; i < it.count; i ++) {
+            test_assert(it.entities[i] != e[2]);
+            test_assert(ecs_has_pair(world, it.entities[i], Movement, Walking));
+        }
+        count += it.count;
+    }
+    test_int(count, 5);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Union_query_var_src_no_range(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Walking);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Movement($x, Walking)"
+    });
+    test_assert(q != NULL);
+
+    int x_var = ecs_query_find_var(q, "x");
+    test_assert(x_var != -1);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_assert(ecs_query_next(&it));
+    test_uint(ecs_iter_get_var(&it, x_var), e2);
+    test_assert(ecs_query_next(&it));
+    test_uint(ecs_iter_get_var(&it, x_var), e1);
+    test_assert(!ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Union_set_many_targets(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+
+    ecs_entity_t tgts[4];
+    for (int i = 0; i < 4; i ++) {
+        tgts[i] = ecs_new(world);
+    }
+
+    ecs_entity_t e[100];
+    for (int i = 0; i < 100; i ++) {
+        e[i] = ecs_new_w_pair(world, Movement, tgts[i % 4]);
+    }
+
+    for (int i = 0; i < 100; i += 3) {
+        ecs_add_pair(world, e[i], Movement, tgts[(i + 1) % 4]);
+    }
+
+    for (int i = 0; i < 100; i += 7) {
+        ecs_remove_pair(world, e[i], Movement, EcsWildcard);
+    }
+
+    for (int t = 0; t < 4; t ++) {
+        ecs_query_t *q = ecs_query(world, {
+            .terms = {{ ecs_pair(Movement, tgts[t]) }}
+        });
+
+        int32_t count = 0;
+        ecs_iter_t it = ecs_query_iter(world, q);
+        while (ecs_query_next(&it)) {
+            for (int i = 0; i < it.count; i ++) {
+                test_uint(ecs_get_target(world, it.entities[i], Movement, 0), 
+                    tgts[t]);
+            }
+            count += it.count;
+        }
+
+        int32_t expect = 0;
+        for (int i = 0; i < 100; i ++) {
+            if (ecs_has_pair(world, e[i], Movement, tgts[t])) {
+                expect ++;
+            }
+        }
+
+        test_int(count, expect);
+        ecs_query_fini(q);
+    }
+
+    ecs_fini(world);
+}
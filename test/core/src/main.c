@@ -186,6 +186,11 @@ void Entity_entity_w_parent_w_add(void);
 void Entity_entity_w_parent_w_add_w_parent(void);
 void Entity_entity_w_parent_w_set(void);
 void Entity_entity_w_parent_w_set_w_parent(void);
+void Entity_get_depth_after_reparent(void);
+void Entity_get_depth_after_reparent_root(void);
+void Entity_get_depth_after_add_path(void);
+void Entity_get_depth_after_delete_parent(void);
+void Entity_get_depth_not_traversable(void);
 
 // Testsuite 'Each'
 void Each_each_tag(void);
@@ -253,6 +258,9 @@ void Iter_rule_page_iter_w_fini(void);
 void Iter_rule_worker_iter_w_fini(void);
 void Iter_to_str_before_next(void);
 void Iter_to_str(void);
+void Iter_worker_table_iter_1(void);
+void Iter_worker_table_iter_4(void);
+void Iter_worker_table_iter_w_task_query(void);
 
 // Testsuite 'Search'
 void Search_search(void);
@@ -541,6 +549,9 @@ void Union_defer_add_union_relationship(void);
 void Union_defer_add_existing_union_relationship(void);
 void Union_defer_add_union_relationship_2_ops(void);
 void Union_defer_add_existing_union_relationship_2_ops(void);
+void Union_query_contiguous_range(void);
+void Union_query_var_src_no_range(void);
+void Union_set_many_targets(void);
 
 // Testsuite 'Hierarchies'
 void Hierarchies_setup(void);
@@ -639,6 +650,19 @@ void Hierarchies_lookup_after_delete_from_root(void);
 void Hierarchies_lookup_after_delete_from_parent(void);
 void Hierarchies_defer_batch_remove_name_w_add_childof(void);
 void Hierarchies_defer_batch_remove_childof_w_add_name(void);
+void Hierarchies_ordered_children(void);
+void Hierarchies_ordered_children_remove_child(void);
+void Hierarchies_ordered_children_reparent(void);
+void Hierarchies_ordered_children_add_trait_after_children(void);
+void Hierarchies_ordered_children_remove_trait(void);
+void Hierarchies_ordered_children_set_order(void);
+void Hierarchies_ordered_children_delete_parent(void);
+void Hierarchies_ordered_children_deferred(void);
+void Hierarchies_ordered_children_remove_all(void);
+void Hierarchies_ordered_children_delete_with(void);
+void Hierarchies_ordered_children_delete_with_childof(void);
+void Hierarchies_ordered_children_delete_relationship_target(void);
+void Hierarchies_ordered_children_delete_child_w_children(void);
 
 // Testsuite 'Has'
 void Has_zero(void);
@@ -699,6 +723,14 @@ void Reference_get_ref_w_low_id_tag(void);
 void Reference_get_ref_w_low_id_tag_after_add(void);
 void Reference_get_nonexisting(void);
 void Reference_aba_table(void);
+void Reference_get_cached_ptr(void);
+void Reference_get_after_table_realloc(void);
+void Reference_get_after_row_change(void);
+void Reference_get_after_table_change_same_row(void);
+void Reference_get_after_merge(void);
+void Reference_get_sparse(void);
+void Reference_get_array(void);
+void Reference_get_array_empty(void);
 
 // Testsuite 'Delete'
 void Delete_setup(void);
@@ -860,6 +892,9 @@ void OnDelete_remove_all_3(void);
 void OnDelete_delete_with_1(void);
 void OnDelete_delete_with_2(void);
 void OnDelete_delete_with_3(void);
+void OnDelete_delete_threads_hierarchy(void);
+void OnDelete_delete_threads_small_hierarchy(void);
+void OnDelete_delete_threads_delete_with(void);
 
 // Testsuite 'Set'
 void Set_set_empty(void);
@@ -975,6 +1010,13 @@ void Lookup_lookup_name_65_chars(void);
 void Lookup_lookup_path_63_chars(void);
 void Lookup_lookup_path_64_chars(void);
 void Lookup_lookup_path_65_chars(void);
+void Lookup_path_cache_get_path(void);
+void Lookup_path_cache_rename(void);
+void Lookup_path_cache_reparent(void);
+void Lookup_path_cache_unnamed_parent(void);
+void Lookup_path_cache_delete_recycle(void);
+void Lookup_path_cache_lookup(void);
+void Lookup_path_cache_lookup_scope(void);
 
 // Testsuite 'Singleton'
 void Singleton_add_singleton(void);
@@ -1545,6 +1587,24 @@ void Observer_cache_test_13(void);
 void Observer_cache_test_14(void);
 void Observer_cache_test_15(void);
 void Observer_cache_test_16(void);
+void Observer_on_set_coalesce_deferred_set(void);
+void Observer_on_set_coalesce_deferred_modified(void);
+void Observer_on_set_coalesce_2_components(void);
+void Observer_on_set_coalesce_interleaved_add(void);
+void Observer_on_set_coalesce_different_tables(void);
+void Observer_on_set_coalesce_observer_w_add(void);
+void Observer_on_set_coalesce_observer_5_sets(void);
+void Observer_on_set_coalesce_observer_2_entities(void);
+void Observer_on_set_coalesce_observer_not_deferred(void);
+void Observer_on_set_coalesce_observer_2_terms(void);
+void Observer_on_set_coalesce_observer_w_add_tag(void);
+void Observer_cache_add_observer_after_emit(void);
+void Observer_cache_delete_observer_after_emit(void);
+void Observer_cache_wildcard_and_id(void);
+void Observer_cache_create_observer_in_observer(void);
+void Observer_on_set_merge_observer_add_read_back(void);
+void Observer_on_set_coalesce_observer_w_delete(void);
+void Observer_cache_add_observer_for_other_event_after_emit(void);
 
 // Testsuite 'ObserverOnSet'
 void ObserverOnSet_set_1_of_1(void);
@@ -1804,6 +1864,10 @@ void Prefab_prefab_recycled_children_recycled_offset_id_different_generation(voi
 void Prefab_prefab_1_child_offset_id_occupied(void);
 void Prefab_prefab_1_child_offset_id_recycled_occupied(void);
 void Prefab_prefab_child_offset_w_smaller_child_id(void);
+void Prefab_bulk_new_w_isa(void);
+void Prefab_bulk_new_w_isa_w_children(void);
+void Prefab_bulk_new_w_isa_deferred(void);
+void Prefab_bulk_new_w_isa_observer(void);
 
 // Testsuite 'World'
 void World_setup(void);
@@ -2043,6 +2107,19 @@ void Commands_add_isa_set_w_override_batched(void);
 void Commands_add_set_isa_w_override_batched(void);
 void Commands_add_batched_set_with(void);
 void Commands_defer_emplace_after_remove(void);
+void Commands_async_add(void);
+void Commands_async_remove(void);
+void Commands_async_set(void);
+void Commands_async_delete(void);
+void Commands_async_enqueue(void);
+void Commands_async_flush_order(void);
+void Commands_async_flush_deferred(void);
+void Commands_async_flush_empty(void);
+void Commands_async_not_alive(void);
+void Commands_async_flush_frame_begin(void);
+void Commands_async_fini_w_queued(void);
+void Commands_async_multi_thread(void);
+void Commands_async_invalid_id(void);
 
 // Testsuite 'SingleThreadStaging'
 void SingleThreadStaging_setup(void);
@@ -2901,6 +2978,26 @@ bake_test_case Entity_testcases[] = {
     {
         "entity_w_parent_w_set_w_parent",
         Entity_entity_w_parent_w_set_w_parent
+    },
+    {
+        "get_depth_after_reparent",
+        Entity_get_depth_after_reparent
+    },
+    {
+        "get_depth_after_reparent_root",
+        Entity_get_depth_after_reparent_root
+    },
+    {
+        "get_depth_after_add_path",
+        Entity_get_depth_after_add_path
+    },
+    {
+        "get_depth_after_delete_parent",
+        Entity_get_depth_after_delete_parent
+    },
+    {
+        "get_depth_not_traversable",
+        Entity_get_depth_not_traversable
     }
 };
 
@@ -3159,6 +3256,18 @@ bake_test_case Iter_testcases[] = {
     {
         "to_str",
         Iter_to_str
+    },
+    {
+        "worker_table_iter_1",
+        Iter_worker_table_iter_1
+    },
+    {
+        "worker_table_iter_4",
+        Iter_worker_table_iter_4
+    },
+    {
+        "worker_table_iter_w_task_query",
+        Iter_worker_table_iter_w_task_query
     }
 };
 
@@ -4262,6 +4371,18 @@ bake_test_case Union_testcases[] = {
     {
         "defer_add_existing_union_relationship_2_ops",
         Union_defer_add_existing_union_relationship_2_ops
+    },
+    {
+        "query_contiguous_range",
+        Union_query_contiguous_range
+    },
+    {
+        "query_var_src_no_range",
+        Union_query_var_src_no_range
+    },
+    {
+        "set_many_targets",
+        Union_set_many_targets
     }
 };
 
@@ -4645,6 +4766,58 @@ bake_test_case Hierarchies_testcases[] = {
     {
         "defer_batch_remove_childof_w_add_name",
         Hierarchies_defer_batch_remove_childof_w_add_name
+    },
+    {
+        "ordered_children",
+        Hierarchies_ordered_children
+    },
+    {
+        "ordered_children_remove_child",
+        Hierarchies_ordered_children_remove_child
+    },
+    {
+        "ordered_children_reparent",
+        Hierarchies_ordered_children_reparent
+    },
+    {
+        "ordered_children_add_trait_after_children",
+        Hierarchies_ordered_children_add_trait_after_children
+    },
+    {
+        "ordered_children_remove_trait",
+        Hierarchies_ordered_children_remove_trait
+    },
+    {
+        "ordered_children_set_order",
+        Hierarchies_ordered_children_set_order
+    },
+    {
+        "ordered_children_delete_parent",
+        Hierarchies_ordered_children_delete_parent
+    },
+    {
+        "ordered_children_deferred",
+        Hierarchies_ordered_children_deferred
+    },
+    {
+        "ordered_children_remove_all",
+        Hierarchies_ordered_children_remove_all
+    },
+    {
+        "ordered_children_delete_with",
+        Hierarchies_ordered_children_delete_with
+    },
+    {
+        "ordered_children_delete_with_childof",
+        Hierarchies_ordered_children_delete_with_childof
+    },
+    {
+        "ordered_children_delete_relationship_target",
+        Hierarchies_ordered_children_delete_relationship_target
+    },
+    {
+        "ordered_children_delete_child_w_children",
+        Hierarchies_ordered_children_delete_child_w_children
     }
 };
 
@@ -4857,6 +5030,38 @@ bake_test_case Reference_testcases[] = {
     {
         "aba_table",
         Reference_aba_table
+    },
+    {
+        "get_cached_ptr",
+        Reference_get_cached_ptr
+    },
+    {
+        "get_after_table_realloc",
+        Reference_get_after_table_realloc
+    },
+    {
+        "get_after_row_change",
+        Reference_get_after_row_change
+    },
+    {
+        "get_after_table_change_same_row",
+        Reference_get_after_table_change_same_row
+    },
+    {
+        "get_after_merge",
+        Reference_get_after_merge
+    },
+    {
+        "get_sparse",
+        Reference_get_sparse
+    },
+    {
+        "get_array",
+        Reference_get_array
+    },
+    {
+        "get_array_empty",
+        Reference_get_array_empty
     }
 };
 
@@ -5487,6 +5692,18 @@ bake_test_case OnDelete_testcases[] = {
     {
         "delete_with_3",
         OnDelete_delete_with_3
+    },
+    {
+        "delete_threads_hierarchy",
+        OnDelete_delete_threads_hierarchy
+    },
+    {
+        "delete_threads_small_hierarchy",
+        OnDelete_delete_threads_small_hierarchy
+    },
+    {
+        "delete_threads_delete_with",
+        OnDelete_delete_threads_delete_with
     }
 };
 
@@ -5928,6 +6145,34 @@ bake_test_case Lookup_testcases[] = {
     {
         "lookup_path_65_chars",
         Lookup_lookup_path_65_chars
+    },
+    {
+        "path_cache_get_path",
+        Lookup_path_cache_get_path
+    },
+    {
+        "path_cache_rename",
+        Lookup_path_cache_rename
+    },
+    {
+        "path_cache_reparent",
+        Lookup_path_cache_reparent
+    },
+    {
+        "path_cache_unnamed_parent",
+        Lookup_path_cache_unnamed_parent
+    },
+    {
+        "path_cache_delete_recycle",
+        Lookup_path_cache_delete_recycle
+    },
+    {
+        "path_cache_lookup",
+        Lookup_path_cache_lookup
+    },
+    {
+        "path_cache_lookup_scope",
+        Lookup_path_cache_lookup_scope
     }
 };
 
@@ -8174,6 +8419,78 @@ bake_test_case Observer_testcases[] = {
     {
         "cache_test_16",
         Observer_cache_test_16
+    },
+    {
+        "on_set_coalesce_deferred_set",
+        Observer_on_set_coalesce_deferred_set
+    },
+    {
+        "on_set_coalesce_deferred_modified",
+        Observer_on_set_coalesce_deferred_modified
+    },
+    {
+        "on_set_coalesce_2_components",
+        Observer_on_set_coalesce_2_components
+    },
+    {
+        "on_set_coalesce_interleaved_add",
+        Observer_on_set_coalesce_interleaved_add
+    },
+    {
+        "on_set_coalesce_different_tables",
+        Observer_on_set_coalesce_different_tables
+    },
+    {
+        "on_set_coalesce_observer_w_add",
+        Observer_on_set_coalesce_observer_w_add
+    },
+    {
+        "on_set_coalesce_observer_5_sets",
+        Observer_on_set_coalesce_observer_5_sets
+    },
+    {
+        "on_set_coalesce_observer_2_entities",
+        Observer_on_set_coalesce_observer_2_entities
+    },
+    {
+        "on_set_coalesce_observer_not_deferred",
+        Observer_on_set_coalesce_observer_not_deferred
+    },
+    {
+        "on_set_coalesce_observer_2_terms",
+        Observer_on_set_coalesce_observer_2_terms
+    },
+    {
+        "on_set_coalesce_observer_w_add_tag",
+        Observer_on_set_coalesce_observer_w_add_tag
+    },
+    {
+        "cache_add_observer_after_emit",
+        Observer_cache_add_observer_after_emit
+    },
+    {
+        "cache_delete_observer_after_emit",
+        Observer_cache_delete_observer_after_emit
+    },
+    {
+        "cache_wildcard_and_id",
+        Observer_cache_wildcard_and_id
+    },
+    {
+        "cache_create_observer_in_observer",
+        Observer_cache_create_observer_in_observer
+    },
+    {
+        "on_set_merge_observer_add_read_back",
+        Observer_on_set_merge_observer_add_read_back
+    },
+    {
+        "on_set_coalesce_observer_w_delete",
+        Observer_on_set_coalesce_observer_w_delete
+    },
+    {
+        "cache_add_observer_for_other_event_after_emit",
+        Observer_cache_add_observer_for_other_event_after_emit
     }
 };
 
@@ -9172,6 +9489,22 @@ bake_test_case Prefab_testcases[] = {
     {
         "prefab_child_offset_w_smaller_child_id",
         Prefab_prefab_child_offset_w_smaller_child_id
+    },
+    {
+        "bulk_new_w_isa",
+        Prefab_bulk_new_w_isa
+    },
+    {
+        "bulk_new_w_isa_w_children",
+        Prefab_bulk_new_w_isa_w_children
+    },
+    {
+        "bulk_new_w_isa_deferred",
+        Prefab_bulk_new_w_isa_deferred
+    },
+    {
+        "bulk_new_w_isa_observer",
+        Prefab_bulk_new_w_isa_observer
     }
 };
 
@@ -10100,6 +10433,58 @@ bake_test_case Commands_testcases[] = {
     {
         "defer_emplace_after_remove",
         Commands_defer_emplace_after_remove
+    },
+    {
+        "async_add",
+        Commands_async_add
+    },
+    {
+        "async_remove",
+        Commands_async_remove
+    },
+    {
+        "async_set",
+        Commands_async_set
+    },
+    {
+        "async_delete",
+        Commands_async_delete
+    },
+    {
+        "async_enqueue",
+        Commands_async_enqueue
+    },
+    {
+        "async_flush_order",
+        Commands_async_flush_order
+    },
+    {
+        "async_flush_deferred",
+        Commands_async_flush_deferred
+    },
+    {
+        "async_flush_empty",
+        Commands_async_flush_empty
+    },
+    {
+        "async_not_alive",
+        Commands_async_not_alive
+    },
+    {
+        "async_flush_frame_begin",
+        Commands_async_flush_frame_begin
+    },
+    {
+        "async_fini_w_queued",
+        Commands_async_fini_w_queued
+    },
+    {
+        "async_multi_thread",
+        Commands_async_multi_thread
+    },
+    {
+        "async_invalid_id",
+        Commands_async_invalid_id
     }
 };
 
@@ -10681,7 +11066,7 @@ static bake_test_suite suites[] = {
         "Entity",
         NULL,
         NULL,
-        138,
+        143,
         Entity_testcases
     },
     {
@@ -10695,7 +11080,7 @@ static bake_test_suite suites[] = {
         "Iter",
         NULL,
         NULL,
-        58,
+        61,
         Iter_testcases
     },
     {
@@ -10758,14 +11143,14 @@ static bake_test_suite suites[] = {
         "Union",
         NULL,
         NULL,
-        51,
+        54,
         Union_testcases
     },
     {
         "Hierarchies",
         Hierarchies_setup,
         NULL,
-        95,
+        108,
         Hierarchies_testcases
     },
     {
@@ -10793,7 +11178,7 @@ static bake_test_suite suites[] = {
         "Reference",
         Reference_setup,
         NULL,
-        13,
+        21,
         Reference_testcases
     },
     {
@@ -10807,7 +11192,7 @@ static bake_test_suite suites[] = {
         "OnDelete",
         NULL,
         NULL,
-        124,
+        127,
         OnDelete_testcases
     },
     {
@@ -10828,7 +11213,7 @@ static bake_test_suite suites[] = {
         "Lookup",
         Lookup_setup,
         NULL,
-        63,
+        70,
         Lookup_testcases
     },
     {
@@ -10870,7 +11255,7 @@ static bake_test_suite suites[] = {
         "Observer",
         NULL,
         NULL,
-        199,
+        217,
         Observer_testcases
     },
     {
@@ -10912,7 +11297,7 @@ static bake_test_suite suites[] = {
         "Prefab",
         Prefab_setup,
         NULL,
-        150,
+        154,
         Prefab_testcases
     },
     {
@@ -10940,7 +11325,7 @@ static bake_test_suite suites[] = {
         "Commands",
         NULL,
         NULL,
-        139,
+        152,
         Commands_testcases
     },
     {
@@ -4772,3 +4772,26 @@ void Entity_emplace_sparse(void) {
     test_int(v->x, 1);
     test_int(v->y, 2);
 }
+
+void Entity_children_ordered(void) {
+    flecs::world ecs;
+
+    struct Foo { };
+
+    flecs::entity parent = ecs.entity().add(flecs::OrderedChildren);
+    flecs::entity child_1 = ecs.entity().child_of(parent);
+    flecs::entity child_2 = ecs.entity().child_of(parent).add<Foo>();
+    flecs::entity child_3 = ecs.entity().child_of(parent);
+
+    flecs::entity children[3];
+    int32_t count = 0;
+    parent.children([&](flecs::entity child) {
+        test_assert(count < 3);
+        children[count ++] = child;
+    });
+
+    test_int(count, 3);
+    test_assert(children[0] == child_1);
+    test_assert(children[1] == child_2);
+    test_assert(children[2] == child_3);
+}
@@ -445,6 +445,34 @@ void Meta_custom_std_vector_i32_to_json(void) {
     test_str(json, "[1, 2, 3]");
 }
 
+void Meta_custom_std_vector_f32_span_to_json(void) {
+    flecs::world ecs;
+
+    ecs.component<std::vector<float>>()
+        .opaque<float>(ecs.vector<float>().id())
+        .count([](const std::vector<float> *data) {
+            return data->size();
+        })
+        .resize([](std::vector<float> *data, size_t size) {
+            data->resize(size);
+        })
+        .data([](std::vector<float> *data) {
+            return data->data();
+        });
+
+    std::vector<float> v = {1.5, 2.5, 3.5};
+    flecs::string json = ecs.to_json(&v);
+    test_str(json, "[1.5, 2.5, 3.5]");
+
+    std::vector<float> w;
+    const char *r = ecs.from_json(&w, json.c_str());
+    test_str(r, "");
+    test_int(w.size(), 3);
+    test_flt(w[0], 1.5);
+    test_flt(w[1], 2.5);
+    test_flt(w[2], 3.5);
+}
+
 void Meta_custom_std_vector_std_string_to_json(void) {
     flecs::world ecs;
 
@@ -1136,3 +1136,52 @@ void Observer_register_twice_w_each_run(void) {
     ecs.entity().set(Position{10, 20});
     test_int(count2, 1);
 }
+
+void Observer_async(void) {
+    flecs::world ecs;
+
+    int32_t count = 0;
+    flecs::entity o = ecs.observer<const Position>()
+        .event(flecs::OnSet)
+        .async()
+        .each([&](flecs::entity e, const Position& p) {
+            test_int(p.x, 10);
+            e.add<Velocity>();
+            count ++;
+        });
+
+    flecs::entity e = ecs.entity().set<Position>({10, 20});
+    test_int(count, 0);
+    test_int(ecs_observer_queue_count(ecs, o), 1);
+
+    ecs.progress();
+    test_int(count, 1);
+    test_int(ecs_observer_queue_count(ecs, o), 0);
+    test_assert(e.has<Velocity>());
+}
+
+void Observer_coalesce(void) {
+    flecs::world ecs;
+
+    int32_t count = 0;
+    float last_x = 0;
+    ecs.observer<const Position>()
+        .event(flecs::OnSet)
+        .coalesce()
+        .each([&](const Position& p) {
+            last_x = p.x;
+            count ++;
+        });
+
+    flecs::entity e = ecs.entity().set<Position>({10, 20});
+    test_int(count, 1);
+
+    ecs.defer_begin();
+    e.set<Position>({20, 30});
+    e.set<Position>({30, 40});
+    e.set<Position>({40, 50});
+    ecs.defer_end();
+
+    test_int(count, 2);
+    test_int(last_x, 40);
+}
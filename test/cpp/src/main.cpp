@@ -282,6 +282,7 @@ void Entity_set_sparse(void);
 void Entity_insert_1_sparse(void);
 void Entity_insert_2_w_1_sparse(void);
 void Entity_emplace_sparse(void);
+void Entity_children_ordered(void);
 
 // Testsuite 'Pairs'
 void Pairs_add_component_pair(void);
@@ -884,6 +885,8 @@ void Observer_register_twice_w_each(void);
 void Observer_register_twice_w_run(void);
 void Observer_register_twice_w_run_each(void);
 void Observer_register_twice_w_each_run(void);
+void Observer_async(void);
+void Observer_coalesce(void);
 
 // Testsuite 'ComponentLifecycle'
 void ComponentLifecycle_ctor_on_add(void);
@@ -1301,6 +1304,7 @@ void Meta_struct_member_ptr(void);
 void Meta_struct_member_ptr_packed_struct(void);
 void Meta_component_as_array(void);
 void Meta_out_of_order_member_declaration(void);
+void Meta_custom_std_vector_f32_span_to_json(void);
 
 // Testsuite 'Table'
 void Table_each(void);
@@ -2430,6 +2434,10 @@ bake_test_case Entity_testcases[] = {
     {
         "emplace_sparse",
         Entity_emplace_sparse
+    },
+    {
+        "children_ordered",
+        Entity_children_ordered
     }
 };
 
@@ -4779,6 +4787,14 @@ bake_test_case Observer_testcases[] = {
     {
         "register_twice_w_each_run",
         Observer_register_twice_w_each_run
+    },
+    {
+        "async",
+        Observer_async
+    },
+    {
+        "coalesce",
+        Observer_coalesce
     }
 };
 
@@ -6398,6 +6414,10 @@ bake_test_case Meta_testcases[] = {
     {
         "out_of_order_member_declaration",
         Meta_out_of_order_member_declaration
+    },
+    {
+        "custom_std_vector_f32_span_to_json",
+        Meta_custom_std_vector_f32_span_to_json
     }
 };
 
@@ -6572,7 +6592,7 @@ static bake_test_suite suites[] = {
         "Entity",
         NULL,
         NULL,
-        269,
+        270,
         Entity_testcases
     },
     {
@@ -6651,7 +6671,7 @@ static bake_test_suite suites[] = {
         "Observer",
         NULL,
         NULL,
-        46,
+        48,
         Observer_testcases
     },
     {
@@ -6714,7 +6734,7 @@ static bake_test_suite suites[] = {
         "Meta",
         NULL,
         NULL,
-        56,
+        57,
         Meta_testcases
     },
     {
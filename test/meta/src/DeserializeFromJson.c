@@ -6126,3 +6126,154 @@ void DeserializeFromJson_ser_deser_with_child_tgt_no_child(void) {
 
     ecs_fini(world);
 }
+
+void DeserializeFromJson_struct_members_out_of_order(void) {
+    typedef struct {
+        ecs_i32_t x;
+        ecs_i32_t y;
+        ecs_i32_t z;
+    } T;
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t t = ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_entity(world, {.name = "T"}),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t)},
+            {"z", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    test_assert(t != 0);
+
+    T value = {0};
+
+    const char *ptr = ecs_ptr_from_json(world, t, &value, 
+        "{\"z\": 30, \"x\": 10, \"y\": 20}", NULL);
+    test_assert(ptr != NULL);
+    test_assert(ptr[0] == '\0');
+
+    test_int(value.x, 10);
+    test_int(value.y, 20);
+    test_int(value.z, 30);
+
+    ptr = ecs_ptr_from_json(world, t, &value, 
+        "{\"x\": 1, \"z\": 3, \"y\": 2}", NULL);
+    test_assert(ptr != NULL);
+    test_assert(ptr[0] == '\0');
+
+    test_int(value.x, 1);
+    test_int(value.y, 2);
+    test_int(value.z, 3);
+
+    ecs_fini(world);
+}
+
+void DeserializeFromJson_ser_deser_repeated_ids(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Rel);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    ecs_entity_t tgt = ecs_entity(world, { .name = "tgt" });
+    for (int i = 0; i < 10; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        ecs_set(world, e, Position, {i, i * 2});
+        ecs_add(world, e, Foo);
+        ecs_add_pair(world, e, Rel, tgt);
+    }
+
+    char *json = ecs_world_to_json(world, NULL);
+    test_assert(json != NULL);
+    ecs_fini(world);
+
+    world = ecs_init();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_TAG_DEFINE(world, Foo);
+    ECS_TAG_DEFINE(world, Rel);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    const char *r = ecs_world_from_json(world, json, NULL);
+    test_str(r, "");
+    ecs_os_free(json);
+
+    tgt = ecs_lookup(world, "tgt");
+    test_assert(tgt != 0);
+
+    ecs_query_t *q = ecs_query(world, { 
+        .terms = {{ ecs_id(Position) }, { Foo }, { ecs_pair(Rel, tgt) }}
+    });
+
+    int32_t count = 0;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        Position *p = ecs_field(&it, Position, 0);
+        for (int i = 0; i < it.count; i ++) {
+            test_int(p[i].y, p[i].x * 2);
+            count ++;
+        }
+    }
+
+    test_int(count, 10);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+static int lookup_foo_count = 0;
+
+static
+ecs_entity_t count_lookup_foo(
+    const ecs_world_t *world,
+    const char *value,
+    void *ctx)
+{
+    if (!ecs_os_strcmp(value, "Foo")) {
+        lookup_foo_count ++;
+    }
+    return ecs_lookup(world, value);
+}
+
+void DeserializeFromJson_deser_w_lookup_action_repeated_ids(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity(world, { .name = "e1" });
+    ecs_entity(world, { .name = "e2" });
+
+    lookup_foo_count = 0;
+
+    const char *r = ecs_world_from_json(world, 
+        "{\"results\": [{\"name\": \"e1\", \"tags\": [\"Foo\"]}, "
+            "{\"name\": \"e2\", \"tags\": [\"Foo\"]}]}", 
+        &(ecs_from_json_desc_t){ .lookup_action = count_lookup_foo });
+    test_str(r, "");
+
+    /* Custom lookup action is invoked for each occurrence */
+    test_int(lookup_foo_count, 2);
+
+    test_assert(ecs_has(world, ecs_lookup(world, "e1"), Foo));
+    test_assert(ecs_has(world, ecs_lookup(world, "e2"), Foo));
+
+    ecs_fini(world);
+}
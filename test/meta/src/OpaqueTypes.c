@@ -685,3 +685,160 @@ void OpaqueTypes_const_string(void) {
     ecs_fini(world);
 
 }
+
+typedef struct FloatVec {
+    int32_t count;
+    float *elems;
+} FloatVec;
+
+typedef struct FloatArr {
+    float elems[3];
+} FloatArr;
+
+static
+size_t FloatVec_count(const void *ptr) {
+    const FloatVec *data = ptr;
+    return (size_t)data->count;
+}
+
+static
+void FloatVec_resize(void *ptr, size_t count) {
+    FloatVec *data = ptr;
+    data->count = (int32_t)count;
+    if (count) {
+        data->elems = ecs_os_realloc_n(data->elems, float, data->count);
+    } else {
+        ecs_os_free(data->elems);
+        data->elems = NULL;
+    }
+}
+
+static
+void* FloatVec_data(void *ptr) {
+    FloatVec *data = ptr;
+    return data->elems;
+}
+
+static
+void* FloatArr_data(void *ptr) {
+    FloatArr *data = ptr;
+    return data->elems;
+}
+
+static
+int FloatVec_serialize(const ecs_serializer_t *ser, const void *ptr) {
+    (void)ser;
+    (void)ptr;
+    serialize_invoked ++;
+    return -1;
+}
+
+void OpaqueTypes_ser_vec_span_to_json(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, FloatVec);
+
+    ecs_opaque(world, {
+        .entity = ecs_id(FloatVec),
+        .type.as_type = ecs_vector(world, { .type = ecs_id(ecs_f32_t) }),
+        .type.serialize = FloatVec_serialize,
+        .type.count = FloatVec_count,
+        .type.data = FloatVec_data
+    });
+
+    FloatVec v = {3, (float[]){1.5f, 2.5f, 3.5f}};
+
+    char *json = ecs_ptr_to_json(world, ecs_id(FloatVec), &v);
+    test_assert(json != NULL);
+    test_str(json, "[1.5, 2.5, 3.5]");
+    ecs_os_free(json);
+
+    FloatVec empty = {0};
+    json = ecs_ptr_to_json(world, ecs_id(FloatVec), &empty);
+    test_assert(json != NULL);
+    test_str(json, "[]");
+    ecs_os_free(json);
+
+    test_int(serialize_invoked, 0);
+
+    ecs_fini(world);
+}
+
+void OpaqueTypes_ser_array_span_to_json(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, FloatArr);
+
+    ecs_opaque(world, {
+        .entity = ecs_id(FloatArr),
+        .type.as_type = ecs_array(world, { 
+            .type = ecs_id(ecs_f32_t), .count = 3 }),
+        .type.data = FloatArr_data
+    });
+
+    FloatArr v = {{1.5f, 2.5f, 3.5f}};
+
+    char *json = ecs_ptr_to_json(world, ecs_id(FloatArr), &v);
+    test_assert(json != NULL);
+    test_str(json, "[1.5, 2.5, 3.5]");
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void OpaqueTypes_ser_vec_span_to_expr(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, FloatVec);
+
+    ecs_opaque(world, {
+        .entity = ecs_id(FloatVec),
+        .type.as_type = ecs_vector(world, { .type = ecs_id(ecs_f32_t) }),
+        .type.count = FloatVec_count,
+        .type.data = FloatVec_data
+    });
+
+    FloatVec v = {3, (float[]){1.5f, 2.5f, 3.5f}};
+
+    char *expr = ecs_ptr_to_expr(world, ecs_id(FloatVec), &v);
+    test_assert(expr != NULL);
+    test_str(expr, "[1.5, 2.5, 3.5]");
+    ecs_os_free(expr);
+
+    ecs_fini(world);
+}
+
+void OpaqueTypes_deser_vec_span_from_json(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, FloatVec);
+
+    ecs_opaque(world, {
+        .entity = ecs_id(FloatVec),
+        .type.as_type = ecs_vector(world, { .type = ecs_id(ecs_f32_t) }),
+        .type.count = FloatVec_count,
+        .type.resize = FloatVec_resize,
+        .type.data = FloatVec_data
+    });
+
+    FloatVec v = {0};
+
+    const char *ptr = ecs_ptr_from_json(
+        world, ecs_id(FloatVec), &v, "[1.5, 2.5, 3.5]", NULL);
+    test_assert(ptr != NULL);
+    test_str(ptr, "");
+
+    test_int(v.count, 3);
+    test_flt(v.elems[0], 1.5f);
+    test_flt(v.elems[1], 2.5f);
+    test_flt(v.elems[2], 3.5f);
+
+    ptr = ecs_ptr_from_json(world, ecs_id(FloatVec), &v, "[4.5]", NULL);
+    test_assert(ptr != NULL);
+    test_int(v.count, 1);
+    test_flt(v.elems[0], 4.5f);
+
+    ecs_os_free(v.elems);
+
+    ecs_fini(world);
+}
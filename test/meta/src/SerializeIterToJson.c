@@ -2548,3 +2548,187 @@ void SerializeIterToJson_serialize_sparse(void) {
 
     ecs_fini(world);
 }
+
+static
+int flush_to_buf(
+    const char *data,
+    ecs_size_t length,
+    void *ctx)
+{
+    ecs_strbuf_appendstrn(ctx, data, length);
+    return 0;
+}
+
+void SerializeIterToJson_serialize_w_flush_action(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_id(Position),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    for (int i = 0; i < 10000; i ++) {
+        ecs_insert(world, ecs_value(Position, {i, i * 2}));
+    }
+
+    ecs_query_t *q = ecs_query(world, { .expr = "Position" });
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    char *expect = ecs_iter_to_json(&it, NULL);
+    test_assert(expect != NULL);
+
+    ecs_strbuf_t out = ECS_STRBUF_INIT;
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    buf.flush_action = flush_to_buf;
+    buf.flush_ctx = &out;
+
+    it = ecs_query_iter(world, q);
+    test_int(ecs_iter_to_json_buf(&it, &buf, NULL), 0);
+    test_int(ecs_strbuf_flush(&buf), 0);
+
+    char *json = ecs_strbuf_get(&out);
+    test_str(json, expect);
+
+    ecs_os_free(json);
+    ecs_os_free(expect);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void SerializeIterToJson_serialize_world_parallel(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Foo);
+
+    ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_id(Position),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+
+    for (int i = 0; i < 10000; i ++) {
+        ecs_entity_t e = ecs_insert(world, ecs_value(Position, {i, i * 2}));
+        if (!(i % 3)) {
+            ecs_add(world, e, Foo);
+        }
+        if (!(i % 7)) {
+            ecs_set(world, e, Velocity, {1, 2});
+        }
+        if (!(i % 100)) {
+            ecs_add_pair(world, e, EcsChildOf, parent);
+        }
+    }
+
+    char *expect = ecs_world_to_json(world, NULL);
+    test_assert(expect != NULL);
+
+    ecs_world_to_json_desc_t desc = { .thread_count = 4 };
+    char *json = ecs_world_to_json(world, &desc);
+    test_assert(json != NULL);
+    test_str(json, expect);
+    ecs_os_free(json);
+
+    /* More threads than there are tables */
+    desc.thread_count = 32;
+    json = ecs_world_to_json(world, &desc);
+    test_assert(json != NULL);
+    test_str(json, expect);
+    ecs_os_free(json);
+
+    ecs_os_free(expect);
+
+    ecs_fini(world);
+}
+
+void SerializeIterToJson_serialize_world_parallel_small(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_id(Position),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    ecs_entity(world, { .name = "e1" });
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    char *expect = ecs_world_to_json(world, NULL);
+    test_assert(expect != NULL);
+
+    ecs_world_to_json_desc_t desc = { .thread_count = 4 };
+    char *json = ecs_world_to_json(world, &desc);
+    test_assert(json != NULL);
+    test_str(json, expect);
+    ecs_os_free(json);
+
+    ecs_os_free(expect);
+
+    ecs_fini(world);
+}
+
+static
+int flush_world_json(
+    const char *data,
+    ecs_size_t length,
+    void *ptr)
+{
+    ecs_strbuf_appendstrn(ptr, data, length);
+    return 0;
+}
+
+void SerializeIterToJson_serialize_world_parallel_flush(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_id(Position),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    for (int i = 0; i < 10000; i ++) {
+        ecs_insert(world, ecs_value(Position, {i, i * 2}));
+    }
+
+    char *expect = ecs_world_to_json(world, NULL);
+    test_assert(expect != NULL);
+
+    /* Buffer with flush action is serialized on the calling thread */
+    ecs_strbuf_t out = ECS_STRBUF_INIT;
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    buf.flush_action = flush_world_json;
+    buf.flush_ctx = &out;
+
+    ecs_world_to_json_desc_t desc = { .thread_count = 4 };
+    test_int(ecs_world_to_json_buf(world, &buf, &desc), 0);
+    test_int(ecs_strbuf_flush(&buf), 0);
+
+    char *json = ecs_strbuf_get(&out);
+    test_assert(json != NULL);
+    test_str(json, expect);
+    ecs_os_free(json);
+
+    ecs_os_free(expect);
+
+    ecs_fini(world);
+}
@@ -1327,3 +1327,190 @@ void SerializeToJson_serialize_from_stage(void) {
 
     ecs_fini(world);
 }
+
+void SerializeToJson_struct_i64_large(void) {
+    typedef struct {
+        ecs_i64_t x;
+        ecs_i64_t y;
+    } T;
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t t = ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_entity(world, {.name = "T"}),
+        .members = {
+            {"x", ecs_id(ecs_i64_t)},
+            {"y", ecs_id(ecs_i64_t)}
+        }
+    });
+
+    T value = {2147483648, -2147483649};
+    char *expr = ecs_ptr_to_json(world, t, &value);
+    test_assert(expr != NULL);
+    test_str(expr, "{\"x\":\"2147483648\", \"y\":-2147483649}");
+    ecs_os_free(expr);
+
+    ecs_fini(world);
+}
+
+void SerializeToJson_struct_compile_on_first_use(void) {
+    typedef struct {
+        ecs_i32_t x;
+        ecs_i32_t y;
+    } T;
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t t = ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_entity(world, {.name = "T"}),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    test_assert(t != 0);
+
+    const EcsTypeSerializer *ser = ecs_get(world, t, EcsTypeSerializer);
+    test_assert(ser != NULL);
+    test_assert(ser->json == NULL);
+
+    T value = {10, 20};
+    char *expr = ecs_ptr_to_json(world, t, &value);
+    test_assert(expr != NULL);
+    test_str(expr, "{\"x\":10, \"y\":20}");
+    ecs_os_free(expr);
+
+    ser = ecs_get(world, t, EcsTypeSerializer);
+    test_assert(ser != NULL);
+    test_assert(ser->json != NULL);
+
+    expr = ecs_ptr_to_json(world, t, &value);
+    test_assert(expr != NULL);
+    test_str(expr, "{\"x\":10, \"y\":20}");
+    ecs_os_free(expr);
+
+    ecs_fini(world);
+}
+
+void SerializeToJson_struct_mixed_members(void) {
+    typedef enum {
+        Red, Blue, Green
+    } E;
+
+    typedef struct {
+        ecs_i32_t x;
+        E color;
+        ecs_string_t name;
+        bool flag;
+        ecs_f32_t y;
+    } T;
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t e = ecs_enum_init(world, &(ecs_enum_desc_t){
+        .constants = {
+            {"Red"}, {"Blue"}, {"Green"}
+        }
+    });
+
+    test_assert(e != 0);
+
+    ecs_entity_t t = ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_entity(world, {.name = "T"}),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"color", e},
+            {"name", ecs_id(ecs_string_t)},
+            {"flag", ecs_id(ecs_bool_t)},
+            {"y", ecs_id(ecs_f32_t)}
+        }
+    });
+
+    test_assert(t != 0);
+
+    T value = {10, Blue, "Hello", true, 20.5};
+    char *expr = ecs_ptr_to_json(world, t, &value);
+    test_assert(expr != NULL);
+    test_str(expr, 
+        "{\"x\":10, \"color\":\"Blue\", \"name\":\"Hello\", \"flag\":true, \"y\":20.5}");
+    ecs_os_free(expr);
+
+    ecs_fini(world);
+}
+
+void SerializeToJson_struct_struct_w_array_array_3(void) {
+    typedef struct {
+        ecs_i32_t x;
+        ecs_i32_t y[2];
+    } N1;
+
+    typedef struct {
+        N1 n_1[3];
+        ecs_i32_t z;
+    } T;
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t n1 = ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_entity(world, {.name = "N1"}),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"y", ecs_id(ecs_i32_t), 2}
+        }
+    });
+
+    ecs_entity_t t = ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_entity(world, {.name = "T"}),
+        .members = {
+            {"n_1", n1, 3},
+            {"z", ecs_id(ecs_i32_t)}
+        }
+    });
+
+    T value = {{ {10, {1, 2}}, {20, {3, 4}}, {30, {5, 6}} }, 40};
+    char *expr = ecs_ptr_to_json(world, t, &value);
+    test_assert(expr != NULL);
+    test_str(expr, "{\"n_1\":[{\"x\":10, \"y\":[1, 2]}, {\"x\":20, \"y\":[3, 4]}, "
+        "{\"x\":30, \"y\":[5, 6]}], \"z\":40}");
+    ecs_os_free(expr);
+
+    ecs_fini(world);
+}
+
+void SerializeToJson_array_of_struct_w_vector(void) {
+    typedef struct {
+        ecs_i32_t x;
+        ecs_vec_t v;
+    } T;
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_entity_t vt = ecs_vector_init(world, &(ecs_vector_desc_t){
+        .type = ecs_id(ecs_u8_t)
+    });
+
+    ecs_entity_t t = ecs_struct_init(world, &(ecs_struct_desc_t){
+        .entity = ecs_entity(world, {.name = "T"}),
+        .members = {
+            {"x", ecs_id(ecs_i32_t)},
+            {"v", vt}
+        }
+    });
+
+    T value[2] = {{10}, {20}};
+    ecs_vec_init_t(NULL, &value[0].v, ecs_u8_t, 2);
+    ecs_vec_append_t(NULL, &value[0].v, ecs_u8_t)[0] = 1;
+    ecs_vec_append_t(NULL, &value[0].v, ecs_u8_t)[0] = 2;
+    ecs_vec_init_t(NULL, &value[1].v, ecs_u8_t, 0);
+
+    char *expr = ecs_array_to_json(world, t, value, 2);
+    test_assert(expr != NULL);
+    test_str(expr, "[{\"x\":10, \"v\":[1, 2]}, {\"x\":20, \"v\":[]}]");
+    ecs_os_free(expr);
+
+    ecs_vec_fini_t(NULL, &value[0].v, ecs_u8_t);
+    ecs_vec_fini_t(NULL, &value[1].v, ecs_u8_t);
+
+    ecs_fini(world);
+}
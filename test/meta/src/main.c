@@ -537,6 +537,9 @@ void DeserializeFromJson_ser_deser_named_child_to_different_table(void);
 void DeserializeFromJson_ser_deser_with_child_tgt(void);
 void DeserializeFromJson_ser_deser_with_child_tgt_no_child(void);
 void DeserializeFromJson_deser_invalid_entity_name(void);
+void DeserializeFromJson_struct_members_out_of_order(void);
+void DeserializeFromJson_ser_deser_repeated_ids(void);
+void DeserializeFromJson_deser_w_lookup_action_repeated_ids(void);
 
 // Testsuite 'SerializeToJson'
 void SerializeToJson_struct_bool(void);
@@ -585,6 +588,11 @@ void SerializeToJson_vector_i32_3(void);
 void SerializeToJson_vector_struct_i32_i32(void);
 void SerializeToJson_vector_array_i32_3(void);
 void SerializeToJson_serialize_from_stage(void);
+void SerializeToJson_struct_i64_large(void);
+void SerializeToJson_struct_mixed_members(void);
+void SerializeToJson_struct_struct_w_array_array_3(void);
+void SerializeToJson_array_of_struct_w_vector(void);
+void SerializeToJson_struct_compile_on_first_use(void);
 
 // Testsuite 'SerializeEntityToJson'
 void SerializeEntityToJson_serialize_empty(void);
@@ -722,6 +730,10 @@ void SerializeIterToJson_no_fields(void);
 void SerializeIterToJson_no_fields_w_vars(void);
 void SerializeIterToJson_serialize_from_stage(void);
 void SerializeIterToJson_serialize_sparse(void);
+void SerializeIterToJson_serialize_w_flush_action(void);
+void SerializeIterToJson_serialize_world_parallel(void);
+void SerializeIterToJson_serialize_world_parallel_small(void);
+void SerializeIterToJson_serialize_world_parallel_flush(void);
 
 // Testsuite 'SerializeIterToRowJson'
 void SerializeIterToRowJson_serialize_this_w_1_tag(void);
@@ -899,6 +911,10 @@ void OpaqueTypes_ser_deser_world_w_ser_opaque(void);
 void OpaqueTypes_ser_deser_entity(void);
 void OpaqueTypes_ser_deser_0_entity(void);
 void OpaqueTypes_const_string(void);
+void OpaqueTypes_ser_vec_span_to_json(void);
+void OpaqueTypes_ser_array_span_to_json(void);
+void OpaqueTypes_ser_vec_span_to_expr(void);
+void OpaqueTypes_deser_vec_span_from_json(void);
 
 // Testsuite 'Misc'
 void Misc_primitive_from_stage(void);
@@ -3004,6 +3020,18 @@ bake_test_case DeserializeFromJson_testcases[] = {
     {
         "deser_invalid_entity_name",
         DeserializeFromJson_deser_invalid_entity_name
+    },
+    {
+        "struct_members_out_of_order",
+        DeserializeFromJson_struct_members_out_of_order
+    },
+    {
+        "ser_deser_repeated_ids",
+        DeserializeFromJson_ser_deser_repeated_ids
+    },
+    {
+        "deser_w_lookup_action_repeated_ids",
+        DeserializeFromJson_deser_w_lookup_action_repeated_ids
     }
 };
 
@@ -3191,6 +3219,26 @@ bake_test_case SerializeToJson_testcases[] = {
     {
         "serialize_from_stage",
         SerializeToJson_serialize_from_stage
+    },
+    {
+        "struct_i64_large",
+        SerializeToJson_struct_i64_large
+    },
+    {
+        "struct_mixed_members",
+        SerializeToJson_struct_mixed_members
+    },
+    {
+        "struct_struct_w_array_array_3",
+        SerializeToJson_struct_struct_w_array_array_3
+    },
+    {
+        "array_of_struct_w_vector",
+        SerializeToJson_array_of_struct_w_vector
+    },
+    {
+        "struct_compile_on_first_use",
+        SerializeToJson_struct_compile_on_first_use
     }
 };
 
@@ -3729,6 +3777,22 @@ bake_test_case SerializeIterToJson_testcases[] = {
     {
         "serialize_sparse",
         SerializeIterToJson_serialize_sparse
+    },
+    {
+        "serialize_w_flush_action",
+        SerializeIterToJson_serialize_w_flush_action
+    },
+    {
+        "serialize_world_parallel",
+        SerializeIterToJson_serialize_world_parallel
+    },
+    {
+        "serialize_world_parallel_small",
+        SerializeIterToJson_serialize_world_parallel_small
+    },
+    {
+        "serialize_world_parallel_flush",
+        SerializeIterToJson_serialize_world_parallel_flush
     }
 };
 
@@ -4412,6 +4476,22 @@ bake_test_case OpaqueTypes_testcases[] = {
     {
         "const_string",
         OpaqueTypes_const_string
+    },
+    {
+        "ser_vec_span_to_json",
+        OpaqueTypes_ser_vec_span_to_json
+    },
+    {
+        "ser_array_span_to_json",
+        OpaqueTypes_ser_array_span_to_json
+    },
+    {
+        "ser_vec_span_to_expr",
+        OpaqueTypes_ser_vec_span_to_expr
+    },
+    {
+        "deser_vec_span_from_json",
+        OpaqueTypes_deser_vec_span_from_json
     }
 };
 
@@ -4654,14 +4734,14 @@ static bake_test_suite suites[] = {
         "DeserializeFromJson",
         NULL,
         NULL,
-        134,
+        137,
         DeserializeFromJson_testcases
     },
     {
         "SerializeToJson",
         NULL,
         NULL,
-        46,
+        51,
         SerializeToJson_testcases
     },
     {
@@ -4675,7 +4755,7 @@ static bake_test_suite suites[] = {
         "SerializeIterToJson",
         NULL,
         NULL,
-        71,
+        75,
         SerializeIterToJson_testcases
     },
     {
@@ -4710,7 +4790,7 @@ static bake_test_suite suites[] = {
         "OpaqueTypes",
         NULL,
         NULL,
-        18,
+        22,
         OpaqueTypes_testcases
     },
     {
@@ -309,13 +309,9 @@ void Union_1_this_union_wildcard(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
-    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
     test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
 
     test_bool(true, ecs_query_next(&it));
@@ -329,13 +325,9 @@ void Union_1_this_union_wildcard(void) {
     test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e4, it.entities[0]);
-    test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e3, it.entities[0]);
+    test_uint(e4, it.entities[1]);
     test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
     test_bool(false, ecs_query_next(&it));
 
@@ -384,13 +376,9 @@ void Union_1_this_union_tgt(void) {
 
         ecs_iter_t it = ecs_query_iter(world, q);
         test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
-        test_uint(e2, it.entities[0]);
-        test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
-
-        test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
+        test_int(2, it.count);
         test_uint(e1, it.entities[0]);
+        test_uint(e2, it.entities[1]);
         test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
 
         test_bool(false, ecs_query_next(&it));
@@ -413,13 +401,9 @@ void Union_1_this_union_tgt(void) {
         test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
 
         test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
-        test_uint(e4, it.entities[0]);
-        test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
-
-        test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
+        test_int(2, it.count);
         test_uint(e3, it.entities[0]);
+        test_uint(e4, it.entities[1]);
         test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
 
         test_bool(false, ecs_query_next(&it));
@@ -490,14 +474,9 @@ void Union_1_this_union_tgt_var(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
-    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
-    test_uint(Walking, ecs_iter_get_var(&it, x_var));
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
     test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
     test_uint(Walking, ecs_iter_get_var(&it, x_var));
 
@@ -514,14 +493,9 @@ void Union_1_this_union_tgt_var(void) {
     test_uint(Running, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e4, it.entities[0]);
-    test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
-    test_uint(Running, ecs_iter_get_var(&it, x_var));
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e3, it.entities[0]);
+    test_uint(e4, it.entities[1]);
     test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
     test_uint(Running, ecs_iter_get_var(&it, x_var));
 
@@ -580,14 +554,9 @@ void Union_1_this_union_tgt_var_written(void) {
     test_uint(Running, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e4, it.entities[0]);
-    test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 1));
-    test_uint(Running, ecs_iter_get_var(&it, x_var));
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e3, it.entities[0]);
+    test_uint(e4, it.entities[1]);
     test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 1));
     test_uint(Running, ecs_iter_get_var(&it, x_var));
 
@@ -1497,15 +1466,9 @@ void Union_1_this_written_union_tgt_var_written(void) {
     test_uint(Running, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e4, it.entities[0]);
-    test_uint(TagA, ecs_field_id(&it, 1));
-    test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 2));
-    test_uint(Running, ecs_iter_get_var(&it, x_var));
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e3, it.entities[0]);
+    test_uint(e4, it.entities[1]);
     test_uint(TagA, ecs_field_id(&it, 1));
     test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 2));
     test_uint(Running, ecs_iter_get_var(&it, x_var));
@@ -3064,25 +3027,20 @@ void Union_query_after_remove(void) {
     /* Verify all queries are correctly matched */
     ecs_iter_t it = ecs_query_iter(world, q_walking);
     test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e2);
-    test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e1);
+    test_int(it.count, 2);
+    test_int(it.entities[0], e1); test_int(it.entities[1], e2);
     test_assert(!ecs_query_next(&it));
 
     it = ecs_query_iter(world, q_running);
     test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e5);
-    test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e4);
-    test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e3);    
+    test_int(it.count, 3); test_int(it.entities[0], e3);
+    test_int(it.entities[1], e4); test_int(it.entities[2], e5);
     test_assert(!ecs_query_next(&it));
 
     it = ecs_query_iter(world, q_jumping);
     test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e7);
-    test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e6);
+    test_int(it.count, 2);
+    test_int(it.entities[0], e6); test_int(it.entities[1], e7);
     test_assert(!ecs_query_next(&it));
 
     ecs_remove_pair(world, e4, Movement, Running);
@@ -3093,9 +3051,8 @@ void Union_query_after_remove(void) {
     /* Verify queries are still correctly matched, now excluding e4 */
     it = ecs_query_iter(world, q_walking);
     test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e2);
-    test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e1);
+    test_int(it.count, 2);
+    test_int(it.entities[0], e1); test_int(it.entities[1], e2);
     test_assert(!ecs_query_next(&it));
 
     it = ecs_query_iter(world, q_running);
@@ -3120,9 +3077,8 @@ void Union_query_after_remove(void) {
     /* Verify e4 is now matched again */
     it = ecs_query_iter(world, q_walking);
     test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e2);
-    test_assert(ecs_query_next(&it));
-    test_int(it.count, 1); test_int(it.entities[0], e1);
+    test_int(it.count, 2);
+    test_int(it.entities[0], e1); test_int(it.entities[1], e2);
     test_assert(!ecs_query_next(&it));
 
     it = ecs_query_iter(world, q_running);